@@ -33,8 +33,9 @@ namespace UC1701FontConverter
 			int charWidthBytes=1;
 			int charHeightBytes=2;
 			byte[] transposedBytes;
-			byte[] inTmp = new byte[16];
+			byte[] inTmp = new byte[8];
 			string inFileName="";
+			bool compress = false;
 
 			if (args.Length > 0)
 			{
@@ -42,60 +43,70 @@ namespace UC1701FontConverter
 			}
 			else
 			{
-				Console.WriteLine("Usage: UC1701FontConverter filename");
+				Console.WriteLine("Usage: UC1701FontConverter filename [charWidthBytes charHeightBytes] [rle]");
 				Console.ReadLine();
 				return;
 			}
 
 			inBytes = File.ReadAllBytes(inFileName);
-			if (args.Length == 3)
+			if (args.Length >= 3)
 			{
 				charWidthBytes = Int32.Parse(args[1]);
 				charHeightBytes = Int32.Parse(args[2]);
 			}
+			compress = (args[args.Length - 1] == "rle");
 			
-			outBytes = new byte[inBytes.Length+8];
-			outBytes[2] = 32;// first character code
-			outBytes[3] = 126;// last char code
-			outBytes[4] = (byte)(charWidthBytes * 8);// width of the character in pixels
-			outBytes[5] = (byte)(charHeightBytes * 8);// height of the character in pixels
-			outBytes[6] = 1;// page height per character ??
-			outBytes[7] = 16;// bytes per character (normally width * height /8)
-		
-
-			int charLengthBytes = (charWidthBytes * 8 * charHeightBytes);
+			int charWidthPixels = charWidthBytes * 8;
+			int charLengthBytes = (charWidthPixels * charHeightBytes);
 			int numCharsInFont =  inBytes.Length / charLengthBytes;
+			int firstChar = 32;
 
+			outBytes = new byte[numCharsInFont * charLengthBytes];
+
+			// The input has charWidthBytes bytes per pixel row. Each 8 x 8 pixel block becomes 8 column bytes,
+			// stored page by page, so page r, column x of a character is at r * charWidthPixels + x.
 			for (int inChar = 0; inChar < numCharsInFont; inChar++)
 			{
-				Buffer.BlockCopy(inBytes, inChar * charLengthBytes, inTmp, 0, 8);//+ charLengthBytes / 2
-				transposedBytes = transpose8(inTmp);
-				Buffer.BlockCopy(transposedBytes, 0, outBytes, inChar * charLengthBytes , 8);
-
-				Buffer.BlockCopy(inBytes, inChar * charLengthBytes + charLengthBytes / 2, inTmp, 0, 8);
-				transposedBytes = transpose8(inTmp);
-				Buffer.BlockCopy(transposedBytes, 0, outBytes, inChar * charLengthBytes + charLengthBytes / 2, 8);
+				for (int page = 0; page < charHeightBytes; page++)
+				{
+					for (int column = 0; column < charWidthBytes; column++)
+					{
+						for (int row = 0; row < 8; row++)
+						{
+							inTmp[row] = inBytes[inChar * charLengthBytes + (page * 8 + row) * charWidthBytes + column];
+						}
+						transposedBytes = transpose8(inTmp);
+						Buffer.BlockCopy(transposedBytes, 0, outBytes, inChar * charLengthBytes + page * charWidthPixels + column * 8, 8);
+					}
+				}
 			}
 
 			string	cStr=	"const uint8_t font_" + Path.GetFileNameWithoutExtension(inFileName) + "[] = {\n" +
-							"0x00,00,\n" +
-							"32,// first char code\n" +
-							"127,// last char code\n" +
-							"8,// width of the character in pixels\n" +
-							"16,// height of the character in pixels\n" +
-							"1,// page height per character ??\n" +
-							"16,// bytes per character (normally width * height /8)\n";
-
-			for (int i = 0; i < outBytes.Length - 8; i++)
+							(compress ? "UC1701_FONT_FORMAT_RLE,0,\n" : "0x00,00,\n") +
+							"0x" + firstChar.ToString("x2") + ",// first char code\n" +
+							"0x" + (firstChar + numCharsInFont - 1).ToString("x2") + ",// last char code\n" +
+							charWidthPixels + ",// width of the character in pixels\n" +
+							(charHeightBytes * 8) + ",// height of the character in pixels\n" +
+							charHeightBytes + ",// page height per character ??\n" +
+							charLengthBytes + ",// bytes per character (normally width * height /8)\n";
+
+			if (compress)
 			{
-				cStr += "0x" + outBytes[i].ToString("X2");
-				if (i< outBytes.Length-9)
-				{
-					cStr += ",";
-				}
-				if (i != 0 && i % 16 == 15)
+				cStr += compressedFontData(outBytes, charLengthBytes, numCharsInFont);
+			}
+			else
+			{
+				for (int i = 0; i < outBytes.Length; i++)
 				{
-					cStr += "\n";
+					cStr += "0x" + outBytes[i].ToString("X2");
+					if (i< outBytes.Length-1)
+					{
+						cStr += ",";
+					}
+					if (i != 0 && i % 16 == 15)
+					{
+						cStr += "\n";
+					}
 				}
 			}
 			cStr += "};";
@@ -104,6 +115,74 @@ namespace UC1701FontConverter
 		//	File.WriteAllBytes(Path.GetFileNameWithoutExtension(inFileName) + "_converted." + Path.GetExtension(inFileName), outBytes);
 			
 		}
+		// Each character is compressed on its own, so the firmware can find it from the offset table.
+		// A run of 3 or more equal bytes is 0x80|(count-1) then the byte, other bytes are (count-1) then the bytes.
+		static List<byte> rleCompress(byte[] inBytes, int start, int length)
+		{
+			List<byte> outBytes = new List<byte>();
+			List<byte> literals = new List<byte>();
+			int i = start;
+			int end = start + length;
+
+			while (i < end)
+			{
+				int runEnd = i;
+				while (runEnd < end && inBytes[runEnd] == inBytes[i] && runEnd - i < 128)
+				{
+					runEnd++;
+				}
+
+				if (runEnd - i >= 3)
+				{
+					flushLiterals(outBytes, literals);
+					outBytes.Add((byte)(0x80 | (runEnd - i - 1)));
+					outBytes.Add(inBytes[i]);
+					i = runEnd;
+				}
+				else
+				{
+					literals.Add(inBytes[i++]);
+				}
+			}
+			flushLiterals(outBytes, literals);
+			return outBytes;
+		}
+
+		static void flushLiterals(List<byte> outBytes, List<byte> literals)
+		{
+			for (int i = 0; i < literals.Count; i += 128)
+			{
+				int count = Math.Min(128, literals.Count - i);
+				outBytes.Add((byte)(count - 1));
+				outBytes.AddRange(literals.GetRange(i, count));
+			}
+			literals.Clear();
+		}
+
+		// Offset table of numChars + 1 little endian entries, then the compressed characters one per line
+		static string compressedFontData(byte[] fontBytes, int charLengthBytes, int numChars)
+		{
+			string offsetStr = "// offset of each character's data from the end of this table, little endian\n";
+			string dataStr = "// RLE compressed character data\n";
+			int offset = 0;
+
+			for (int c = 0; c < numChars; c++)
+			{
+				List<byte> compressed = rleCompress(fontBytes, c * charLengthBytes, charLengthBytes);
+
+				offsetStr += "0x" + (offset & 0xFF).ToString("x2") + ",0x" + (offset >> 8).ToString("x2") + ",";
+				if (c % 8 == 7)
+				{
+					offsetStr += "\n";
+				}
+				dataStr += string.Join(",", compressed.Select(b => "0x" + b.ToString("x2")));
+				dataStr += (c < numChars - 1) ? ",\n" : "";
+				offset += compressed.Count;
+			}
+			offsetStr += "0x" + (offset & 0xFF).ToString("x2") + ",0x" + (offset >> 8).ToString("x2") + ",\n";
+			return offsetStr + dataStr;
+		}
+
 		/* not needed
 		static byte reverseBitOrder(byte b) 
 		{
@@ -0,0 +1,29 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef _AMBE_REFERENCE_H_
+#define _AMBE_REFERENCE_H_
+
+#include <stdint.h>
+
+void ref_mbe_checkGolayBlock (long int *block);
+int ref_mbe_golay2312 (char *in, char *out);
+int ref_mbe_eccAmbe3600x2450C0 (char ambe_fr[4][24]);
+int ref_mbe_eccAmbe3600x2450Data (char ambe_fr[4][24], char *ambe_d);
+void ref_mbe_demodulateAmbe3600x2450Data (char ambe_fr[4][24]);
+void ref_prepare_framedata(uint8_t *indata, char *ambe_d, int *errs, int *errs2);
+
+#endif /* _AMBE_REFERENCE_H_ */
@@ -0,0 +1,269 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+/*
+ * Checks the firmware's AMBE frame decoder (prepare_framedata() in fw_mbelib.c) bit-exact against the
+ * mbelib code it replaced, kept in ambe_reference.c:
+ * - the test vectors in ambe_vectors.txt, written by the reference with "ambe_test -g"
+ * - random frames from a fixed seed
+ * - every value of every byte of an otherwise zero and an otherwise all-ones frame
+ * For each frame the 49 parameter bits and both error counts have to match.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "fw_mbelib.h"
+#include "ambe_reference.h"
+
+#define AMBE_FRAME_BYTES   9
+#define AMBE_PARAM_BITS    49
+#define RANDOM_FRAMES      1000000
+#define VECTOR_RANDOM      1024
+
+typedef struct
+{
+	uint8_t params[AMBE_PARAM_BITS];
+	int errs;
+	int errs2;
+} ambeResult_t;
+
+static uint32_t randomState = 0x47443737;
+
+static uint8_t random_byte()
+{
+	// xorshift32, the same sequence on every host
+	randomState ^= randomState << 13;
+	randomState ^= randomState >> 17;
+	randomState ^= randomState << 5;
+	return randomState >> 24;
+}
+
+static void decode_reference(const uint8_t *frame, ambeResult_t *result)
+{
+	uint8_t indata[AMBE_FRAME_BYTES];
+	char ambe_d[AMBE_PARAM_BITS];
+
+	memcpy(indata, frame, AMBE_FRAME_BYTES);
+	ref_prepare_framedata(indata, ambe_d, &result->errs, &result->errs2);
+	for (int i = 0; i < AMBE_PARAM_BITS; i++)
+	{
+		result->params[i] = ambe_d[i];
+	}
+}
+
+static void decode_firmware(const uint8_t *frame, ambeResult_t *result)
+{
+	short ambe_d[AMBE_PARAM_BITS];
+
+	prepare_framedata(frame, ambe_d, &result->errs, &result->errs2);
+	for (int i = 0; i < AMBE_PARAM_BITS; i++)
+	{
+		result->params[i] = ambe_d[i];
+	}
+}
+
+static bool results_match(const ambeResult_t *a, const ambeResult_t *b)
+{
+	return (a->errs == b->errs) && (a->errs2 == b->errs2) && (memcmp(a->params, b->params, AMBE_PARAM_BITS) == 0);
+}
+
+static void print_frame(FILE *f, const uint8_t *frame)
+{
+	for (int i = 0; i < AMBE_FRAME_BYTES; i++)
+	{
+		fprintf(f, "%02x", frame[i]);
+	}
+}
+
+static void print_result(FILE *f, const ambeResult_t *result)
+{
+	for (int i = 0; i < AMBE_PARAM_BITS; i++)
+	{
+		fputc('0' + result->params[i], f);
+	}
+	fprintf(f, " %d %d", result->errs, result->errs2);
+}
+
+static int check_frame(const char *what, const uint8_t *frame, const ambeResult_t *expected)
+{
+	ambeResult_t actual;
+
+	decode_firmware(frame, &actual);
+	if (results_match(&actual, expected))
+	{
+		return 0;
+	}
+	fprintf(stderr, "%s mismatch, frame ", what);
+	print_frame(stderr, frame);
+	fprintf(stderr, "\n  expected ");
+	print_result(stderr, expected);
+	fprintf(stderr, "\n  got      ");
+	print_result(stderr, &actual);
+	fprintf(stderr, "\n");
+	return 1;
+}
+
+static int check_against_reference(const char *what, const uint8_t *frame)
+{
+	ambeResult_t expected;
+
+	decode_reference(frame, &expected);
+	return check_frame(what, frame, &expected);
+}
+
+// One line per frame: the frame in hex, the 49 parameter bits, the C0 errors and the total errors
+static void write_vector(const uint8_t *frame)
+{
+	ambeResult_t result;
+
+	decode_reference(frame, &result);
+	print_frame(stdout, frame);
+	fputc(' ', stdout);
+	print_result(stdout, &result);
+	fputc('\n', stdout);
+}
+
+static void generate_vectors()
+{
+	uint8_t frame[AMBE_FRAME_BYTES];
+
+	memset(frame, 0x00, AMBE_FRAME_BYTES);
+	write_vector(frame);
+	memset(frame, 0xff, AMBE_FRAME_BYTES);
+	write_vector(frame);
+	for (int bit = 0; bit < AMBE_FRAME_BYTES * 8; bit++)
+	{
+		memset(frame, 0x00, AMBE_FRAME_BYTES);
+		frame[bit / 8] = 0x80 >> (bit % 8);
+		write_vector(frame);
+	}
+	for (int n = 0; n < VECTOR_RANDOM; n++)
+	{
+		for (int i = 0; i < AMBE_FRAME_BYTES; i++)
+		{
+			frame[i] = random_byte();
+		}
+		write_vector(frame);
+	}
+}
+
+static int check_vectors(const char *path, int *count)
+{
+	FILE *f = fopen(path, "r");
+	char hex[2 * AMBE_FRAME_BYTES + 1];
+	char bits[AMBE_PARAM_BITS + 1];
+	int errs, errs2;
+	int failures = 0;
+
+	*count = 0;
+	if (f == NULL)
+	{
+		fprintf(stderr, "can't open %s\n", path);
+		return 1;
+	}
+	while (fscanf(f, "%18s %49s %d %d", hex, bits, &errs, &errs2) == 4)
+	{
+		uint8_t frame[AMBE_FRAME_BYTES];
+		ambeResult_t expected;
+
+		for (int i = 0; i < AMBE_FRAME_BYTES; i++)
+		{
+			unsigned int byte;
+
+			sscanf(&hex[2 * i], "%2x", &byte);
+			frame[i] = byte;
+		}
+		for (int i = 0; i < AMBE_PARAM_BITS; i++)
+		{
+			expected.params[i] = bits[i] - '0';
+		}
+		expected.errs = errs;
+		expected.errs2 = errs2;
+		failures += check_frame("vector", frame, &expected);
+		(*count)++;
+	}
+	fclose(f);
+	if (*count == 0)
+	{
+		fprintf(stderr, "no vectors in %s\n", path);
+		return 1;
+	}
+	return failures;
+}
+
+static double time_decoder(void (*decode)(const uint8_t *, ambeResult_t *), const uint8_t *frames, int count)
+{
+	ambeResult_t result;
+	clock_t start = clock();
+
+	for (int n = 0; n < count; n++)
+	{
+		decode(&frames[n * AMBE_FRAME_BYTES], &result);
+	}
+	return (double)(clock() - start) * 1e9 / CLOCKS_PER_SEC / count;
+}
+
+int main(int argc, char **argv)
+{
+	const char *vectorPath = "ambe_vectors.txt";
+	uint8_t frame[AMBE_FRAME_BYTES];
+	uint8_t *frames;
+	int vectors;
+	int failures = 0;
+
+	if ((argc > 1) && (strcmp(argv[1], "-g") == 0))
+	{
+		generate_vectors();
+		return 0;
+	}
+	if (argc > 1)
+	{
+		vectorPath = argv[1];
+	}
+
+	failures += check_vectors(vectorPath, &vectors);
+
+	for (int fill = 0x00; fill <= 0xff; fill += 0xff)
+	{
+		for (int pos = 0; pos < AMBE_FRAME_BYTES; pos++)
+		{
+			for (int value = 0; value < 256; value++)
+			{
+				memset(frame, fill, AMBE_FRAME_BYTES);
+				frame[pos] = value;
+				failures += check_against_reference("byte pattern", frame);
+			}
+		}
+	}
+
+	frames = malloc(RANDOM_FRAMES * AMBE_FRAME_BYTES);
+	for (int i = 0; i < RANDOM_FRAMES * AMBE_FRAME_BYTES; i++)
+	{
+		frames[i] = random_byte();
+	}
+	for (int n = 0; (n < RANDOM_FRAMES) && (failures < 10); n++)
+	{
+		failures += check_against_reference("random", &frames[n * AMBE_FRAME_BYTES]);
+	}
+
+	printf("%d vectors, %d byte patterns, %d random frames: %s\n", vectors, 2 * AMBE_FRAME_BYTES * 256, RANDOM_FRAMES, (failures == 0) ? "bit-exact" : "MISMATCH");
+	printf("ns per frame: reference %.1f, firmware %.1f\n", time_decoder(decode_reference, frames, RANDOM_FRAMES), time_decoder(decode_firmware, frames, RANDOM_FRAMES));
+	free(frames);
+
+	return (failures == 0) ? 0 : 1;
+}
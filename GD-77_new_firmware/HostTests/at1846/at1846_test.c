@@ -0,0 +1,202 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+/*
+ * Checks the AT1846S register shadow in fw_i2c.c against a model of the chip with both register pages.
+ * The bandwidth tables of fw_AT1846S.c switch to page 1 to load the AGC table, at the same addresses as
+ * page 0 registers that the tuning updates with masked writes, e.g. 0x0A. After every table the masked
+ * updates and plain writes of page 0 have to reach the chip as they would without a shadow.
+ * Runs polled, as before the scheduler starts, and streamed from the transfer complete interrupt.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// The code under test, built with the host stand-ins in ../include so that the shadow can be checked
+#include "fw_i2c.c"
+#include "fw_AT1846S.c"
+
+#define MODEL_PAGES 2
+#define MODEL_PAGE_REG 0x7F
+
+static uint16_t modelRegs[MODEL_PAGES][AT1846_SHADOW_REGS];
+static uint16_t modelPage;
+static int busWrites;
+static int failures;
+
+static uint32_t randomState = 0x41543138;
+
+static uint16_t random_word()
+{
+	// xorshift32, the same sequence on every host
+	randomState ^= randomState << 13;
+	randomState ^= randomState >> 17;
+	randomState ^= randomState << 5;
+	return randomState >> 16;
+}
+
+status_t I2C_MasterTransferBlocking(I2C_Type *base, i2c_master_transfer_t *xfer)
+{
+	uint16_t *reg;
+
+	if ((xfer->slaveAddress != I2C_MASTER_SLAVE_ADDR_7BIT) || (xfer->subaddressSize != 1) || (xfer->dataSize != 2) || (xfer->subaddress >= AT1846_SHADOW_REGS))
+	{
+		return kStatus_I2C_Nak;
+	}
+	reg = (xfer->subaddress == MODEL_PAGE_REG) ? &modelPage : &modelRegs[modelPage & 1][xfer->subaddress];
+	if (xfer->direction == kI2C_Write)
+	{
+		*reg = (xfer->data[0] << 8) | xfer->data[1];
+		busWrites++;
+	}
+	else
+	{
+		xfer->data[0] = *reg >> 8;
+		xfer->data[1] = *reg & 0xff;
+	}
+	return kStatus_Success;
+}
+
+status_t I2C_MasterTransferNonBlocking(I2C_Type *base, i2c_master_handle_t *handle, i2c_master_transfer_t *xfer)
+{
+	status_t status = I2C_MasterTransferBlocking(base, xfer);
+
+	handle->completionCallback(base, handle, status, handle->userData);
+	return kStatus_Success;
+}
+
+void trxSetBandWidth(bool bandWidthis25kHz)
+{
+	I2C_AT1846_SetBandwidth(bandWidthis25kHz);
+}
+
+static void check_reg(const char *step, int page, uint8_t reg, uint16_t expected)
+{
+	if (modelRegs[page][reg] != expected)
+	{
+		fprintf(stderr, "mismatch: %s, page %d register 0x%02X is 0x%04X instead of 0x%04X\n", step, page, reg, modelRegs[page][reg], expected);
+		failures++;
+	}
+}
+
+// The page 1 registers a bandwidth table writes have to hold its values
+static void check_table_page1(const char *step, const uint8_t settings[][3], int numSettings)
+{
+	int page = 0;
+
+	for (int i = 0; i < numSettings; i++)
+	{
+		if (settings[i][0] == MODEL_PAGE_REG)
+		{
+			page = settings[i][2] & 1;
+		}
+		else if (page == 1)
+		{
+			check_reg(step, 1, settings[i][0], (settings[i][1] << 8) | settings[i][2]);
+		}
+	}
+	if (modelPage != 0)
+	{
+		fprintf(stderr, "mismatch: %s, page %d left selected\n", step, modelPage);
+		failures++;
+	}
+}
+
+static void masked_update(const char *step, uint8_t reg, uint16_t keepMask, uint16_t val)
+{
+	uint16_t expected = (modelRegs[0][reg] & keepMask) | val;
+
+	set_clear_I2C_reg_2byte_with_mask(reg, keepMask >> 8, keepMask & 0xff, val >> 8, val & 0xff);
+	check_reg(step, 0, reg, expected);
+}
+
+static void run(const char *mode)
+{
+	char step[80];
+
+	for (int page = 0; page < MODEL_PAGES; page++)
+	{
+		for (int reg = 0; reg < AT1846_SHADOW_REGS; reg++)
+		{
+			modelRegs[page][reg] = random_word();
+		}
+	}
+	modelPage = 0;
+
+	setup_I2C0();
+	I2C_AT1846S_init();
+	I2C_AT1846_Postinit();
+	check_reg("postinit", 0, 0x0A, 0x7BA0);
+
+	for (int i = 0; i < 6; i++)
+	{
+		bool bandWidthIs25kHz = (i & 1);
+		uint16_t page1Reg0A = bandWidthIs25kHz ? 0x0324 : 0x0314;
+		int writes;
+
+		I2C_AT1846_SetBandwidth(bandWidthIs25kHz);
+		snprintf(step, sizeof(step), "%s, %s kHz table", mode, bandWidthIs25kHz ? "25" : "12.5");
+		if (bandWidthIs25kHz)
+		{
+			check_table_page1(step, AT1846FM25kHzSettings, sizeof(AT1846FM25kHzSettings)/AT1846_BYTES_PER_COMMAND);
+		}
+		else
+		{
+			check_table_page1(step, AT1846FM12P5kHzSettings, sizeof(AT1846FM12P5kHzSettings)/AT1846_BYTES_PER_COMMAND);
+		}
+
+		// The tuning's masked writes to 0x0A, pga gain then padrv ibit
+		snprintf(step, sizeof(step), "%s, %s kHz, masked 0x0A updates", mode, bandWidthIs25kHz ? "25" : "12.5");
+		masked_update(step, 0x0A, 0xF83F, (random_word() & 0x1F) << 6);
+		masked_update(step, 0x0A, 0x87FF, (random_word() & 0x0F) << 11);
+		check_reg(step, 1, 0x0A, page1Reg0A);
+
+		// A page 0 write of the value page 1 holds at the same address still has to go out
+		snprintf(step, sizeof(step), "%s, %s kHz, page 0 write of the page 1 value", mode, bandWidthIs25kHz ? "25" : "12.5");
+		I2C_AT1846_SetBandwidth(!bandWidthIs25kHz);
+		I2C_AT1846_SetBandwidth(bandWidthIs25kHz);
+		write_I2C_reg_2byte(I2C_MASTER_SLAVE_ADDR_7BIT, 0x0A, page1Reg0A >> 8, page1Reg0A & 0xff);
+		check_reg(step, 0, 0x0A, page1Reg0A);
+		check_reg(step, 1, 0x0A, page1Reg0A);
+
+		// Page 0 is still shadowed, writing the same value again stays off the bus
+		writes = busWrites;
+		write_I2C_reg_2byte(I2C_MASTER_SLAVE_ADDR_7BIT, 0x0A, page1Reg0A >> 8, page1Reg0A & 0xff);
+		if (busWrites != writes)
+		{
+			fprintf(stderr, "mismatch: %s, repeated page 0 write was sent again\n", step);
+			failures++;
+		}
+		write_I2C_reg_2byte(I2C_MASTER_SLAVE_ADDR_7BIT, 0x0A, 0x7B, 0xA0);
+		check_reg(step, 0, 0x0A, 0x7BA0);
+	}
+}
+
+int main(int argc, char **argv)
+{
+	hostSchedulerState = taskSCHEDULER_NOT_STARTED;
+	run("polled");
+	hostSchedulerState = taskSCHEDULER_RUNNING;
+	run("streamed");
+
+	if (failures > 0)
+	{
+		fprintf(stderr, "at1846_test: %d mismatches\n", failures);
+		return EXIT_FAILURE;
+	}
+	printf("at1846_test: shadow matches the chip model after the bandwidth tables, polled and streamed, %d bus writes\n", busWrites);
+	return EXIT_SUCCESS;
+}
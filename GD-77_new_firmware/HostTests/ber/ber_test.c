@@ -0,0 +1,244 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+/*
+ * Checks the link quality figures of fw_codec_ber.c against errors injected into AMBE frames.
+ * Frames of zero data are built through the firmware's own deinterleave map and C1 scrambling, then bits
+ * of the Golay codewords C0 and C1 are flipped, up to the 3 each corrects. prepare_framedata() only counts
+ * the flipped data bits, the BER in 0.1 % units has to be those over the 24 data bits of each frame.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "fw_mbelib.h"
+#include "fw_codec_ber.h"
+
+#define AMBE_FRAME_BYTES   9
+#define AMBE_PARAM_BITS    49
+#define GOLAY_MAX_ERRORS   3
+#define RANDOM_FRAMES      100000
+
+// A Golay codeword of ambe_fr, with where its data and parity bits are
+typedef struct
+{
+	int word;
+	int dataLow;
+	int parityLow;
+} codeword_t;
+
+static const codeword_t codewords[2] = {
+		{ 0, 12, 1 }, // C0, bits 23-12 data and 11-1 parity, bit 0 is outside the code
+		{ 1, 11, 0 }, // C1, bits 22-11 data and 10-0 parity
+};
+
+// Frame byte and bit mask of each bit of ambe_fr
+static int bitByte[4][32];
+static uint8_t bitMask[4][32];
+static uint32_t c1Scramble;
+static int failures;
+
+static uint32_t randomState = 0x42455231;
+
+static uint32_t random_below(uint32_t limit)
+{
+	// xorshift32, the same sequence on every host
+	randomState ^= randomState << 13;
+	randomState ^= randomState >> 17;
+	randomState ^= randomState << 5;
+	return randomState % limit;
+}
+
+static void build_interleave_map()
+{
+	uint32_t ambe_fr[4] = { 0, 0, 0, 0 };
+
+	for (int i = 0; i < AMBE_FRAME_BYTES; i++)
+	{
+		for (int b = 0; b < 8; b++)
+		{
+			uint8_t frame[AMBE_FRAME_BYTES] = { 0 };
+
+			frame[i] = 1 << b;
+			mbe_deinterleaveAmbe3600x2450(frame, ambe_fr);
+			for (int w = 0; w < 4; w++)
+			{
+				if (ambe_fr[w] != 0)
+				{
+					int bit = __builtin_ctz(ambe_fr[w]);
+					bitByte[w][bit] = i;
+					bitMask[w][bit] = 1 << b;
+				}
+			}
+		}
+	}
+
+	// The scrambling C1 is sent with when C0 carries zero data
+	ambe_fr[0] = ambe_fr[1] = 0;
+	mbe_demodulateAmbe3600x2450Data(ambe_fr);
+	c1Scramble = ambe_fr[1];
+}
+
+// Flips count distinct bits from bit low up to bit high of *word
+static void flip_bits(uint32_t *word, int low, int high, int count)
+{
+	while (count > 0)
+	{
+		int bit = low + random_below(high - low + 1);
+
+		if (!((*word >> bit) & 1))
+		{
+			*word |= 1U << bit;
+			count--;
+		}
+	}
+}
+
+// Builds a zero data frame with the given numbers of data and parity bit errors in C0 and C1
+static void build_frame(uint8_t *frame, const int dataErrors[2], const int parityErrors[2])
+{
+	uint32_t errors[2] = { 0, 0 };
+	uint32_t ambe_fr[2];
+
+	for (int c = 0; c < 2; c++)
+	{
+		const codeword_t *cw = &codewords[c];
+
+		flip_bits(&errors[c], cw->dataLow, cw->dataLow + 11, dataErrors[c]);
+		flip_bits(&errors[c], cw->parityLow, cw->dataLow - 1, parityErrors[c]);
+	}
+	ambe_fr[0] = errors[0];
+	ambe_fr[1] = errors[1] ^ c1Scramble;
+
+	memset(frame, 0, AMBE_FRAME_BYTES);
+	for (int w = 0; w < 2; w++)
+	{
+		for (int bit = 0; bit < 32; bit++)
+		{
+			if ((ambe_fr[w] >> bit) & 1)
+			{
+				frame[bitByte[w][bit]] |= bitMask[w][bit];
+			}
+		}
+	}
+}
+
+static int decode_frame(const uint8_t *frame)
+{
+	short ambe_d[AMBE_PARAM_BITS];
+	int errs;
+	int errs2;
+
+	prepare_framedata(frame, ambe_d, &errs, &errs2);
+	for (int i = 0; i < AMBE_PARAM_BITS; i++)
+	{
+		if (ambe_d[i] != 0)
+		{
+			fprintf(stderr, "mismatch: parameter bit %d not corrected\n", i);
+			failures++;
+			break;
+		}
+	}
+	codec_ber_add_frame(errs2);
+	return errs2;
+}
+
+static void check_quality(const char *name, int expectedBer, int expectedFrameLoss)
+{
+	int ber;
+	int frameLoss;
+
+	codec_ber_link_quality(&ber, &frameLoss);
+	if ((ber != expectedBer) || (frameLoss != expectedFrameLoss))
+	{
+		fprintf(stderr, "mismatch: %s, BER %d and frame loss %d instead of %d and %d\n", name, ber, frameLoss, expectedBer, expectedFrameLoss);
+		failures++;
+	}
+}
+
+int main(int argc, char **argv)
+{
+	uint8_t frame[AMBE_FRAME_BYTES];
+	codecBerCall_t call;
+	uint32_t dataErrorsTotal = 0;
+
+	build_interleave_map();
+
+	// 10 frames with 1 data error in C0 and 2 parity errors in C1, then 5 frames lost: 10 of 240 bits, 5 of 15 frames
+	codec_ber_start_call(1);
+	for (int i = 0; i < 10; i++)
+	{
+		const int dataErrors[2] = { 1, 0 };
+		const int parityErrors[2] = { 0, 2 };
+
+		build_frame(frame, dataErrors, parityErrors);
+		decode_frame(frame);
+	}
+	codec_ber_add_lost(5);
+	check_quality("fixed errors", 41, 333);
+	codec_ber_get_call(0, &call);
+	if ((call.id != 1) || (call.frames != 10) || (call.bitErrors != 10) || (call.histogram[1] != 10))
+	{
+		fprintf(stderr, "mismatch: fixed errors, call %d with %u frames, %u bit errors and %u frames of 1 error\n", call.id, call.frames, call.bitErrors, call.histogram[1]);
+		failures++;
+	}
+
+	// Parity errors alone are corrected without counting
+	codec_ber_start_call(2);
+	for (int i = 0; i < 10; i++)
+	{
+		const int dataErrors[2] = { 0, 0 };
+		const int parityErrors[2] = { 3, 3 };
+
+		build_frame(frame, dataErrors, parityErrors);
+		decode_frame(frame);
+	}
+	check_quality("parity errors only", 0, 0);
+
+	// Random splits of up to 3 errors per codeword between data and parity bits
+	codec_ber_start_call(3);
+	for (int i = 0; i < RANDOM_FRAMES; i++)
+	{
+		int dataErrors[2];
+		int parityErrors[2];
+		int errs2;
+
+		for (int c = 0; c < 2; c++)
+		{
+			int total = random_below(GOLAY_MAX_ERRORS + 1);
+
+			dataErrors[c] = random_below(total + 1);
+			parityErrors[c] = total - dataErrors[c];
+		}
+		build_frame(frame, dataErrors, parityErrors);
+		errs2 = decode_frame(frame);
+		if (errs2 != dataErrors[0] + dataErrors[1])
+		{
+			fprintf(stderr, "mismatch: frame %d counted %d errors instead of %d\n", i, errs2, dataErrors[0] + dataErrors[1]);
+			failures++;
+		}
+		dataErrorsTotal += dataErrors[0] + dataErrors[1];
+	}
+	check_quality("random errors", (dataErrorsTotal * 1000) / (RANDOM_FRAMES * 24), 0);
+
+	if (failures > 0)
+	{
+		fprintf(stderr, "ber_test: %d mismatches\n", failures);
+		return EXIT_FAILURE;
+	}
+	printf("ber_test: %d frames with injected data and parity errors, BER counts the data bits\n", RANDOM_FRAMES + 20);
+	return EXIT_SUCCESS;
+}
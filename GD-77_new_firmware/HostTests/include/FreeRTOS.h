@@ -0,0 +1,47 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef INC_FREERTOS_H
+#define INC_FREERTOS_H
+
+// Host stand-in for FreeRTOS, a single thread runs the code under test so nothing has to block
+
+#include "fw_common.h"
+
+typedef uint32_t TickType_t;
+typedef long BaseType_t;
+typedef uint32_t portSTACK_TYPE;
+
+#define pdFALSE					0
+#define pdTRUE					1
+#define pdPASS					1
+#define portMAX_DELAY			0xffffffffU
+#define pdMS_TO_TICKS(ms)		((TickType_t)(ms))
+#define portTICK_PERIOD_MS		1
+
+#define portYIELD_FROM_ISR(woken)	((void)(woken))
+
+#define taskENTER_CRITICAL()
+#define taskEXIT_CRITICAL()
+
+// Cycle counter of the Cortex-M4, the host build just reads zero
+static struct
+{
+	volatile uint32_t CYCCNT;
+} hostDWT __attribute__((unused));
+#define DWT (&hostDWT)
+
+#endif /* INC_FREERTOS_H */
@@ -0,0 +1,153 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef _FSL_I2C_H_
+#define _FSL_I2C_H_
+
+// Host stand-in for the SDK I2C driver and the other SDK and CMSIS calls fw_i2c.c makes.
+// The transfer functions are left to the test, which answers them from a model of the devices on the bus.
+
+#include "fw_common.h"
+
+typedef int32_t status_t;
+
+enum
+{
+	kStatus_Success = 0,
+	kStatus_I2C_Busy = 1100,
+	kStatus_I2C_Nak = 1102,
+	kStatus_I2C_Timeout = 1107
+};
+
+typedef struct
+{
+	int dummy;
+} I2C_Type;
+
+static I2C_Type hostI2C0 __attribute__((unused));
+#define I2C0			(&hostI2C0)
+#define I2C0_IRQn		0
+#define I2C0_CLK_SRC	0
+
+typedef enum
+{
+	kI2C_Write = 0,
+	kI2C_Read = 1
+} i2c_direction_t;
+
+#define kI2C_TransferDefaultFlag	0
+
+typedef struct
+{
+	uint32_t flags;
+	uint8_t slaveAddress;
+	i2c_direction_t direction;
+	uint32_t subaddress;
+	uint8_t subaddressSize;
+	uint8_t *volatile data;
+	volatile size_t dataSize;
+} i2c_master_transfer_t;
+
+typedef struct _i2c_master_handle i2c_master_handle_t;
+typedef void (*i2c_master_transfer_callback_t)(I2C_Type *base, i2c_master_handle_t *handle, status_t status, void *userData);
+
+struct _i2c_master_handle
+{
+	i2c_master_transfer_callback_t completionCallback;
+	void *userData;
+};
+
+typedef struct
+{
+	bool enableMaster;
+	uint32_t baudRate_Bps;
+} i2c_master_config_t;
+
+static inline void I2C_MasterGetDefaultConfig(i2c_master_config_t *config)
+{
+	config->enableMaster = true;
+	config->baudRate_Bps = 100000U;
+}
+
+static inline void I2C_MasterInit(I2C_Type *base, const i2c_master_config_t *config, uint32_t srcClock_Hz)
+{
+}
+
+static inline void I2C_MasterTransferCreateHandle(I2C_Type *base, i2c_master_handle_t *handle, i2c_master_transfer_callback_t callback, void *userData)
+{
+	handle->completionCallback = callback;
+	handle->userData = userData;
+}
+
+// Implemented by the test. The non-blocking transfer calls the completion callback before it returns.
+status_t I2C_MasterTransferBlocking(I2C_Type *base, i2c_master_transfer_t *xfer);
+status_t I2C_MasterTransferNonBlocking(I2C_Type *base, i2c_master_handle_t *handle, i2c_master_transfer_t *xfer);
+
+static inline void I2C_MasterTransferAbort(I2C_Type *base, i2c_master_handle_t *handle)
+{
+}
+
+static inline uint32_t CLOCK_GetFreq(int clock)
+{
+	return 60000000U;
+}
+
+static inline void NVIC_SetPriority(int irq, uint32_t priority)
+{
+}
+
+// Thread mode with no interrupts masked
+static inline uint32_t __get_BASEPRI()
+{
+	return 0;
+}
+
+static inline uint32_t __get_IPSR()
+{
+	return 0;
+}
+
+typedef struct
+{
+	int pullSelect;
+	int slewRate;
+	int passiveFilterEnable;
+	int openDrainEnable;
+	int driveStrength;
+	int mux;
+	int lockRegister;
+} port_pin_config_t;
+
+enum
+{
+	kPORT_PullUp = 3,
+	kPORT_FastSlewRate = 0,
+	kPORT_PassiveFilterDisable = 0,
+	kPORT_OpenDrainEnable = 1,
+	kPORT_LowDriveStrength = 0,
+	kPORT_MuxAlt2 = 2,
+	kPORT_MuxAlt5 = 5,
+	kPORT_UnlockRegister = 0
+};
+
+#define PORTB	NULL
+#define PORTE	NULL
+
+static inline void PORT_SetPinConfig(void *base, uint32_t pin, const port_pin_config_t *config)
+{
+}
+
+#endif /* _FSL_I2C_H_ */
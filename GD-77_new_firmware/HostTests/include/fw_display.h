@@ -0,0 +1,45 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef _FW_DISPLAY_H_
+#define _FW_DISPLAY_H_
+
+// Host stand-in for fw_display.h, the display pins write to a dummy GPIO port
+
+#include "fw_common.h"
+
+typedef struct
+{
+	volatile uint32_t PSOR;
+	volatile uint32_t PCOR;
+} hostGPIO_t;
+
+static hostGPIO_t hostGPIO;
+
+#define GPIO_Display_CS		(&hostGPIO)
+#define Pin_Display_CS		0
+#define GPIO_Display_RS		(&hostGPIO)
+#define Pin_Display_RS		1
+#define GPIO_Display_SCK	(&hostGPIO)
+#define Pin_Display_SCK		2
+#define GPIO_Display_SDA	(&hostGPIO)
+#define Pin_Display_SDA		3
+
+#define GPIO_PinWrite(base, pin, output)
+
+#define TASK_PRIORITY_HOUSEKEEPING	1
+
+#endif /* _FW_DISPLAY_H_ */
@@ -0,0 +1,31 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef _FW_SETTINGS_H_
+#define _FW_SETTINGS_H_
+
+// Host stand-in for fw_settings.h, only the fields the code under test reads
+
+#include "fw_common.h"
+
+typedef struct settingsStruct
+{
+	int8_t			displayContrast;
+} settingsStruct_t;
+
+static settingsStruct_t nonVolatileSettings;
+
+#endif /* _FW_SETTINGS_H_ */
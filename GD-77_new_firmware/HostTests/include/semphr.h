@@ -0,0 +1,75 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef SEMAPHORE_H
+#define SEMAPHORE_H
+
+#include "FreeRTOS.h"
+
+#include "task.h"
+
+typedef void *SemaphoreHandle_t;
+
+// Nothing ever waits, but code that checks its handles were created needs one that isn't NULL
+static int hostSemaphore __attribute__((unused));
+
+static inline SemaphoreHandle_t xSemaphoreCreateMutex()
+{
+	return NULL;
+}
+
+static inline SemaphoreHandle_t xSemaphoreCreateRecursiveMutex()
+{
+	return &hostSemaphore;
+}
+
+static inline SemaphoreHandle_t xSemaphoreCreateBinary()
+{
+	return &hostSemaphore;
+}
+
+static inline BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t wait)
+{
+	return pdTRUE;
+}
+
+static inline BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore)
+{
+	return pdTRUE;
+}
+
+static inline BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t semaphore, BaseType_t *higherPriorityTaskWoken)
+{
+	return pdTRUE;
+}
+
+static inline BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t semaphore, TickType_t wait)
+{
+	return pdTRUE;
+}
+
+static inline BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t semaphore)
+{
+	return pdTRUE;
+}
+
+// No task holds anything, so a polled transfer may always go ahead
+static inline TaskHandle_t xSemaphoreGetMutexHolderFromISR(SemaphoreHandle_t semaphore)
+{
+	return NULL;
+}
+
+#endif /* SEMAPHORE_H */
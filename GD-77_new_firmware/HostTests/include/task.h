@@ -0,0 +1,65 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef INC_TASK_H
+#define INC_TASK_H
+
+#include "FreeRTOS.h"
+
+typedef void *TaskHandle_t;
+
+#define taskSCHEDULER_NOT_STARTED	1
+#define taskSCHEDULER_RUNNING		2
+
+// Set by a test to run the code under test as if from a task, rather than before the scheduler starts
+static BaseType_t hostSchedulerState __attribute__((unused)) = taskSCHEDULER_NOT_STARTED;
+
+// No tasks are started on the host, a task body is never run
+static inline BaseType_t xTaskCreate(void (*code)(void *), const char *name, uint32_t stack, void *param, int priority, TaskHandle_t *handle)
+{
+	return pdPASS;
+}
+
+static inline TickType_t xTaskGetTickCount()
+{
+	return 0;
+}
+
+static inline void vTaskDelay(TickType_t ticks)
+{
+}
+
+static inline BaseType_t xTaskGetSchedulerState()
+{
+	return hostSchedulerState;
+}
+
+static inline TaskHandle_t xTaskGetCurrentTaskHandle()
+{
+	return NULL;
+}
+
+static inline uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t wait)
+{
+	return 0;
+}
+
+static inline BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+	return pdPASS;
+}
+
+#endif /* INC_TASK_H */
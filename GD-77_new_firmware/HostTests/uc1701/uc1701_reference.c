@@ -0,0 +1,159 @@
+/*
+ * Copyright (C)2019 Roger Clark, VK3KYY / G4KYF
+ *
+ * Development informed by work from  Rustem Iskuzhin (in 2014)
+ * and https://github.com/bitbank2/uc1701/
+ * and https://os.mbed.com/users/Anaesthetix/code/UC1701/file/7494bdca926b/
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+/*
+ * Reference for uc1701_test.c: UC1701_printCore() and the fonts as they were before the single-pass blitter
+ * and the compressed 16x32 font. Only the symbols are renamed with a ref_ prefix, keep it unchanged so that
+ * it stays the baseline. It draws into ref_screenBuf, which is twice the screen because the baseline wrote
+ * past the bottom of the screen for characters that don't fit.
+ */
+
+#include "uc1701_reference.h"
+#include "uc1701_reference_charset.h"
+
+uint8_t ref_screenBuf[2048];
+
+int ref_UC1701_printCore(int x, int y, char *szMsg, int iSize, int alignment, bool isInverted)
+{
+int i, sLen;
+uint8_t *currentCharData;
+int charWidthPixels;
+int charHeightPixels;
+int bytesPerChar;
+int startCode;
+uint8_t *currentFont;
+uint8_t *writePos;
+uint8_t *readPos;
+
+    sLen = strlen(szMsg);
+
+    switch(iSize)
+    {
+    	case UC1701_FONT_6X8:
+    		currentFont = (uint8_t *) ref_font_6x8;
+    		break;
+    	case UC1701_FONT_6X8_bold:
+			currentFont = (uint8_t *) ref_font_6x8_bold;
+    		break;
+    	case UC1701_FONT_8X8:
+    		currentFont = (uint8_t *) ref_font_8x8;
+    		break;
+    	case UC1701_FONT_GD77_8x16:
+    		currentFont = (uint8_t *) ref_font_gd77_8x16;
+			break;
+    	case UC1701_FONT_16x32:
+    		currentFont = (uint8_t *) ref_font_16x32;
+			break;
+
+    	default:
+    		return -2;// Invalid font selected
+    		break;
+    }
+
+    startCode   		= currentFont[2];  // get first defined character
+    charWidthPixels   	= currentFont[4];  // width in pixel of one char
+    charHeightPixels  	= currentFont[5];  // page count per char
+    bytesPerChar 		= currentFont[7];  // bytes per char
+
+    if ((charWidthPixels*sLen) + x > 128)
+	{
+    	sLen = (128-x)/charWidthPixels;
+	}
+
+	if (sLen < 0)
+	{
+		return -1;
+	}
+
+	switch(alignment)
+	{
+		case 0:
+			// left aligned, do nothing.
+			break;
+		case 1:// Align centre
+			x = (128 - (charWidthPixels * sLen))/2;
+			break;
+		case 2:// align right
+			x = 128 - (charWidthPixels * sLen);
+			break;
+	}
+
+	for (i=0; i<sLen; i++)
+	{
+		currentCharData = (unsigned char *)&currentFont[8 + ((szMsg[i] - startCode) * bytesPerChar)];
+
+		for(int row=0;row < charHeightPixels / 8 ;row++)
+		{
+			readPos = (currentCharData + row*charWidthPixels);
+			writePos = (ref_screenBuf + x + (i*charWidthPixels) + ((y>>3) + row)*128) ;
+
+			if ((y&0x07)==0)
+			{
+				// y position is aligned to a row
+				for(int p=0;p<charWidthPixels;p++)
+				{
+					if (isInverted)
+					{
+						*writePos++ &= ~(*readPos++);
+					}
+					else
+					{
+						*writePos++ |= *readPos++;
+					}
+				}
+			}
+			else
+			{
+				int shiftNum = y & 0x07;
+				// y position is NOT aligned to a row
+
+				for(int p=0;p<charWidthPixels;p++)
+				{
+					if (isInverted)
+					{
+						*writePos++ &= ~((*readPos++) << shiftNum);
+					}
+					else
+					{
+						*writePos++ |= ((*readPos++) << shiftNum);
+					}
+				}
+
+				readPos = (currentCharData + row*charWidthPixels);
+				writePos = (ref_screenBuf + x + (i*charWidthPixels) + ((y>>3) + row + 1)*128) ;
+
+				for(int p=0;p<charWidthPixels;p++)
+				{
+					if (isInverted)
+					{
+						*writePos++ &= ~((*readPos++) >> (8 - shiftNum));
+					}
+					else
+					{
+						*writePos++ |= ((*readPos++) >> (8 - shiftNum));
+					}
+				}
+			}
+		}
+	}
+	return 0;
+}
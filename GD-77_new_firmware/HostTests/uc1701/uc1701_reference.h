@@ -0,0 +1,26 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef _UC1701_REFERENCE_H_
+#define _UC1701_REFERENCE_H_
+
+#include "UC1701.h"
+
+extern uint8_t ref_screenBuf[2048];
+
+int ref_UC1701_printCore(int x, int y, char *szMsg, int iSize, int alignment, bool isInverted);
+
+#endif /* _UC1701_REFERENCE_H_ */
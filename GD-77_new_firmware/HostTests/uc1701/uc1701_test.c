@@ -0,0 +1,143 @@
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+/*
+ * Checks the firmware's UC1701_printCore() byte-exact against the previous version, kept with the previous
+ * fonts in uc1701_reference.c. Every font is printed at every y position, aligned and unaligned to a page,
+ * normal and inverted over a random background: every character on its own at a few x positions, and runs
+ * of consecutive characters with each alignment. Only characters inside the font are printed, the previous
+ * version read outside the font data for others. The previous version wrote past the bottom of the screen,
+ * only the screen is compared, so this also checks that the firmware clips there.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// The code under test, built with the host stand-ins in ../include so that its static screen buffer can be compared
+#include "UC1701.c"
+
+#include "uc1701_reference.h"
+
+#define SCREEN_BYTES 1024
+
+static const int fontIds[] = { UC1701_FONT_6X8, UC1701_FONT_6X8_bold, UC1701_FONT_8X8, UC1701_FONT_GD77_8x16, UC1701_FONT_16x32 };
+static const char *fontNames[] = { "6x8", "6x8 bold", "8x8", "gd77 8x16", "16x32" };
+static const int xPositions[] = { 0, 1, 7, 37, 100, 120 };
+
+static uint32_t randomState = 0x55433137;
+static int prints = 0;
+
+static uint8_t random_byte()
+{
+	// xorshift32, the same sequence on every host
+	randomState ^= randomState << 13;
+	randomState ^= randomState >> 17;
+	randomState ^= randomState << 5;
+	return randomState >> 24;
+}
+
+static int check_print(int font, int x, int y, char *text, int alignment, bool isInverted)
+{
+	int result;
+	int refResult;
+
+	for (int i = 0; i < SCREEN_BYTES; i++)
+	{
+		screenBuf[i] = ref_screenBuf[i] = random_byte();
+	}
+	result = UC1701_printCore(x, y, text, fontIds[font], alignment, isInverted);
+	refResult = ref_UC1701_printCore(x, y, text, fontIds[font], alignment, isInverted);
+	prints++;
+
+	if ((result == refResult) && (memcmp(screenBuf, ref_screenBuf, SCREEN_BYTES) == 0))
+	{
+		return 0;
+	}
+	fprintf(stderr, "mismatch: font %s, x %d, y %d, alignment %d, %s, \"%s\"", fontNames[font], x, y, alignment, isInverted ? "inverted" : "normal", text);
+	if (result != refResult)
+	{
+		fprintf(stderr, ", returned %d instead of %d", result, refResult);
+	}
+	for (int i = 0; i < SCREEN_BYTES; i++)
+	{
+		if (screenBuf[i] != ref_screenBuf[i])
+		{
+			fprintf(stderr, ", first difference at page %d column %d", i >> 7, i & 0x7f);
+			break;
+		}
+	}
+	fprintf(stderr, "\n");
+	return 1;
+}
+
+static void font_range(int font, int *startCode, int *endCode)
+{
+	UC1701_selectFont(fontIds[font]);
+	*startCode = fontMetrics.startCode;
+	*endCode = fontMetrics.endCode;
+}
+
+int main()
+{
+	char text[32];
+	int failures = 0;
+	clock_t start = clock();
+
+	for (int font = 0; (font < sizeof(fontIds) / sizeof(fontIds[0])) && (failures < 10); font++)
+	{
+		int startCode, endCode;
+
+		font_range(font, &startCode, &endCode);
+		if (startCode == 0)
+		{
+			startCode = 1;// a string can't hold the 0 code
+		}
+		for (int y = 0; y < 64; y++)
+		{
+			for (int inverted = 0; inverted < 2; inverted++)
+			{
+				for (int code = startCode; code <= endCode; code++)
+				{
+					for (int xi = 0; xi < sizeof(xPositions) / sizeof(xPositions[0]); xi++)
+					{
+						text[0] = code;
+						text[1] = 0;
+						failures += check_print(font, xPositions[xi], y, text, 0, inverted);
+					}
+				}
+				for (int code = startCode; code <= endCode; code += 7)
+				{
+					int length = 0;
+
+					while ((length < 20) && (code + length <= endCode))
+					{
+						text[length] = code + length;
+						length++;
+					}
+					text[length] = 0;
+					for (int alignment = 0; alignment < 3; alignment++)
+					{
+						failures += check_print(font, 3, y, text, alignment, inverted);
+					}
+				}
+			}
+		}
+	}
+
+	printf("%d prints of %d fonts: %s (%.1f s)\n", prints, (int)(sizeof(fontIds) / sizeof(fontIds[0])), (failures == 0) ? "byte-exact" : "MISMATCH", (double)(clock() - start) / CLOCKS_PER_SEC);
+	return (failures == 0) ? 0 : 1;
+}
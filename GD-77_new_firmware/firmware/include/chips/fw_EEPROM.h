@@ -21,10 +21,23 @@
 
 #include "FreeRTOS.h"
 #include "task.h"
+#include "semphr.h"
 
 #include "fw_i2c.h"
 
+#define EEPROM_PAGE_SIZE			128
+
+extern volatile uint32_t eepromPageWrites;
+extern volatile uint32_t eepromCoalescedWrites;
+extern volatile uint32_t eepromAckPolls;
+extern volatile uint32_t eepromPageCyclesLast;
+extern volatile uint32_t eepromPageCyclesMax;
+extern volatile uint32_t eepromWriteErrors;
+
+void init_EEPROM_task();
 bool EEPROM_Read(int address,uint8_t *buf, int size);
 bool EEPROM_Write(int address,uint8_t *buf, int size);
+bool EEPROM_Flush();
+void EEPROM_resetStats();
 
 #endif /* _EEPROM_H_ */
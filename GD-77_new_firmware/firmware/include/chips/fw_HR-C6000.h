@@ -21,6 +21,7 @@
 
 #include "FreeRTOS.h"
 #include "task.h"
+#include "timers.h"
 
 #include "fw_keyboard.h"
 
@@ -57,16 +58,22 @@
 #define GPIO_INT_C6000_PWD   GPIOE
 #define Pin_INT_C6000_PWD    1
 
-extern volatile bool int_sys;
-extern volatile bool int_ts;
-extern volatile int int_timeout;
-
-extern int slot_state;
-extern int tick_cnt;
+extern volatile int slot_state;
 extern int skip_count;
 
 extern int tx_sequence;
 
+// IRQ to service latency of the C6000 interrupts, in core clock cycles
+extern volatile uint32_t hrc6000IrqCount;
+extern volatile uint32_t hrc6000LatencyLast;
+extern volatile uint32_t hrc6000LatencyMax;
+extern volatile uint64_t hrc6000LatencySum;
+// Core clock cycles spent in SPI_HR_C6000_init() and SPI_C6000_postinit() register writes
+extern volatile uint32_t hrc6000InitCycles;
+// Timeslot interrupts and the ones merged with a previous unserviced one (missed slots)
+extern volatile uint32_t hrc6000TsCount;
+extern volatile uint32_t hrc6000TsOverruns;
+
 enum DMR_SLOT_STATE { DMR_STATE_IDLE, DMR_STATE_RX_1, DMR_STATE_RX_2, DMR_STATE_RX_END,
 					  DMR_STATE_TX_START_1, DMR_STATE_TX_START_2, DMR_STATE_TX_START_3, DMR_STATE_TX_START_4, DMR_STATE_TX_START_5, DMR_STATE_TX_1, DMR_STATE_TX_2, DMR_STATE_TX_END_1, DMR_STATE_TX_END_2 };
 
@@ -80,7 +87,9 @@ void init_digital();
 void terminate_digital();
 void store_qsodata();
 void init_hrc6000_task();
+void wakeup_hrc6000_task();
+void reset_hrc6000_latency();
 void fw_hrc6000_task();
-void tick_HR_C6000();
+void tick_HR_C6000(uint32_t bits);
 
 #endif /* _FW_HR_C6000_H_ */
@@ -21,6 +21,7 @@
 
 #include "FreeRTOS.h"
 #include "task.h"
+#include "semphr.h"
 
 #include "fw_common.h"
 
@@ -40,6 +41,18 @@
 #define GPIO_SPI_FLASH_DO_U  	GPIOE
 #define Pin_SPI_FLASH_DO_U   	4
 
+// Read throughput in KB/s, see SPI_Flash_benchmark()
+typedef struct
+{
+	uint32_t legacySequential;
+	uint32_t sequential;
+	uint32_t legacyRandom;
+	uint32_t random;
+} spiFlashBenchmark_t;
+
+extern volatile uint32_t spiFlashCacheHits;
+extern volatile uint32_t spiFlashCacheMisses;
+
 // Public functions
 bool SPI_Flash_init();
 bool SPI_Flash_read(uint32_t addrress,uint8_t *buf,int size);
@@ -48,5 +61,7 @@ bool SPI_Flash_eraseSector(uint32_t address);// sector is 16 pages  = 4k bytes
 int SPI_Flash_readManufacturer();// Not necessarily Winbond !
 int SPI_Flash_readPartID();// Should be 4014 for 1M or 4017 for 8M
 int SPI_Flash_readStatusRegister();// May come in handy
+void SPI_Flash_resetCacheStats();
+void SPI_Flash_benchmark(spiFlashBenchmark_t *result);
 
 #endif /* _SPI_FLASH_H_ */
@@ -24,6 +24,7 @@
 
 #include "fw_sound.h"
 #include "fw_mbelib.h"
+#include "fw_codec_ber.h"
 
 #define QUAUX(X) #X
 #define QU(X) QUAUX(X)
@@ -35,7 +36,22 @@
 #define AMBE_ENCODE_BUFFER 0x1FFF6B60;
 #define AMBE_ENCODE_ECC_BUFFER 0x1FFF8244;
 
+// CPU cycles to reset the vocoder work areas, see codec_reset_benchmark()
+typedef struct
+{
+	uint32_t decoder;
+	uint32_t encoder;
+} codecResetBenchmark_t;
+
+extern volatile uint32_t codecResetCyclesLast;
+extern volatile uint32_t codecLateEntryCyclesLast;
+extern volatile uint32_t codecLateEntryCyclesMax;
+
 void init_codec();
+void init_codec_rx();
+void init_codec_tx();
+void codec_mark_late_entry(uint32_t irqTimestamp);
+void codec_reset_benchmark(codecResetBenchmark_t *result);
 void tick_codec_decode(uint8_t *indata_ptr);
 void tick_codec_encode(uint8_t *outdata_ptr);
 
@@ -0,0 +1,47 @@
+/*
+ * Copyright (C)2019 Kai Ludwig, DG4KLU
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#ifndef _FW_CODEC_BER_H_
+#define _FW_CODEC_BER_H_
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "fw_common.h"
+
+#define CODEC_BER_BITS_PER_FRAME 24 // data bits of the Golay codewords C0 and C1, mbe_golay2312() only counts data bit corrections
+#define CODEC_BER_HISTOGRAM_BINS 7  // frames by corrected bits, 0 to 6
+#define CODEC_BER_CALLS 4
+
+// Link quality of one received transmission, from the FEC corrections the decoder makes anyway
+typedef struct
+{
+	int id;
+	uint32_t frames;
+	uint32_t bitErrors;
+	uint32_t lostFrames;
+	uint16_t histogram[CODEC_BER_HISTOGRAM_BINS];
+} codecBerCall_t;
+
+void codec_ber_start_call(int id);
+void codec_ber_add_frame(int bitErrors);
+void codec_ber_add_lost(int frames);
+int codec_ber_link_quality(int *ber, int *frameLoss);
+bool codec_ber_get_call(int age, codecBerCall_t *call);
+
+#endif /* _FW_CODEC_BER_H_ */
@@ -22,11 +22,11 @@
 
 #include "fw_common.h"
 
-void mbe_checkGolayBlock (long int *block);
-int mbe_golay2312 (char *in, char *out);
-int mbe_eccAmbe3600x2450C0 (char ambe_fr[4][24]);
-int mbe_eccAmbe3600x2450Data (char ambe_fr[4][24], char *ambe_d);
-void mbe_demodulateAmbe3600x2450Data (char ambe_fr[4][24]);
-void prepare_framedata(uint8_t *indata, char *ambe_d, int *errs, int *errs2);
+int mbe_golay2312 (uint32_t *block);
+void mbe_deinterleaveAmbe3600x2450 (const uint8_t *indata, uint32_t ambe_fr[4]);
+int mbe_eccAmbe3600x2450C0 (uint32_t ambe_fr[4]);
+void mbe_demodulateAmbe3600x2450Data (uint32_t ambe_fr[4]);
+int mbe_eccAmbe3600x2450Data (uint32_t ambe_fr[4], short *ambe_d);
+void prepare_framedata(const uint8_t *indata, short *ambe_d, int *errs, int *errs2);
 
 #endif /* _FW_MBELIB_H_ */
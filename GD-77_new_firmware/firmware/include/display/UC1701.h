@@ -26,6 +26,7 @@
 
 #include "FreeRTOS.h"
 #include "task.h"
+#include "semphr.h"
 #include "fw_common.h"
 
 #define UC1701_FONT_6X8 				0
@@ -34,9 +35,31 @@
 #define UC1701_FONT_GD77_8x16 			3
 #define UC1701_FONT_16x32 				4
 
+#define UC1701_FONT_FORMAT_RAW			0// first header byte of a font
+#define UC1701_FONT_FORMAT_RLE			1
+
+#define UC1701_FRAME_INTERVAL_MS		40// at most 25 flushes per second
+
+extern volatile uint32_t uc1701FramesPosted;
+extern volatile uint32_t uc1701FramesSuperseded;
+extern volatile uint32_t uc1701FramesIdentical;
+extern volatile uint32_t uc1701Scrolls;
+extern volatile uint32_t uc1701PrintChars;
+extern volatile uint64_t uc1701PrintCycles;
+extern volatile uint32_t uc1701RenderCount;
+extern volatile uint32_t uc1701RenderPages;
+extern volatile uint32_t uc1701RenderBytes;
+extern volatile uint32_t uc1701RenderCyclesLast;
+extern volatile uint32_t uc1701RenderCyclesMax;
+extern volatile uint64_t uc1701RenderCyclesSum;
+
 void UC1701_begin(bool isInverted);
+void UC1701_initFlushTask();
 void UC1701_clearBuf();
+void UC1701_scrollPages(int pages);
 void UC1701_render();
+void UC1701_invalidate();
+void UC1701_resetRenderStats();
 void UC1701_printCentered(uint8_t y, char *text,int fontSize);
 void UC1701_printAt(uint8_t x, uint8_t y, char *text,int fontSize);
 int UC1701_printCore(int x, int y, char *szMsg, int iSize, int alignment, bool isInverted);
@@ -394,398 +394,124 @@ const uint8_t font_gd77_8x16[] = {
  * letters.
  * */
 const uint8_t font_16x32[] = {
-	0,0,
+	UC1701_FONT_FORMAT_RLE,0,
 	0x20,// first char code
 	0x7f,// last char code
 	16,// width of the character in pixels
 	32,// height of the character in pixels
 	4,// page height per character ??
 	64,// bytes per character (normally width * height /8)
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xfc,0xfc,0xff,0xff,0xff,0xff,0xfc,0xfc,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x3f,0x3f,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xc0,0xc0,0xc0,0xc0,0x00,0x00,0x00,0x00,0xc0,0xc0,0xc0,0xc0,0x00,0x00,
-	0x00,0x00,0x0f,0x0f,0x3f,0x3f,0x00,0x00,0x00,0x00,0x3f,0x3f,0x0f,0x0f,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xc0,0xc0,0xfc,0xfc,0xfc,0xfc,0xc0,0xc0,0xfc,0xfc,0xfc,0xfc,0xc0,0xc0,0x00,0x00,
-	0xc0,0xc0,0xff,0xff,0xff,0xff,0xc0,0xc0,0xff,0xff,0xff,0xff,0xc0,0xc0,0x00,0x00,
-	0x00,0x00,0x0f,0x0f,0x0f,0x0f,0x00,0x00,0x0f,0x0f,0x0f,0x0f,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0xf0,0xf0,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xfc,0xfc,0xff,0xff,0x03,0x03,0x03,0x03,0x03,0x03,0x0f,0x0f,0x3c,0x3c,0x00,0x00,
-	0xf0,0xf0,0xc3,0xc3,0x03,0x03,0x03,0x03,0x03,0x03,0xff,0xff,0xfc,0xfc,0x00,0x00,
-	0x00,0x00,0x03,0x03,0x03,0x03,0x3f,0x3f,0x3f,0x3f,0x03,0x03,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xf0,0xf0,0xf0,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0xc0,0xf0,0xf0,0x00,0x00,
-	0x00,0x00,0xc0,0xc0,0xf0,0xf0,0x3c,0x3c,0x0f,0x0f,0x03,0x03,0x00,0x00,0x00,0x00,
-	0x0f,0x0f,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x0f,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x3c,0x3c,0xff,0xff,0xc3,0xc3,0xff,0xff,0x3c,0x3c,0x00,0x00,0x00,0x00,
-	0xfc,0xfc,0xff,0xff,0x03,0x03,0x0f,0x0f,0xfc,0xfc,0xff,0xff,0x03,0x03,0x00,0x00,
-	0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x0c,0x0c,0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xc0,0xc0,0xc0,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x30,0x30,0x3f,0x3f,0x0f,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xf0,0xf0,0xfc,0xfc,0x0f,0x0f,0x03,0x03,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x03,0x03,0x0f,0x0f,0xfc,0xfc,0xf0,0xf0,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xc0,0xc0,0xc0,0xc0,0x00,0x00,0x00,0x00,0xc0,0xc0,0xc0,0xc0,0x00,0x00,
-	0x0c,0x0c,0xcc,0xcc,0xff,0xff,0x3f,0x3f,0x3f,0x3f,0xff,0xff,0xcc,0xcc,0x0c,0x0c,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0xc0,0xc0,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x0c,0x0c,0x0c,0x0c,0xff,0xff,0xff,0xff,0x0c,0x0c,0x0c,0x0c,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0xc0,0xc0,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x30,0x30,0x3f,0x3f,0x0f,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0xc0,0xf0,0xf0,0x00,0x00,
-	0x00,0x00,0xc0,0xc0,0xf0,0xf0,0x3c,0x3c,0x0f,0x0f,0x03,0x03,0x00,0x00,0x00,0x00,
-	0x0f,0x0f,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xfc,0xfc,0xff,0xff,0x03,0x03,0x03,0x03,0xc3,0xc3,0xff,0xff,0xfc,0xfc,0x00,0x00,
-	0xff,0xff,0xff,0xff,0x30,0x30,0x0f,0x0f,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x30,0x30,0x3c,0x3c,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x0c,0x0c,0x0c,0x0c,0x0f,0x0f,0x0f,0x0f,0x0c,0x0c,0x0c,0x0c,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x03,0x03,0xc3,0xc3,0xff,0xff,0x3c,0x3c,0x00,0x00,
-	0xc0,0xc0,0xf0,0xf0,0x3c,0x3c,0x0f,0x0f,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x0f,0x0f,0x0f,0x0f,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0f,0x0f,0x0f,0x0f,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x03,0x03,0x03,0x03,0xff,0xff,0xfc,0xfc,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x03,0x03,0x03,0xff,0xff,0xfc,0xfc,0x00,0x00,
-	0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xc0,0xc0,0xf0,0xf0,0x3c,0x3c,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,
-	0x0f,0x0f,0x0f,0x0f,0x0c,0x0c,0x0c,0x0c,0xff,0xff,0xff,0xff,0x0c,0x0c,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x0c,0x0f,0x0f,0x0f,0x0f,0x0c,0x0c,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xff,0xff,0xff,0xff,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x00,0x00,
-	0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x0f,0x0f,0xff,0xff,0xfc,0xfc,0x00,0x00,
-	0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xf0,0xf0,0xfc,0xfc,0x0f,0x0f,0x03,0x03,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xff,0xff,0xff,0xff,0x03,0x03,0x03,0x03,0x03,0x03,0xff,0xff,0xfc,0xfc,0x00,0x00,
-	0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x0f,0x0f,0x0f,0x0f,0x03,0x03,0x03,0x03,0x03,0x03,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xf0,0xf0,0xfc,0xfc,0x0f,0x0f,0x03,0x03,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xfc,0xfc,0xff,0xff,0x03,0x03,0x03,0x03,0x03,0x03,0xff,0xff,0xfc,0xfc,0x00,0x00,
-	0xfc,0xfc,0xff,0xff,0x03,0x03,0x03,0x03,0x03,0x03,0xff,0xff,0xfc,0xfc,0x00,0x00,
-	0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xfc,0xfc,0xff,0xff,0x03,0x03,0x03,0x03,0x03,0x03,0xff,0xff,0xfc,0xfc,0x00,0x00,
-	0x00,0x00,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0xf0,0xf0,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0xc0,0xc0,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0xf0,0xf0,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0xc0,0xc0,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0xc0,0xf0,0xf0,0x3c,0x3c,0x0c,0x0c,0x00,0x00,
-	0x00,0x00,0x0c,0x0c,0x3f,0x3f,0xf3,0xf3,0xc0,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0xc3,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x0c,0x0c,0x3c,0x3c,0xf0,0xf0,0xc0,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0xc0,0xf3,0xf3,0x3f,0x3f,0x0c,0x0c,0x00,0x00,
-	0x00,0x00,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x3c,0x3c,0x3f,0x3f,0x03,0x03,0x03,0x03,0xc3,0xc3,0xff,0xff,0x3c,0x3c,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x3f,0x3f,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xf0,0xf0,0xfc,0xfc,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0xfc,0xfc,0xf0,0xf0,0x00,0x00,
-	0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x3f,0x3f,0x00,0x00,
-	0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xc0,0xc0,0xf0,0xf0,0x3c,0x3c,0x0f,0x0f,0x3c,0x3c,0xf0,0xf0,0xc0,0xc0,0x00,0x00,
-	0xff,0xff,0xff,0xff,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x0f,0x0f,0x0f,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x0f,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x03,0x03,0xff,0xff,0xff,0xff,0x03,0x03,0x03,0x03,0xff,0xff,0xfc,0xfc,0x00,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x03,0x03,0x03,0x03,0xff,0xff,0xfc,0xfc,0x00,0x00,
-	0x0c,0x0c,0x0f,0x0f,0x0f,0x0f,0x0c,0x0c,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xf0,0xf0,0xfc,0xfc,0x0f,0x0f,0x03,0x03,0x03,0x03,0x0f,0x0f,0x3c,0x3c,0x00,0x00,
-	0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0xc0,0x00,0x00,
-	0x00,0x00,0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x03,0x03,0xff,0xff,0xff,0xff,0x03,0x03,0x0f,0x0f,0xfc,0xfc,0xf0,0xf0,0x00,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x0c,0x0c,0x0f,0x0f,0x0f,0x0f,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x03,0x03,0xff,0xff,0xff,0xff,0x03,0x03,0xc3,0xc3,0x0f,0x0f,0x3f,0x3f,0x00,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x03,0x03,0x0f,0x0f,0x00,0x00,0xc0,0xc0,0x00,0x00,
-	0x0c,0x0c,0x0f,0x0f,0x0f,0x0f,0x0c,0x0c,0x0c,0x0c,0x0f,0x0f,0x0f,0x0f,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x03,0x03,0xff,0xff,0xff,0xff,0x03,0x03,0xc3,0xc3,0x0f,0x0f,0x3f,0x3f,0x00,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x03,0x03,0x0f,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x0c,0x0c,0x0f,0x0f,0x0f,0x0f,0x0c,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xf0,0xf0,0xfc,0xfc,0x0f,0x0f,0x03,0x03,0x03,0x03,0x0f,0x0f,0x3c,0x3c,0x00,0x00,
-	0xff,0xff,0xff,0xff,0x00,0x00,0x0c,0x0c,0x0c,0x0c,0xfc,0xfc,0xfc,0xfc,0x00,0x00,
-	0x00,0x00,0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x0c,0x0c,0x03,0x03,0x0f,0x0f,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0xff,0xff,0xff,0xff,0x03,0x03,0x03,0x03,0x03,0x03,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x0f,0x0f,0x0f,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x0f,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x03,0x03,0xff,0xff,0xff,0xff,0x03,0x03,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x0c,0x0c,0x0f,0x0f,0x0f,0x0f,0x0c,0x0c,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0xff,0xff,0xff,0xff,0x03,0x03,0x00,0x00,
-	0xf0,0xf0,0xf0,0xf0,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,
-	0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x03,0x03,0xff,0xff,0xff,0xff,0x00,0x00,0xf0,0xf0,0xff,0xff,0x0f,0x0f,0x00,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x0f,0x0f,0x3f,0x3f,0xf0,0xf0,0xc0,0xc0,0x00,0x00,
-	0x0c,0x0c,0x0f,0x0f,0x0f,0x0f,0x00,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x0f,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x03,0x03,0xff,0xff,0xff,0xff,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0xc0,0x00,0x00,
-	0x0c,0x0c,0x0f,0x0f,0x0f,0x0f,0x0c,0x0c,0x0c,0x0c,0x0f,0x0f,0x0f,0x0f,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xff,0xff,0xff,0xff,0xfc,0xfc,0xf0,0xf0,0xfc,0xfc,0xff,0xff,0xff,0xff,0x00,0x00,
-	0xff,0xff,0xff,0xff,0x00,0x00,0x03,0x03,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x0f,0x0f,0x0f,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x0f,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xff,0xff,0xff,0xff,0xfc,0xfc,0xf0,0xf0,0xc0,0xc0,0xff,0xff,0xff,0xff,0x00,0x00,
-	0xff,0xff,0xff,0xff,0x00,0x00,0x03,0x03,0x0f,0x0f,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x0f,0x0f,0x0f,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x0f,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xf0,0xf0,0xfc,0xfc,0x0f,0x0f,0x03,0x03,0x0f,0x0f,0xfc,0xfc,0xf0,0xf0,0x00,0x00,
-	0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x03,0x03,0xff,0xff,0xff,0xff,0x03,0x03,0x03,0x03,0xff,0xff,0xfc,0xfc,0x00,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x03,0x03,0x03,0x03,0x03,0x03,0x00,0x00,0x00,0x00,
-	0x0c,0x0c,0x0f,0x0f,0x0f,0x0f,0x0c,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xfc,0xfc,0xff,0xff,0x03,0x03,0x03,0x03,0x03,0x03,0xff,0xff,0xfc,0xfc,0x00,0x00,
-	0xff,0xff,0xff,0xff,0x00,0x00,0xc0,0xc0,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x0f,0x0f,0xff,0xff,0xff,0xff,0xc3,0xc3,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x03,0x03,0xff,0xff,0xff,0xff,0x03,0x03,0x03,0x03,0xff,0xff,0xfc,0xfc,0x00,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x03,0x03,0x0f,0x0f,0xff,0xff,0xf0,0xf0,0x00,0x00,
-	0x0c,0x0c,0x0f,0x0f,0x0f,0x0f,0x00,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x0f,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x3c,0x3c,0xff,0xff,0xc3,0xc3,0x03,0x03,0x03,0x03,0x3f,0x3f,0x3c,0x3c,0x00,0x00,
-	0xc0,0xc0,0xc0,0xc0,0x03,0x03,0x03,0x03,0x0f,0x0f,0xfc,0xfc,0xf0,0xf0,0x00,0x00,
-	0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x3f,0x3f,0x0f,0x0f,0xff,0xff,0xff,0xff,0x0f,0x0f,0x3f,0x3f,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x0c,0x0c,0x0f,0x0f,0x0f,0x0f,0x0c,0x0c,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x3f,0x3f,0xff,0xff,0xc0,0xc0,0x00,0x00,0xc0,0xc0,0xff,0xff,0x3f,0x3f,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x03,0x03,0x0f,0x0f,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0xff,0xff,0xff,0xff,0xc0,0xc0,0xfc,0xfc,0xc0,0xc0,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x0f,0x0f,0x0f,0x0f,0x00,0x00,0x0f,0x0f,0x0f,0x0f,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x0f,0x0f,0xff,0xff,0xf0,0xf0,0x00,0x00,0xf0,0xf0,0xff,0xff,0x0f,0x0f,0x00,0x00,
-	0x00,0x00,0xf0,0xf0,0xff,0xff,0x0f,0x0f,0xff,0xff,0xf0,0xf0,0x00,0x00,0x00,0x00,
-	0x0f,0x0f,0x0f,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x0f,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x03,0x03,0xff,0xff,0xff,0xff,0x03,0x03,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x0c,0x0c,0x0f,0x0f,0x0f,0x0f,0x0c,0x0c,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x3f,0x3f,0x0f,0x0f,0x03,0x03,0x03,0x03,0xc3,0xc3,0xff,0xff,0x3f,0x3f,0x00,0x00,
-	0xc0,0xc0,0xf0,0xf0,0x3c,0x3c,0x0f,0x0f,0x03,0x03,0x00,0x00,0xc0,0xc0,0x00,0x00,
-	0x0f,0x0f,0x0f,0x0f,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0f,0x0f,0x0f,0x0f,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x03,0x03,0x03,0x03,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x0f,0x0c,0x0c,0x0c,0x0c,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xfc,0xfc,0xf0,0xf0,0xc0,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x03,0x03,0x0f,0x0f,0x3f,0x3f,0xfc,0xfc,0xf0,0xf0,0xc0,0xc0,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x0f,0x0f,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x03,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x0c,0x0c,0x0c,0x0c,0x0f,0x0f,0x0f,0x0f,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xc0,0xc0,0xf0,0xf0,0xc0,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x00,0x00,0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,
-	0x00,0x00,0x00,0x00,0xf0,0xf0,0xf0,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xf0,0xf0,0xfc,0xfc,0x0c,0x0c,0x0c,0x0c,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,
-	0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x0c,0x0c,0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x03,0x03,0xff,0xff,0xff,0xff,0xc0,0xc0,0xc0,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x03,0x03,0xff,0xff,0xfc,0xfc,0x00,0x00,
-	0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x0c,0x0c,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x00,0x00,0x00,0x00,
-	0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x03,0x00,0x00,
-	0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xc0,0xc0,0xc3,0xc3,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,
-	0xfc,0xfc,0xff,0xff,0x03,0x03,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,
-	0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x0c,0x0c,0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x00,0x00,0x00,0x00,
-	0xff,0xff,0xff,0xff,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0f,0x0f,0x0f,0x0f,0x00,0x00,
-	0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xfc,0xfc,0xff,0xff,0x03,0x03,0x0f,0x0f,0x3c,0x3c,0x00,0x00,0x00,0x00,
-	0x03,0x03,0xff,0xff,0xff,0xff,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x0c,0x0c,0x0f,0x0f,0x0f,0x0f,0x0c,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x00,0x00,0xc0,0xc0,0xc0,0xc0,0x00,0x00,
-	0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,
-	0xc3,0xc3,0xcf,0xcf,0x0c,0x0c,0x0c,0x0c,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x03,0x03,0xff,0xff,0xff,0xff,0x00,0x00,0xc0,0xc0,0xc0,0xc0,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x03,0x03,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x0c,0x0c,0x0f,0x0f,0x0f,0x0f,0x00,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x0f,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xc0,0xc0,0xcf,0xcf,0xcf,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x0c,0x0c,0x0f,0x0f,0x0f,0x0f,0x0c,0x0c,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0xc0,0xcf,0xcf,0xcf,0xcf,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0x00,0xf0,0xf0,0xf0,0xf0,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x00,0x00,0x00,0x00,
-	0x03,0x03,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xc0,0xc0,0xc0,0xc0,0x00,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x3c,0x3c,0xff,0xff,0xc3,0xc3,0x00,0x00,0x00,0x00,
-	0x0c,0x0c,0x0f,0x0f,0x0f,0x0f,0x00,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x0f,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x03,0x03,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x0c,0x0c,0x0f,0x0f,0x0f,0x0f,0x0c,0x0c,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x00,0x00,0xc0,0xc0,0xc0,0xc0,0x00,0x00,0x00,0x00,
-	0xff,0xff,0xff,0xff,0x03,0x03,0xff,0xff,0x03,0x03,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x0f,0x0f,0x0f,0x0f,0x00,0x00,0x0f,0x0f,0x00,0x00,0x0f,0x0f,0x0f,0x0f,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xc0,0xc0,0xc0,0xc0,0x00,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x0f,0x0f,0x0f,0x0f,0x00,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x0f,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x00,0x00,0x00,0x00,
-	0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xc0,0xc0,0xc0,0xc0,0x00,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x0c,0x0c,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x00,0x00,
-	0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x00,0x00,0xc0,0xc0,0xc0,0xc0,0x00,0x00,
-	0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,
-	0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x0c,0x0c,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x00,0x00,
-	0xc0,0xc0,0xc0,0xc0,0x00,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x03,0x03,0x00,0x00,0x03,0x03,0x0f,0x0f,0x00,0x00,
-	0x0c,0x0c,0x0f,0x0f,0x0f,0x0f,0x0c,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x00,0x00,0x00,0x00,
-	0x03,0x03,0x0f,0x0f,0x3c,0x3c,0x30,0x30,0xf0,0xf0,0xc3,0xc3,0x03,0x03,0x00,0x00,
-	0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xc0,0xc0,0xc0,0xc0,0xfc,0xfc,0xff,0xff,0xc0,0xc0,0xc0,0xc0,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xc0,0xc0,0xc0,0xc0,0x00,0x00,0x00,0x00,0xc0,0xc0,0xc0,0xc0,0x00,0x00,0x00,0x00,
-	0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,
-	0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x0c,0x0c,0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xc0,0xc0,0xc0,0xc0,0x00,0x00,0x00,0x00,0xc0,0xc0,0xc0,0xc0,0x00,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x03,0x03,0x0f,0x0f,0x0f,0x0f,0x03,0x03,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xc0,0xc0,0xc0,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0xc0,0xc0,0xc0,0x00,0x00,
-	0xff,0xff,0xff,0xff,0x00,0x00,0xf0,0xf0,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x03,0x03,0x0f,0x0f,0x0f,0x0f,0x03,0x03,0x0f,0x0f,0x0f,0x0f,0x03,0x03,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xc0,0xc0,0xc0,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0xc0,0xc0,0xc0,0x00,0x00,
-	0x00,0x00,0x03,0x03,0xff,0xff,0xfc,0xfc,0xff,0xff,0x03,0x03,0x00,0x00,0x00,0x00,
-	0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x00,0x00,0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xc0,0xc0,0xc0,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0xc0,0xc0,0xc0,0x00,0x00,
-	0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x0c,0x0c,0xcc,0xcc,0xff,0xff,0x3f,0x3f,0x00,0x00,
-	0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0xc0,0x00,0x00,
-	0x03,0x03,0xc3,0xc3,0xf0,0xf0,0x3c,0x3c,0x0f,0x0f,0x03,0x03,0x00,0x00,0x00,0x00,
-	0x0f,0x0f,0x0f,0x0f,0x0c,0x0c,0x0c,0x0c,0x0c,0x0c,0x0f,0x0f,0x0f,0x0f,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0xfc,0xff,0xff,0x03,0x03,0x03,0x03,0x00,0x00,
-	0x00,0x00,0x03,0x03,0x03,0x03,0xff,0xff,0xfc,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x0c,0x0c,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0xfc,0xfc,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x0f,0x0f,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x03,0x03,0x03,0x03,0xff,0xff,0xfc,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0xfc,0xff,0xff,0x03,0x03,0x03,0x03,0x00,0x00,
-	0x00,0x00,0x0c,0x0c,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xc0,0xc0,0xf0,0xf0,0xc0,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,
-	0xfc,0xfc,0xff,0xff,0x03,0x03,0x00,0x00,0x03,0x03,0xff,0xff,0xfc,0xfc,0x00,0x00,
-	0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x03,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00};
+	// offset of each character's data from the end of this table, little endian
+	0x00,0x00,0x02,0x00,0x16,0x00,0x2f,0x00,0x57,0x00,0x81,0x00,0xa7,0x00,0xd6,0x00,
+	0xe5,0x00,0xff,0x00,0x19,0x01,0x35,0x01,0x43,0x01,0x52,0x01,0x58,0x01,0x5e,0x01,
+	0x7b,0x01,0xa8,0x01,0xc0,0x01,0xe7,0x01,0x0d,0x02,0x2f,0x02,0x50,0x02,0x75,0x02,
+	0x8e,0x02,0xb8,0x02,0xd7,0x02,0xe5,0x02,0xf8,0x02,0x19,0x03,0x1f,0x03,0x40,0x03,
+	0x5a,0x03,0x7e,0x03,0xa3,0x03,0xcb,0x03,0xf4,0x03,0x1c,0x04,0x46,0x04,0x6b,0x04,
+	0x96,0x04,0xb3,0x04,0xcd,0x04,0xef,0x04,0x19,0x05,0x39,0x05,0x60,0x05,0x87,0x05,
+	0xaf,0x05,0xcf,0x05,0xfc,0x05,0x24,0x06,0x50,0x06,0x6e,0x06,0x8f,0x06,0xb3,0x06,
+	0xd4,0x06,0xfd,0x06,0x1b,0x07,0x46,0x07,0x58,0x07,0x79,0x07,0x8b,0x07,0xa7,0x07,
+	0xab,0x07,0xb5,0x07,0xd6,0x07,0xfd,0x07,0x19,0x08,0x41,0x08,0x5d,0x08,0x80,0x08,
+	0x9f,0x08,0xc9,0x08,0xe0,0x08,0xf6,0x08,0x1e,0x09,0x35,0x09,0x5c,0x09,0x78,0x09,
+	0x94,0x09,0xb2,0x09,0xd3,0x09,0xf9,0x09,0x1d,0x0a,0x3b,0x0a,0x5d,0x0a,0x79,0x0a,
+	0xa0,0x0a,0xc8,0x0a,0xeb,0x0a,0x0b,0x0b,0x29,0x0b,0x37,0x0b,0x54,0x0b,0x67,0x0b,
+	0x88,0x0b,
+	// RLE compressed character data
+	0xbf,0x00,
+	0x93,0x00,0x01,0xfc,0xfc,0x83,0xff,0x01,0xfc,0xfc,0x89,0x00,0x83,0x3f,0x8b,0x00,0x83,0x0f,0x85,0x00,
+	0x01,0x00,0x00,0x83,0xc0,0x83,0x00,0x83,0xc0,0x83,0x00,0x03,0x0f,0x0f,0x3f,0x3f,0x83,0x00,0x03,0x3f,0x3f,0x0f,0x0f,0xa1,0x00,
+	0x8f,0x00,0x01,0xc0,0xc0,0x83,0xfc,0x01,0xc0,0xc0,0x83,0xfc,0x05,0xc0,0xc0,0x00,0x00,0xc0,0xc0,0x83,0xff,0x01,0xc0,0xc0,0x83,0xff,0x01,0xc0,0xc0,0x83,0x00,0x83,0x0f,0x01,0x00,0x00,0x83,0x0f,0x83,0x00,
+	0x85,0x00,0x83,0xf0,0x85,0x00,0x03,0xfc,0xfc,0xff,0xff,0x85,0x03,0x09,0x0f,0x0f,0x3c,0x3c,0x00,0x00,0xf0,0xf0,0xc3,0xc3,0x85,0x03,0x03,0xff,0xff,0xfc,0xfc,0x83,0x00,0x83,0x03,0x83,0x3f,0x01,0x03,0x03,0x83,0x00,
+	0x8f,0x00,0x83,0xf0,0x85,0x00,0x03,0xc0,0xc0,0xf0,0xf0,0x83,0x00,0x09,0xc0,0xc0,0xf0,0xf0,0x3c,0x3c,0x0f,0x0f,0x03,0x03,0x83,0x00,0x03,0x0f,0x0f,0x03,0x03,0x85,0x00,0x83,0x0f,0x01,0x00,0x00,
+	0x91,0x00,0x09,0x3c,0x3c,0xff,0xff,0xc3,0xc3,0xff,0xff,0x3c,0x3c,0x83,0x00,0x13,0xfc,0xfc,0xff,0xff,0x03,0x03,0x0f,0x0f,0xfc,0xfc,0xff,0xff,0x03,0x03,0x00,0x00,0x03,0x03,0x0f,0x0f,0x83,0x0c,0x07,0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x00,0x00,
+	0x83,0x00,0x83,0xc0,0x89,0x00,0x05,0x30,0x30,0x3f,0x3f,0x0f,0x0f,0xa7,0x00,
+	0x93,0x00,0x07,0xf0,0xf0,0xfc,0xfc,0x0f,0x0f,0x03,0x03,0x87,0x00,0x83,0xff,0x8d,0x00,0x05,0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x83,0x00,
+	0x93,0x00,0x07,0x03,0x03,0x0f,0x0f,0xfc,0xfc,0xf0,0xf0,0x8b,0x00,0x83,0xff,0x87,0x00,0x05,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x85,0x00,
+	0x91,0x00,0x83,0xc0,0x83,0x00,0x83,0xc0,0x07,0x00,0x00,0x0c,0x0c,0xcc,0xcc,0xff,0xff,0x83,0x3f,0x05,0xff,0xff,0xcc,0xcc,0x0c,0x0c,0x8f,0x00,
+	0x95,0x00,0x83,0xc0,0x87,0x00,0x83,0x0c,0x83,0xff,0x83,0x0c,0x91,0x00,
+	0xa5,0x00,0x83,0xc0,0x89,0x00,0x05,0x30,0x30,0x3f,0x3f,0x0f,0x0f,0x85,0x00,
+	0x9f,0x00,0x8d,0x0c,0x91,0x00,
+	0xb5,0x00,0x83,0x0f,0x85,0x00,
+	0x99,0x00,0x03,0xc0,0xc0,0xf0,0xf0,0x83,0x00,0x09,0xc0,0xc0,0xf0,0xf0,0x3c,0x3c,0x0f,0x0f,0x03,0x03,0x83,0x00,0x03,0x0f,0x0f,0x03,0x03,0x8b,0x00,
+	0x8f,0x00,0x03,0xfc,0xfc,0xff,0xff,0x83,0x03,0x07,0xc3,0xc3,0xff,0xff,0xfc,0xfc,0x00,0x00,0x83,0xff,0x05,0x30,0x30,0x0f,0x0f,0x00,0x00,0x83,0xff,0x05,0x00,0x00,0x03,0x03,0x0f,0x0f,0x85,0x0c,0x05,0x0f,0x0f,0x03,0x03,0x00,0x00,
+	0x91,0x00,0x03,0x30,0x30,0x3c,0x3c,0x83,0xff,0x8b,0x00,0x83,0xff,0x87,0x00,0x83,0x0c,0x83,0x0f,0x83,0x0c,0x01,0x00,0x00,
+	0x8f,0x00,0x03,0x0c,0x0c,0x0f,0x0f,0x83,0x03,0x11,0xc3,0xc3,0xff,0xff,0x3c,0x3c,0x00,0x00,0xc0,0xc0,0xf0,0xf0,0x3c,0x3c,0x0f,0x0f,0x03,0x03,0x85,0x00,0x83,0x0f,0x85,0x0c,0x83,0x0f,0x01,0x00,0x00,
+	0x8f,0x00,0x03,0x0c,0x0c,0x0f,0x0f,0x85,0x03,0x03,0xff,0xff,0xfc,0xfc,0x85,0x00,0x85,0x03,0x09,0xff,0xff,0xfc,0xfc,0x00,0x00,0x03,0x03,0x0f,0x0f,0x85,0x0c,0x05,0x0f,0x0f,0x03,0x03,0x00,0x00,
+	0x91,0x00,0x05,0xc0,0xc0,0xf0,0xf0,0x3c,0x3c,0x83,0xff,0x83,0x00,0x83,0x0f,0x83,0x0c,0x83,0xff,0x01,0x0c,0x0c,0x87,0x00,0x01,0x0c,0x0c,0x83,0x0f,0x03,0x0c,0x0c,0x00,0x00,
+	0x8f,0x00,0x83,0xff,0x89,0x03,0x01,0x00,0x00,0x87,0x03,0x0b,0x0f,0x0f,0xff,0xff,0xfc,0xfc,0x00,0x00,0x03,0x03,0x0f,0x0f,0x85,0x0c,0x05,0x0f,0x0f,0x03,0x03,0x00,0x00,
+	0x8f,0x00,0x05,0xf0,0xf0,0xfc,0xfc,0x0f,0x0f,0x83,0x03,0x85,0x00,0x83,0xff,0x85,0x03,0x09,0xff,0xff,0xfc,0xfc,0x00,0x00,0x03,0x03,0x0f,0x0f,0x85,0x0c,0x05,0x0f,0x0f,0x03,0x03,0x00,0x00,
+	0x8f,0x00,0x83,0x0f,0x85,0x03,0x83,0xff,0x85,0x00,0x07,0xf0,0xf0,0xfc,0xfc,0x0f,0x0f,0x03,0x03,0x87,0x00,0x83,0x0f,0x87,0x00,
+	0x8f,0x00,0x03,0xfc,0xfc,0xff,0xff,0x85,0x03,0x09,0xff,0xff,0xfc,0xfc,0x00,0x00,0xfc,0xfc,0xff,0xff,0x85,0x03,0x09,0xff,0xff,0xfc,0xfc,0x00,0x00,0x03,0x03,0x0f,0x0f,0x85,0x0c,0x05,0x0f,0x0f,0x03,0x03,0x00,0x00,
+	0x8f,0x00,0x03,0xfc,0xfc,0xff,0xff,0x85,0x03,0x03,0xff,0xff,0xfc,0xfc,0x83,0x00,0x87,0x03,0x83,0xff,0x83,0x00,0x85,0x0c,0x03,0x0f,0x0f,0x03,0x03,0x83,0x00,
+	0x95,0x00,0x83,0xf0,0x8b,0x00,0x83,0xc0,0x8b,0x00,0x83,0x03,0x85,0x00,
+	0x95,0x00,0x83,0xf0,0x8b,0x00,0x83,0xc0,0x89,0x00,0x05,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x85,0x00,
+	0x95,0x00,0x07,0xc0,0xc0,0xf0,0xf0,0x3c,0x3c,0x0c,0x0c,0x83,0x00,0x07,0x0c,0x0c,0x3f,0x3f,0xf3,0xf3,0xc0,0xc0,0x8d,0x00,0x07,0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x00,0x00,
+	0x9f,0x00,0x8d,0xc3,0x91,0x00,
+	0x91,0x00,0x07,0x0c,0x0c,0x3c,0x3c,0xf0,0xf0,0xc0,0xc0,0x8b,0x00,0x07,0xc0,0xc0,0xf3,0xf3,0x3f,0x3f,0x0c,0x0c,0x83,0x00,0x05,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x87,0x00,
+	0x8f,0x00,0x03,0x3c,0x3c,0x3f,0x3f,0x83,0x03,0x05,0xc3,0xc3,0xff,0xff,0x3c,0x3c,0x87,0x00,0x83,0x3f,0x8b,0x00,0x83,0x0f,0x85,0x00,
+	0x8f,0x00,0x03,0xf0,0xf0,0xfc,0xfc,0x85,0x0c,0x05,0xfc,0xfc,0xf0,0xf0,0x00,0x00,0x83,0xff,0x01,0x00,0x00,0x85,0xff,0x07,0x3f,0x3f,0x00,0x00,0x03,0x03,0x0f,0x0f,0x87,0x0c,0x83,0x00,
+	0x8f,0x00,0x0f,0xc0,0xc0,0xf0,0xf0,0x3c,0x3c,0x0f,0x0f,0x3c,0x3c,0xf0,0xf0,0xc0,0xc0,0x00,0x00,0x83,0xff,0x85,0x0c,0x83,0xff,0x01,0x00,0x00,0x83,0x0f,0x85,0x00,0x83,0x0f,0x01,0x00,0x00,
+	0x8f,0x00,0x01,0x03,0x03,0x83,0xff,0x83,0x03,0x03,0xff,0xff,0xfc,0xfc,0x83,0x00,0x83,0xff,0x83,0x03,0x07,0xff,0xff,0xfc,0xfc,0x00,0x00,0x0c,0x0c,0x83,0x0f,0x83,0x0c,0x05,0x0f,0x0f,0x03,0x03,0x00,0x00,
+	0x8f,0x00,0x05,0xf0,0xf0,0xfc,0xfc,0x0f,0x0f,0x83,0x03,0x05,0x0f,0x0f,0x3c,0x3c,0x00,0x00,0x83,0xff,0x87,0x00,0x01,0xc0,0xc0,0x83,0x00,0x03,0x03,0x03,0x0f,0x0f,0x83,0x0c,0x05,0x0f,0x0f,0x03,0x03,0x00,0x00,
+	0x8f,0x00,0x01,0x03,0x03,0x83,0xff,0x07,0x03,0x03,0x0f,0x0f,0xfc,0xfc,0xf0,0xf0,0x83,0x00,0x83,0xff,0x83,0x00,0x83,0xff,0x03,0x00,0x00,0x0c,0x0c,0x83,0x0f,0x05,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x83,0x00,
+	0x8f,0x00,0x01,0x03,0x03,0x83,0xff,0x07,0x03,0x03,0xc3,0xc3,0x0f,0x0f,0x3f,0x3f,0x83,0x00,0x83,0xff,0x0b,0x03,0x03,0x0f,0x0f,0x00,0x00,0xc0,0xc0,0x00,0x00,0x0c,0x0c,0x83,0x0f,0x83,0x0c,0x83,0x0f,0x01,0x00,0x00,
+	0x8f,0x00,0x01,0x03,0x03,0x83,0xff,0x07,0x03,0x03,0xc3,0xc3,0x0f,0x0f,0x3f,0x3f,0x83,0x00,0x83,0xff,0x03,0x03,0x03,0x0f,0x0f,0x85,0x00,0x01,0x0c,0x0c,0x83,0x0f,0x01,0x0c,0x0c,0x87,0x00,
+	0x8f,0x00,0x05,0xf0,0xf0,0xfc,0xfc,0x0f,0x0f,0x83,0x03,0x05,0x0f,0x0f,0x3c,0x3c,0x00,0x00,0x83,0xff,0x01,0x00,0x00,0x83,0x0c,0x83,0xfc,0x83,0x00,0x03,0x03,0x03,0x0f,0x0f,0x83,0x0c,0x05,0x03,0x03,0x0f,0x0f,0x00,0x00,
+	0x8f,0x00,0x83,0xff,0x85,0x00,0x83,0xff,0x01,0x00,0x00,0x83,0xff,0x85,0x03,0x83,0xff,0x01,0x00,0x00,0x83,0x0f,0x85,0x00,0x83,0x0f,0x01,0x00,0x00,
+	0x93,0x00,0x01,0x03,0x03,0x83,0xff,0x01,0x03,0x03,0x89,0x00,0x83,0xff,0x89,0x00,0x01,0x0c,0x0c,0x83,0x0f,0x01,0x0c,0x0c,0x83,0x00,
+	0x95,0x00,0x01,0x03,0x03,0x83,0xff,0x03,0x03,0x03,0x00,0x00,0x83,0xf0,0x83,0x00,0x83,0xff,0x83,0x00,0x03,0x03,0x03,0x0f,0x0f,0x83,0x0c,0x03,0x0f,0x0f,0x03,0x03,0x83,0x00,
+	0x8f,0x00,0x01,0x03,0x03,0x83,0xff,0x07,0x00,0x00,0xf0,0xf0,0xff,0xff,0x0f,0x0f,0x83,0x00,0x83,0xff,0x0b,0x0f,0x0f,0x3f,0x3f,0xf0,0xf0,0xc0,0xc0,0x00,0x00,0x0c,0x0c,0x83,0x0f,0x83,0x00,0x83,0x0f,0x01,0x00,0x00,
+	0x8f,0x00,0x01,0x03,0x03,0x83,0xff,0x01,0x03,0x03,0x89,0x00,0x83,0xff,0x85,0x00,0x05,0xc0,0xc0,0x00,0x00,0x0c,0x0c,0x83,0x0f,0x83,0x0c,0x83,0x0f,0x01,0x00,0x00,
+	0x8f,0x00,0x83,0xff,0x05,0xfc,0xfc,0xf0,0xf0,0xfc,0xfc,0x83,0xff,0x01,0x00,0x00,0x83,0xff,0x05,0x00,0x00,0x03,0x03,0x00,0x00,0x83,0xff,0x01,0x00,0x00,0x83,0x0f,0x85,0x00,0x83,0x0f,0x01,0x00,0x00,
+	0x8f,0x00,0x83,0xff,0x05,0xfc,0xfc,0xf0,0xf0,0xc0,0xc0,0x83,0xff,0x01,0x00,0x00,0x83,0xff,0x05,0x00,0x00,0x03,0x03,0x0f,0x0f,0x83,0xff,0x01,0x00,0x00,0x83,0x0f,0x85,0x00,0x83,0x0f,0x01,0x00,0x00,
+	0x8f,0x00,0x0f,0xf0,0xf0,0xfc,0xfc,0x0f,0x0f,0x03,0x03,0x0f,0x0f,0xfc,0xfc,0xf0,0xf0,0x00,0x00,0x83,0xff,0x85,0x00,0x83,0xff,0x83,0x00,0x09,0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x83,0x00,
+	0x8f,0x00,0x01,0x03,0x03,0x83,0xff,0x83,0x03,0x03,0xff,0xff,0xfc,0xfc,0x83,0x00,0x83,0xff,0x85,0x03,0x83,0x00,0x01,0x0c,0x0c,0x83,0x0f,0x01,0x0c,0x0c,0x87,0x00,
+	0x8f,0x00,0x03,0xfc,0xfc,0xff,0xff,0x85,0x03,0x05,0xff,0xff,0xfc,0xfc,0x00,0x00,0x83,0xff,0x05,0x00,0x00,0xc0,0xc0,0x00,0x00,0x83,0xff,0x09,0x00,0x00,0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x0f,0x0f,0x83,0xff,0x03,0xc3,0xc3,0x00,0x00,
+	0x8f,0x00,0x01,0x03,0x03,0x83,0xff,0x83,0x03,0x03,0xff,0xff,0xfc,0xfc,0x83,0x00,0x83,0xff,0x0b,0x03,0x03,0x0f,0x0f,0xff,0xff,0xf0,0xf0,0x00,0x00,0x0c,0x0c,0x83,0x0f,0x83,0x00,0x83,0x0f,0x01,0x00,0x00,
+	0x8f,0x00,0x05,0x3c,0x3c,0xff,0xff,0xc3,0xc3,0x83,0x03,0x05,0x3f,0x3f,0x3c,0x3c,0x00,0x00,0x83,0xc0,0x83,0x03,0x0b,0x0f,0x0f,0xfc,0xfc,0xf0,0xf0,0x00,0x00,0x03,0x03,0x0f,0x0f,0x85,0x0c,0x05,0x0f,0x0f,0x03,0x03,0x00,0x00,
+	0x91,0x00,0x03,0x3f,0x3f,0x0f,0x0f,0x83,0xff,0x03,0x0f,0x0f,0x3f,0x3f,0x87,0x00,0x83,0xff,0x89,0x00,0x01,0x0c,0x0c,0x83,0x0f,0x01,0x0c,0x0c,0x83,0x00,
+	0x8f,0x00,0x83,0xff,0x85,0x00,0x83,0xff,0x01,0x00,0x00,0x83,0xff,0x85,0x00,0x83,0xff,0x05,0x00,0x00,0x03,0x03,0x0f,0x0f,0x85,0x0c,0x05,0x0f,0x0f,0x03,0x03,0x00,0x00,
+	0x8f,0x00,0x83,0xff,0x85,0x00,0x83,0xff,0x0f,0x00,0x00,0x3f,0x3f,0xff,0xff,0xc0,0xc0,0x00,0x00,0xc0,0xc0,0xff,0xff,0x3f,0x3f,0x85,0x00,0x05,0x03,0x03,0x0f,0x0f,0x03,0x03,0x85,0x00,
+	0x8f,0x00,0x83,0xff,0x85,0x00,0x83,0xff,0x01,0x00,0x00,0x83,0xff,0x05,0xc0,0xc0,0xfc,0xfc,0xc0,0xc0,0x83,0xff,0x83,0x00,0x83,0x0f,0x01,0x00,0x00,0x83,0x0f,0x83,0x00,
+	0x8f,0x00,0x0d,0x0f,0x0f,0xff,0xff,0xf0,0xf0,0x00,0x00,0xf0,0xf0,0xff,0xff,0x0f,0x0f,0x83,0x00,0x09,0xf0,0xf0,0xff,0xff,0x0f,0x0f,0xff,0xff,0xf0,0xf0,0x83,0x00,0x83,0x0f,0x85,0x00,0x83,0x0f,0x01,0x00,0x00,
+	0x91,0x00,0x83,0xff,0x83,0x00,0x83,0xff,0x85,0x00,0x01,0x03,0x03,0x83,0xff,0x01,0x03,0x03,0x87,0x00,0x01,0x0c,0x0c,0x83,0x0f,0x01,0x0c,0x0c,0x83,0x00,
+	0x8f,0x00,0x03,0x3f,0x3f,0x0f,0x0f,0x83,0x03,0x17,0xc3,0xc3,0xff,0xff,0x3f,0x3f,0x00,0x00,0xc0,0xc0,0xf0,0xf0,0x3c,0x3c,0x0f,0x0f,0x03,0x03,0x00,0x00,0xc0,0xc0,0x00,0x00,0x83,0x0f,0x85,0x0c,0x83,0x0f,0x01,0x00,0x00,
+	0x93,0x00,0x83,0xff,0x83,0x03,0x87,0x00,0x83,0xff,0x8b,0x00,0x83,0x0f,0x83,0x0c,0x83,0x00,
+	0x8f,0x00,0x05,0xfc,0xfc,0xf0,0xf0,0xc0,0xc0,0x8b,0x00,0x0b,0x03,0x03,0x0f,0x0f,0x3f,0x3f,0xfc,0xfc,0xf0,0xf0,0xc0,0xc0,0x8b,0x00,0x05,0x03,0x03,0x0f,0x0f,0x00,0x00,
+	0x93,0x00,0x83,0x03,0x83,0xff,0x8b,0x00,0x83,0xff,0x87,0x00,0x83,0x0c,0x83,0x0f,0x83,0x00,
+	0x83,0x00,0x05,0xc0,0xc0,0xf0,0xf0,0xc0,0xc0,0x85,0x00,0x0d,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x00,0x00,0x03,0x03,0x0f,0x0f,0x0c,0x0c,0xa1,0x00,
+	0xaf,0x00,0x8f,0xc0,
+	0x83,0x00,0x83,0xf0,0x8d,0x00,0x83,0x03,0xa5,0x00,
+	0x91,0x00,0x87,0xc0,0x85,0x00,0x03,0xf0,0xf0,0xfc,0xfc,0x83,0x0c,0x83,0xff,0x83,0x00,0x03,0x03,0x03,0x0f,0x0f,0x83,0x0c,0x07,0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x00,0x00,
+	0x8f,0x00,0x01,0x03,0x03,0x83,0xff,0x83,0xc0,0x87,0x00,0x83,0xff,0x0f,0x00,0x00,0x03,0x03,0xff,0xff,0xfc,0xfc,0x00,0x00,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x83,0x0c,0x05,0x0f,0x0f,0x03,0x03,0x00,0x00,
+	0x91,0x00,0x89,0xc0,0x83,0x00,0x83,0xff,0x85,0x00,0x83,0x03,0x05,0x00,0x00,0x03,0x03,0x0f,0x0f,0x85,0x0c,0x05,0x0f,0x0f,0x03,0x03,0x00,0x00,
+	0x93,0x00,0x03,0xc0,0xc0,0xc3,0xc3,0x83,0xff,0x83,0x00,0x07,0xfc,0xfc,0xff,0xff,0x03,0x03,0x00,0x00,0x83,0xff,0x83,0x00,0x03,0x03,0x03,0x0f,0x0f,0x83,0x0c,0x07,0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x00,0x00,
+	0x91,0x00,0x89,0xc0,0x83,0x00,0x83,0xff,0x85,0x0c,0x83,0x0f,0x05,0x00,0x00,0x03,0x03,0x0f,0x0f,0x85,0x0c,0x05,0x0f,0x0f,0x03,0x03,0x00,0x00,
+	0x91,0x00,0x09,0xfc,0xfc,0xff,0xff,0x03,0x03,0x0f,0x0f,0x3c,0x3c,0x83,0x00,0x01,0x03,0x03,0x83,0xff,0x01,0x03,0x03,0x87,0x00,0x01,0x0c,0x0c,0x83,0x0f,0x01,0x0c,0x0c,0x87,0x00,
+	0x91,0x00,0x85,0xc0,0x01,0x00,0x00,0x83,0xc0,0x01,0x00,0x00,0x83,0xff,0x83,0x00,0x83,0xff,0x83,0x00,0x03,0xc3,0xc3,0xcf,0xcf,0x83,0x0c,0x83,0xff,0x83,0x00,
+	0x01,0x00,0x00,0x87,0x03,0x85,0x00,0x01,0x03,0x03,0x83,0xff,0x01,0x00,0x00,0x83,0xc0,0x85,0x00,0x83,0xff,0x03,0x03,0x03,0x00,0x00,0x83,0xff,0x03,0x00,0x00,0x0c,0x0c,0x83,0x0f,0x83,0x00,0x83,0x0f,0x01,0x00,0x00,
+	0x93,0x00,0x01,0xc0,0xc0,0x83,0xcf,0x8b,0x00,0x83,0xff,0x89,0x00,0x01,0x0c,0x0c,0x83,0x0f,0x01,0x0c,0x0c,0x83,0x00,
+	0x97,0x00,0x01,0xc0,0xc0,0x83,0xcf,0x8b,0x00,0x83,0xff,0x83,0x00,0x83,0xf0,0x83,0x00,0x83,0xff,0x01,0x00,0x00,
+	0x83,0x00,0x87,0x03,0x83,0x00,0x01,0x03,0x03,0x83,0xff,0x83,0x00,0x83,0xc0,0x83,0x00,0x83,0xff,0x05,0x3c,0x3c,0xff,0xff,0xc3,0xc3,0x83,0x00,0x01,0x0c,0x0c,0x83,0x0f,0x83,0x00,0x83,0x0f,0x01,0x00,0x00,
+	0x93,0x00,0x01,0x03,0x03,0x83,0xff,0x8b,0x00,0x83,0xff,0x89,0x00,0x01,0x0c,0x0c,0x83,0x0f,0x01,0x0c,0x0c,0x83,0x00,
+	0x8f,0x00,0x85,0xc0,0x01,0x00,0x00,0x83,0xc0,0x83,0x00,0x83,0xff,0x05,0x03,0x03,0xff,0xff,0x03,0x03,0x83,0xff,0x01,0x00,0x00,0x83,0x0f,0x05,0x00,0x00,0x0f,0x0f,0x00,0x00,0x83,0x0f,0x01,0x00,0x00,
+	0x8f,0x00,0x83,0xc0,0x01,0x00,0x00,0x85,0xc0,0x85,0x00,0x83,0xff,0x83,0x00,0x83,0xff,0x83,0x00,0x83,0x0f,0x83,0x00,0x83,0x0f,0x01,0x00,0x00,
+	0x91,0x00,0x89,0xc0,0x83,0x00,0x83,0xff,0x85,0x00,0x83,0xff,0x05,0x00,0x00,0x03,0x03,0x0f,0x0f,0x85,0x0c,0x05,0x0f,0x0f,0x03,0x03,0x00,0x00,
+	0x8f,0x00,0x83,0xc0,0x01,0x00,0x00,0x85,0xc0,0x85,0x00,0x83,0xff,0x83,0x00,0x83,0xff,0x83,0x00,0x83,0xff,0x83,0x0c,0x05,0x0f,0x0f,0x03,0x03,0x00,0x00,
+	0x87,0x03,0x89,0x00,0x85,0xc0,0x01,0x00,0x00,0x83,0xc0,0x01,0x00,0x00,0x83,0xff,0x83,0x00,0x83,0xff,0x83,0x00,0x03,0x03,0x03,0x0f,0x0f,0x83,0x0c,0x83,0xff,0x83,0x00,
+	0x85,0x00,0x87,0x03,0x01,0x00,0x00,0x83,0xc0,0x01,0x00,0x00,0x85,0xc0,0x85,0x00,0x83,0xff,0x0b,0x03,0x03,0x00,0x00,0x03,0x03,0x0f,0x0f,0x00,0x00,0x0c,0x0c,0x83,0x0f,0x01,0x0c,0x0c,0x87,0x00,
+	0x91,0x00,0x89,0xc0,0x83,0x00,0x13,0x03,0x03,0x0f,0x0f,0x3c,0x3c,0x30,0x30,0xf0,0xf0,0xc3,0xc3,0x03,0x03,0x00,0x00,0x03,0x03,0x0f,0x0f,0x85,0x0c,0x05,0x0f,0x0f,0x03,0x03,0x00,0x00,
+	0x8f,0x00,0x83,0xc0,0x03,0xfc,0xfc,0xff,0xff,0x83,0xc0,0x87,0x00,0x83,0xff,0x8b,0x00,0x0b,0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x00,0x00,
+	0x8f,0x00,0x83,0xc0,0x83,0x00,0x83,0xc0,0x83,0x00,0x83,0xff,0x83,0x00,0x83,0xff,0x83,0x00,0x03,0x03,0x03,0x0f,0x0f,0x83,0x0c,0x07,0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x00,0x00,
+	0x91,0x00,0x83,0xc0,0x83,0x00,0x83,0xc0,0x83,0x00,0x83,0xff,0x83,0x00,0x83,0xff,0x85,0x00,0x01,0x03,0x03,0x83,0x0f,0x01,0x03,0x03,0x83,0x00,
+	0x8f,0x00,0x83,0xc0,0x85,0x00,0x83,0xc0,0x01,0x00,0x00,0x83,0xff,0x05,0x00,0x00,0xf0,0xf0,0x00,0x00,0x83,0xff,0x03,0x00,0x00,0x03,0x03,0x83,0x0f,0x01,0x03,0x03,0x83,0x0f,0x03,0x03,0x03,0x00,0x00,
+	0x8f,0x00,0x83,0xc0,0x85,0x00,0x83,0xc0,0x83,0x00,0x09,0x03,0x03,0xff,0xff,0xfc,0xfc,0xff,0xff,0x03,0x03,0x83,0x00,0x0f,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x00,0x00,0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x00,0x00,
+	0x8f,0x00,0x83,0xc0,0x85,0x00,0x83,0xc0,0x01,0x00,0x00,0x83,0xff,0x85,0x00,0x83,0xff,0x05,0x00,0x00,0x03,0x03,0x0f,0x0f,0x83,0x0c,0x07,0xcc,0xcc,0xff,0xff,0x3f,0x3f,0x00,0x00,
+	0x89,0x03,0x85,0x00,0x8d,0xc0,0x0d,0x00,0x00,0x03,0x03,0xc3,0xc3,0xf0,0xf0,0x3c,0x3c,0x0f,0x0f,0x03,0x03,0x83,0x00,0x83,0x0f,0x85,0x0c,0x83,0x0f,0x01,0x00,0x00,
+	0x95,0x00,0x03,0xfc,0xfc,0xff,0xff,0x83,0x03,0x83,0x00,0x83,0x03,0x03,0xff,0xff,0xfc,0xfc,0x8b,0x00,0x03,0x03,0x03,0x0f,0x0f,0x83,0x0c,0x01,0x00,0x00,
+	0x95,0x00,0x83,0xff,0x8b,0x00,0x83,0xfc,0x8b,0x00,0x83,0x0f,0x85,0x00,
+	0x91,0x00,0x83,0x03,0x03,0xff,0xff,0xfc,0xfc,0x8b,0x00,0x03,0xfc,0xfc,0xff,0xff,0x83,0x03,0x83,0x00,0x83,0x0c,0x03,0x0f,0x0f,0x03,0x03,0x85,0x00,
+	0x8f,0x00,0x0d,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0x0f,0x0f,0x0c,0x0c,0x0f,0x0f,0x03,0x03,0xa1,0x00,
+	0x93,0x00,0x05,0xc0,0xc0,0xf0,0xf0,0xc0,0xc0,0x85,0x00,0x0f,0xfc,0xfc,0xff,0xff,0x03,0x03,0x00,0x00,0x03,0x03,0xff,0xff,0xfc,0xfc,0x00,0x00,0x8d,0x03,0x01,0x00,0x00};
 
 /*
 // This AtariST style font, supplied by Jason VK7ZJA probably can't be used
@@ -22,15 +22,50 @@
 #include "fw_common.h"
 #include "fw_SPI_Flash.h"
 
+#define CALIBRATION_BAND_OFFSET_UHF 0x00000000
+#define CALIBRATION_BAND_OFFSET_VHF 0x00000070
+#define CALIBRATION_FREQ_STEPS      8
+
+// Values of one band, parsed from the calibration area of the flash by calibrationInit().
+// The frequency dependent values are indexed by the frequency step within the band (freq_offset).
 typedef struct calibrationStruct
 {
 	int masterOscillator;
 	uint8_t powerLevels[16];
+
+	uint8_t DACDATA_shift;
+	uint8_t twopoint_mod_0x47;
+	uint8_t twopoint_mod_0x48;
+	uint8_t Q_MOD2_offset;
+	uint8_t phase_reduce[CALIBRATION_FREQ_STEPS];
+
+	uint8_t pga_gain;
+	uint8_t voice_gain_tx;
+	uint8_t gain_tx;
+	uint8_t padrv_ibit;
+
+	uint16_t xmitter_dev_wideband;
+	uint16_t xmitter_dev_narrowband;
+
+	uint8_t dac_vgain_analog;
+	uint8_t volume_analog;
+
+	uint16_t noise1_th_wideband;
+	uint16_t noise2_th_wideband;
+	uint16_t rssi3_th_wideband;
+	uint16_t noise1_th_narrowband;
+	uint16_t noise2_th_narrowband;
+	uint16_t rssi3_th_narrowband;
+
+	uint16_t squelch_th[CALIBRATION_FREQ_STEPS];
 } calibrationStruct_t;
 
 extern calibrationStruct_t calibrationVHF;
 extern calibrationStruct_t calibrationUHF;
 
+#define EXT_CALIBRATION_BASE   0x0008F000
+#define EXT_CALIBRATION_LENGTH 0xE0 // both bands, up to the last VHF value
+
 #define EXT_DACDATA_shift 0x0008F05D
 #define EXT_twopoint_mod  0x0008F008
 #define EXT_Q_MOD2_offset 0x0008F00A
@@ -56,29 +91,7 @@ extern calibrationStruct_t calibrationUHF;
 
 #define EXT_squelch_th 0x0008F03f
 
-void read_val_DACDATA_shift(int offset, uint8_t* val_shift);
-void read_val_twopoint_mod(int offset, uint8_t* val_0x47, uint8_t* val_0x48);
-void read_val_Q_MOD2_offset(int offset, uint8_t* val_0x04);
-void read_val_phase_reduce(int offset, uint8_t* val_0x46);
-
-void read_val_pga_gain(int offset, uint8_t* value);
-void read_val_voice_gain_tx(int offset, uint8_t* value);
-void read_val_gain_tx(int offset, uint8_t* value);
-void read_val_padrv_ibit(int offset, uint8_t* value);
-
-void read_val_xmitter_dev_wideband(int offset, uint16_t* value);
-void read_val_xmitter_dev_narrowband(int offset, uint16_t* value);
-
-void read_val_dac_vgain_analog(int offset, uint8_t* value);
-void read_val_volume_analog(int offset, uint8_t* value);
-
-void read_val_noise1_th_wideband(int offset, uint16_t* value);
-void read_val_noise2_th_wideband(int offset, uint16_t* value);
-void read_val_rssi3_th_wideband(int offset, uint16_t* value);
-void read_val_noise1_th_narrowband(int offset, uint16_t* value);
-void read_val_noise2_th_narrowband(int offset, uint16_t* value);
-void read_val_rssi3_th_narrowband(int offset, uint16_t* value);
-
-void read_val_squelch_th(int offset, uint16_t* value);
+bool calibrationInit();
+calibrationStruct_t *calibrationGetBand(int band_offset);
 
 #endif
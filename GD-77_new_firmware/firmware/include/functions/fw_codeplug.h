@@ -21,6 +21,17 @@
 
 extern const int CODEPLUG_ZONE_DATA_SIZE;
 
+// Sizes of the RAM index built at boot, codeplug records outside it are read from storage as before
+#define CODEPLUG_ZONE_INDEX_MAX_COUNT		250
+#define CODEPLUG_RX_GROUP_INDEX_MAX_COUNT	76
+#define CODEPLUG_CONTACTS_INDEX_MAX_COUNT	1024
+#define CODEPLUG_CHANNEL_CACHE_SIZE			32// a power of 2, at least the channels in a zone
+
+extern volatile uint32_t codeplugIndexBuildCycles;
+extern volatile uint32_t codeplugIndexUpdates;
+extern volatile uint32_t codeplugChannelHits;
+extern volatile uint32_t codeplugChannelMisses;
+
 typedef struct struct_codeplugZone
 {
 	char name[16];
@@ -98,5 +109,8 @@ int codeplugGetUserDMRID();
 void codeplugGetRadioName(char *buf);
 void codeplugGetBootItemTexts(char *line1, char *line2);
 void codeplugVFO_A_ChannelData(struct_codeplugChannel_t *vfoBuf);
+void codeplugIndexInit();
+void codeplugIndexUpdateEEPROM(int address, int length);
+void codeplugIndexUpdateFlash(int address, int length);
 
 #endif
@@ -43,6 +43,9 @@ typedef struct settingsStruct
 	struct_codeplugChannel_t vfoChannel;
 	uint32_t		overrideTG;
 	uint8_t			useCalibration;
+	uint8_t			rxAudioStartFrames;// DMR jitter buffer target in 10 ms frames, 0 = default
+	uint8_t			squelchHangTime;// analog squelch hang time in 10 ms units, 0 = default
+	uint8_t			squelchHysteresis;// analog squelch hysteresis in noise level units, 0 = default
 } settingsStruct_t;
 
 extern settingsStruct_t nonVolatileSettings;
@@ -52,5 +55,7 @@ extern struct_codeplugChannel_t channelScreenChannelData;
 void settingsSaveSettings();
 void settingsLoadSettings();
 void settingsRestoreDefaultSettings();
+void settingsApplyAudioSettings();
+void settingsApplySquelchSettings();
 
 #endif
@@ -31,21 +31,24 @@
 #include "fw_pit.h"
 #include "fw_wdog.h"
 
-extern const uint8_t sine_beep[];
-extern volatile int sine_beep_freq;
+// One note of a melody, a list ends with a zero duration
+typedef struct
+{
+	uint16_t freq;// Hz, 0 for a rest
+	uint16_t freq2;// second tone mixed in for DTMF and two-tone alerts, 0 for none
+	uint16_t duration;// ms
+} melodyNote_t;
+
 extern volatile int sine_beep_duration;
 
-extern int melody_generic[512];
-extern const int melody_poweron[];
-extern const int melody_key_beep[];
-extern const int melody_sk1_beep[];
-extern const int melody_sk2_beep[];
-extern const int melody_orange_beep[];
-extern const int melody_ACK_beep[];
-extern const int melody_NACK_beep[];
-extern const int melody_ERROR_beep[];
-extern volatile int *melody_play;
-extern volatile int melody_idx;
+extern const melodyNote_t melody_poweron[];
+extern const melodyNote_t melody_key_beep[];
+extern const melodyNote_t melody_sk1_beep[];
+extern const melodyNote_t melody_sk2_beep[];
+extern const melodyNote_t melody_orange_beep[];
+extern const melodyNote_t melody_ACK_beep[];
+extern const melodyNote_t melody_NACK_beep[];
+extern const melodyNote_t melody_ERROR_beep[];
 
 extern const uint8_t melody1[];
 extern const uint8_t melody2[];
@@ -53,18 +56,36 @@ extern const uint8_t melody3[];
 extern const uint8_t melody4[];
 
 #define WAV_BUFFER_SIZE 0xa0
-#define WAV_BUFFER_COUNT 16
+#define WAV_BUFFER_COUNT 16 // must be a power of two, the ring indices are masked
+
+// RX jitter buffer minimum target in 10 ms frames. 2 starts playback after the first AMBE subframe,
+// 6 waits for the whole burst. A whole burst has to fit on top of the target.
+#define SOUND_RX_START_FRAMES_DEFAULT 2
+#define SOUND_RX_START_FRAMES_MAX (WAV_BUFFER_COUNT - 6)
+
+extern uint8_t wavbuffer[WAV_BUFFER_COUNT][WAV_BUFFER_SIZE];
+extern volatile uint32_t wavbuffer_read_idx;
+extern volatile uint32_t wavbuffer_write_idx;
 
-extern volatile uint8_t wavbuffer[WAV_BUFFER_COUNT][WAV_BUFFER_SIZE];
-extern int wavbuffer_read_idx;
-extern int wavbuffer_write_idx;
-extern volatile int wavbuffer_count;
-extern uint8_t tmp_wavbuffer[WAV_BUFFER_SIZE];
+extern volatile uint32_t wavbufferOverruns;
+extern volatile uint32_t wavbufferUnderruns;
+extern volatile uint32_t wavbufferHighWater;
+
+extern volatile uint32_t rxAudioLatencyCount;
+extern volatile uint32_t rxAudioLatencyLast;
+extern volatile uint32_t rxAudioLatencyMax;
+extern volatile uint64_t rxAudioLatencySum;
+
+extern volatile uint32_t rxJitterCycles;
+extern volatile uint32_t rxAudioBursts;
+extern volatile uint32_t rxAudioLateBursts;
+extern volatile uint32_t rxAudioConcealedFrames;
+extern volatile uint32_t rxAudioDroppedFrames;
+extern volatile uint32_t rxAudioDepthMin;
+extern volatile uint32_t rxAudioDepthMax;
 
 extern uint8_t spi_sound1[WAV_BUFFER_SIZE*2];
 extern uint8_t spi_sound2[WAV_BUFFER_SIZE*2];
-extern uint8_t spi_sound3[WAV_BUFFER_SIZE*2];
-extern uint8_t spi_sound4[WAV_BUFFER_SIZE*2];
 
 extern volatile bool g_TX_SAI_in_use;
 extern volatile bool g_RX_SAI_in_use;
@@ -72,16 +93,39 @@ extern volatile bool g_RX_SAI_in_use;
 extern uint8_t *spi_soundBuf;
 extern sai_transfer_t xfer;
 
+// CPU cycles per 60 ms superframe, see soundPipelineBenchmark()
+typedef struct
+{
+	uint32_t legacyRx;
+	uint32_t rx;
+	uint32_t legacyTx;
+	uint32_t tx;
+} soundPipelineBenchmark_t;
+
 void init_sound();
 void terminate_sound();
-void set_melody(const int *melody);
+void set_melody(const melodyNote_t *melody);
+void set_song(const uint8_t *song);
+void set_dtmf_tone(char key, int duration);
+bool melody_is_playing();
 int get_freq(int tone);
-void create_song(const uint8_t *melody);
 void fw_init_beep_task();
 void send_sound_data();
 void receive_sound_data();
-void store_soundbuffer();
-void retrieve_soundbuffer();
+int get_wavbuffer_count();
+void reset_wavbuffer_stats();
+void set_rx_audio_start_frames(int frames);
+int get_rx_audio_start_frames();
+void mark_rx_audio_start(uint32_t irqTimestamp);
+void update_rx_audio_latency();
+void reset_rx_audio_latency();
+void rx_audio_burst_arrived(uint32_t irqTimestamp);
+void reset_rx_jitter_stats();
+uint8_t *get_soundbuffer_write_frame();
+void commit_soundbuffer_write();
+uint8_t *get_soundbuffer_read_frame();
+void commit_soundbuffer_read();
+void soundPipelineBenchmark(soundPipelineBenchmark_t *result);
 void tick_RXsoundbuffer();
 void tick_TXsoundbuffer();
 void tick_melody();
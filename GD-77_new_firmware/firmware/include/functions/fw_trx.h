@@ -34,17 +34,67 @@ enum DMR_ADMIT_CRITERIA { ADMIT_CRITERIA_ALWAYS,ADMIT_CRITERIA_CHANNEL_FREE,ADMI
 extern bool open_squelch;
 extern bool HR_C6000_datalogging;
 
-extern bool trxIsTransmitting;
+extern volatile bool trxIsTransmitting;
 extern uint32_t trxTalkGroup;
 extern uint32_t trxDMRID;
-extern int trx_measure_count;
 extern int txstopdelay;
 
-void trx_check_analog_squelch();
+// Analog squelch on the polled noise level, in register 0x1b units and ms
+#define TRX_SQUELCH_HYSTERESIS_DEFAULT  3
+#define TRX_SQUELCH_HYSTERESIS_MAX      20
+#define TRX_SQUELCH_HANG_MS_DEFAULT     100
+#define TRX_SQUELCH_HANG_MS_MAX         2000
+
+extern volatile uint32_t trxSquelchReads;// I2C reads made for the squelch and CTCSS decisions
+
+// Retune benchmark, CPU cycles spent in trxSetFrequency()
+extern volatile uint32_t trxRetuneCount;
+extern volatile uint32_t trxRetuneCyclesLast;
+extern volatile uint32_t trxRetuneCyclesMax;
+// Channel switch benchmark, CPU cycles from the key press to RX being ready on the new channel
+extern volatile uint32_t trxChannelSwitchCount;
+extern volatile uint32_t trxChannelSwitchCyclesLast;
+extern volatile uint32_t trxChannelSwitchCyclesMax;
+
+enum TRX_TUNING_AT1846_REG { TRX_TUNING_FREQ_HIGH, TRX_TUNING_FREQ_LOW, TRX_TUNING_PGA_GAIN, TRX_TUNING_VOICE_GAIN_TX, TRX_TUNING_GAIN_TX,
+							TRX_TUNING_XMITTER_DEV, TRX_TUNING_DAC_VGAIN, TRX_TUNING_VOLUME, TRX_TUNING_NOISE1_TH, TRX_TUNING_NOISE2_TH,
+							TRX_TUNING_RSSI3_TH, TRX_TUNING_PADRV_IBIT, TRX_TUNING_SQUELCH_TH, TRX_TUNING_TX_CTCSS_FREQ, TRX_TUNING_TX_CTCSS_ENABLE,
+							TRX_TUNING_RX_CTCSS_FREQ, TRX_TUNING_RX_CTCSS_THRESHOLD, TRX_TUNING_RX_CTCSS_SELECT, TRX_TUNING_AT1846_REGS };
+#define TRX_TUNING_C6000_REGS 6
+
+typedef struct
+{
+	uint8_t reg;
+	uint16_t keepMask;
+} trxTuningReg_t;
+
+// Register image of a channel, computed by trxTuningPlanCompute() and written by trxApplyTuningPlan()
+typedef struct
+{
+	int frequency;
+	int mode;
+	bool bandWidthIs25kHz;
+	int colourCode;
+	int txTone;
+	int rxTone;
+	uint32_t at1846Used;
+	uint16_t at1846Values[TRX_TUNING_AT1846_REGS];
+	uint8_t c6000Used;
+	uint8_t c6000Values[TRX_TUNING_C6000_REGS];
+} trxTuningPlan_t;
+
+bool trx_check_analog_squelch();// true while the speaker is open
+void trxSetSquelchHangTime(int hangTimeMs);
+void trxSetSquelchHysteresis(int hysteresis);
+void trxResetSquelchStats();
 int	trxGetMode();
 int	trxGetFrequency();
 void trxSetMode(int mode);
 void trxSetFrequency(int frequency);
+void trxResetRetuneStats();
+void trxChannelSwitchDone(uint32_t startCycles);
+void trxTuningPlanCompute(trxTuningPlan_t *plan, int frequency, int mode, bool bandWidthIs25kHz, int colourCode, int txTone, int rxTone);
+void trxApplyTuningPlan(const trxTuningPlan_t *plan);
 void trx_setRX();
 void trx_setTX();
 void trx_deactivateTX();
@@ -52,8 +102,7 @@ void trx_activateTX();
 void trxSetPower(uint32_t powerVal);
 uint16_t trxGetPower();
 void trxSetBandWidth(bool bandWidthis25kHz);
-void trxUpdateC6000Calibration();
-void trxUpdateAT1846SCalibration();
+void I2C_AT1846_set_register_with_mask(uint8_t reg, uint16_t mask, uint16_t value, uint8_t shift);
 void trxSetDMRColourCode(int colourCode);
 int trxGetDMRColourCode();
 bool trxCheckFrequencyIsVHF(int frequency);
@@ -49,6 +49,7 @@
 #include "fw_sound.h"
 #include "fw_trx.h"
 #include "fw_SPI_Flash.h"
+#include "fw_calibration.h"
 #include "fw_EEPROM.h"
 
 extern int Display_light_Timer;
@@ -21,17 +21,24 @@
 
 #include "FreeRTOS.h"
 #include "task.h"
+#include "semphr.h"
 
 #include "fsl_i2c.h"
 
 #include "fw_common.h"
 
-#define I2C_BAUDRATE (100000) /* 100K */
+#define I2C_BAUDRATE (400000) /* 400K, both the AT24C512 and the AT1846S support fast mode */
 #define I2C_MASTER_SLAVE_ADDR_7BIT (0x71U)
 
 #define I2C_DATA_LENGTH (32)  /* MAX is 256 */
 extern uint8_t i2c_master_buff[I2C_DATA_LENGTH];
 
+extern volatile uint32_t i2cTransfers;
+extern volatile uint32_t i2cBusCycles;
+extern volatile uint32_t i2cShadowWriteHits;
+extern volatile uint32_t i2cShadowReadHits;
+extern volatile TickType_t i2cStatsStartTick;
+
 // I2C0a to AT24C512 EEPROM & AT1846S
 // OUT/ON E24 - I2C SCL to AT24C512 EEPROM & AT1846S
 // OUT/ON E25 - I2C SDA to AT24C512 EEPROM & AT1846S
@@ -56,8 +63,23 @@ void init_I2C0a();
 void init_I2C0b();
 void setup_I2C0();
 
+// How lock_I2C() got the bus. unlock_I2C() goes by this instead of looking at the context again.
+typedef enum
+{
+	I2C_LOCK_BUSY = 0,// polling only, but another task holds the bus, nothing may be sent
+	I2C_LOCK_POLLED,// before the scheduler runs or with interrupts masked, transfers are polled
+	I2C_LOCK_MUTEX
+} i2cLock_t;
+
+i2cLock_t lock_I2C();
+void unlock_I2C(i2cLock_t lock);
+int transfer_I2C(i2c_master_transfer_t *xfer);
+void invalidate_I2C_shadow_AT1846();
+void reset_I2C_stats();
+
 void clear_I2C_buffer();
 int write_I2C_reg_2byte(uint8_t addr, uint8_t reg, uint8_t val1, uint8_t val2);
+int write_I2C_reg_2byte_list(uint8_t addr, const uint8_t settings[][3], int numSettings);
 int read_I2C_reg_2byte(uint8_t addr, uint8_t reg, uint8_t* val1, uint8_t* val2);
 int set_clear_I2C_reg_2byte_with_mask(uint8_t reg, uint8_t mask1, uint8_t mask2, uint8_t val1, uint8_t val2);
 
@@ -24,13 +24,14 @@
 
 #include "fsl_pit.h"
 
-extern volatile uint32_t timer_maintask;
-extern volatile uint32_t timer_beeptask;
-extern volatile uint32_t timer_hrc6000task;
-extern volatile uint32_t timer_watchdogtask;
-extern volatile uint32_t PITCounter;
+// Tickless idle statistics, the number of wakeups from sleep and the time spent sleeping since sleepStatsStartTick
+extern volatile uint32_t sleepCount;
+extern volatile uint64_t sleepTimeUs;
+extern volatile TickType_t sleepStatsStartTick;
 
 void init_pit();
-void PIT0_IRQHandler(void);
+void reset_sleep_stats();
+void pit_pre_sleep();
+void pit_post_sleep();
 
 #endif /* _FW_PIT_H_ */
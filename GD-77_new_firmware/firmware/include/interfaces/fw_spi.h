@@ -21,6 +21,7 @@
 
 #include "FreeRTOS.h"
 #include "task.h"
+#include "semphr.h"
 
 #include "fsl_dspi.h"
 
@@ -70,22 +71,57 @@ extern uint8_t SPI_masterSendBuffer_SPI1[SPI_DATA_LENGTH];
 #define GPIO_SPI_DO_C6000_U  GPIOD
 #define Pin_SPI_DO_C6000_U   3
 
+// Register script entry, see write_SPI_page_reg_script_SPI0()
+typedef struct
+{
+	uint8_t page;
+	uint8_t reg;
+	uint8_t val;
+	uint8_t flags;
+} spi_reg_write_t;
+
+#define SPI_REG_STROBE  0x01 // command register, never skipped and ends duplicate detection
+
+#define SPI_REG_SCRIPT_LENGTH(script) ((int)(sizeof(script)/sizeof(spi_reg_write_t)))
+
+// Register script statistics, entries executed, SPI transfers they needed and whether a page 4 burst
+// did not read back, see write_SPI_page_reg_script_SPI0()
+extern volatile uint32_t spiScriptEntries;
+extern volatile uint32_t spiScriptTransfers;
+extern volatile uint32_t spiScriptBurstMismatches;
+
+// SPI transactions started per bus and page 4 accesses of SPI0 answered by the register shadow since spiStatsStartTick
+extern volatile uint32_t spiTransactions_SPI0;
+extern volatile uint32_t spiTransactions_SPI1;
+extern volatile uint32_t spiShadowHits_SPI0;
+extern volatile TickType_t spiStatsStartTick;
+
 void init_SPI();
 void setup_SPI0();
 void setup_SPI1();
+void reset_SPI_stats();
 
 void clear_SPI_buffer_SPI0();
 int write_SPI_page_reg_byte_SPI0(uint8_t page, uint8_t reg, uint8_t val);
 int read_SPI_page_reg_byte_SPI0(uint8_t page, uint8_t reg, uint8_t* val);
 int set_clear_SPI_page_reg_byte_with_mask_SPI0(uint8_t page, uint8_t reg, uint8_t mask, uint8_t val);
-int write_SPI_page_reg_bytearray_SPI0(uint8_t page, uint8_t reg, uint8_t* values, uint8_t length);
+int write_SPI_page_reg_bytearray_SPI0(uint8_t page, uint8_t reg, const uint8_t* values, uint8_t length);
+int write_SPI_page_reg_bytearray_SPI0_start(uint8_t page, uint8_t reg, const uint8_t* values, uint8_t length);
+int SPI_wait_SPI0();
 int read_SPI_page_reg_bytearray_SPI0(uint8_t page, uint8_t reg, uint8_t* values, uint8_t length);
+int write_SPI_page_reg_script_SPI0(const spi_reg_write_t *script, int count);
+void set_SPI_shadow_uncached_SPI0(uint8_t reg, bool uncached);
+void invalidate_SPI_shadow_SPI0(uint8_t reg);
+void invalidate_all_SPI_shadow_SPI0();
+int resync_SPI_shadow_SPI0(uint8_t reg, uint8_t* val);
 
 void clear_SPI_buffer_SPI1();
 int write_SPI_page_reg_byte_SPI1(uint8_t page, uint8_t reg, uint8_t val);
 int read_SPI_page_reg_byte_SPI1(uint8_t page, uint8_t reg, uint8_t* val);
 int set_clear_SPI_page_reg_byte_with_mask_SPI1(uint8_t page, uint8_t reg, uint8_t mask, uint8_t val);
-int write_SPI_page_reg_bytearray_SPI1(uint8_t page, uint8_t reg, uint8_t* values, uint8_t length);
+int write_SPI_page_reg_bytearray_SPI1(uint8_t page, uint8_t reg, const uint8_t* values, uint8_t length);
+int write_SPI_page_reg_bytearray_SPI1_start(uint8_t page, uint8_t reg, const uint8_t* values, uint8_t length);
+int SPI_wait_SPI1();
 int read_SPI_page_reg_bytearray_SPI1(uint8_t page, uint8_t reg, uint8_t* values, uint8_t length);
 
 #endif /* _FW_SPI_H_ */
@@ -21,6 +21,7 @@
 
 #include "fsl_wdog.h"
 
+#include "fw_common.h"
 #include "fw_adc.h"
 
 extern volatile bool alive_maintask;
@@ -67,6 +67,13 @@ extern gpio_pin_config_t pin_config_output;
 #define GPIO_VHF_TX_amp_power GPIOE
 #define Pin_VHF_TX_amp_power  3
 
+// Task priorities, radio timing first and housekeeping last
+#define TASK_PRIORITY_RADIO         5U  // HR-C6000 TDMA slot handling
+#define TASK_PRIORITY_AUDIO         4U  // beeps and melodies
+#define TASK_PRIORITY_USB           3U  // USB CDC requests
+#define TASK_PRIORITY_UI            2U  // keys, menus and display
+#define TASK_PRIORITY_HOUSEKEEPING  1U  // watchdog, battery, EEPROM writes and display flush
+
 void fw_init_common();
 
 #endif /* _FW_COMMON_H_ */
@@ -46,6 +46,7 @@
 void fw_init_display();
 
 void fw_displayEnableBacklight(bool onof);
+bool fw_displayIsBacklightLit();
 
 #ifdef DISPLAY_LED_PWM
 
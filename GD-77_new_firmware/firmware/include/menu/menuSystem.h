@@ -20,7 +20,7 @@
 #include "fw_main.h"
 
 extern int menuDisplayLightTimer;
-extern int menuTimer;
+extern TickType_t menuTimer;// tick at which the current menu times out, see menuTimerStart()
 
 typedef int (*MenuFunctionPointer_t)(int,int,int,bool); // Typedef for menu function pointers.  Functions are passed the key, the button and the event data. Event can be a Key or a button or both. Last arg is for when the function is only called to initialise and display its screen.
 typedef struct menuControlDataStruct
@@ -39,6 +39,9 @@ typedef struct menuItemNew
 void menuInitMenuSystem();
 void displayLightTrigger();
 void displayLightOverrideTimeout(int timeout);
+bool menuTickHasPassed(TickType_t deadline);
+void menuTimerStart(int timeoutMs);
+bool menuTimerHasExpired();
 void menuSystemPushNewMenu(int menuNumber);
 
 void menuSystemSetCurrentMenu(int menuNumber);
@@ -49,6 +52,7 @@ void menuSystemPopAllAndDisplayRootMenu();
 void menuSystemPopAllAndDisplaySpecificRootMenu(int newRootMenu);
 
 void menuSystemCallCurrentMenuTick(int buttons, int keys, int events);
+void menuChannelModeInvalidateNeighbours();
 
 /*
  * ---------------------- IMPORTANT ----------------------------
@@ -20,6 +20,7 @@
 #include "fw_common.h"
 
 #define NUM_LASTHEARD_STORED 16
+#define LASTHEARD_LINK_QUALITY_UNKNOWN 0xFFFF
 
 typedef struct dmrIdDataStruct
 {
@@ -34,6 +35,8 @@ typedef struct LinkItem
     int id;
     int talkGroup;
     char talkerAlias[32];// 4 blocks of data. 6 bytes + 6 bytes + 7 bytes + 7 bytes . plus 1 for termination some more for safety
+    uint16_t ber;// of the last transmission, in 0.1 % units
+    uint16_t frameLoss;// of the last transmission, in 0.1 % units
     struct LinkItem *next;
 } LinkItem_t;
 
@@ -45,11 +48,14 @@ enum QSO_DISPLAY_STATE
 };
 
 extern LinkItem_t *LinkHead;
-extern int menuDisplayQSODataState;
+extern volatile int menuDisplayQSODataState;
 
+int menuUtilityTakeQSODataState();
+int lastHeardCopyItems(LinkItem_t *items, int startIndex, int maxItems);
 bool dmrIDLookup( int targetId,dmrIdDataStruct_t *foundRecord);
 void menuUtilityRenderQSOData();
 void menuUtilityRenderHeader();
 void lastheardInitList();
 void lastHeardListUpdate(uint8_t *dmrDataBuffer);
+void lastHeardUpdateLinkQuality(int id, int ber, int frameLoss);
 #endif
@@ -49,6 +49,9 @@ extern volatile int com_buffer_cnt;
 extern volatile int com_request;
 extern volatile uint8_t com_requestbuffer[COM_REQUESTBUFFER_SIZE];
 
+void init_usb_task();
+void fw_usb_task();
+void wakeup_usb_task_from_isr();
 void tick_com_request();
 void send_packet(uint8_t val_0x82, uint8_t val_0x86, int ram);
 void send_packet_big(uint8_t val_0x82, uint8_t val_0x86, int ram1, int ram2);
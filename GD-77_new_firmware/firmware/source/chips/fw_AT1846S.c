@@ -168,10 +168,7 @@ const uint8_t AT1846DMRSettings[][AT1846_BYTES_PER_COMMAND] = {
 
 void I2C_AT1846S_send_Settings(const uint8_t settings[][3],int numSettings)
 {
-	for(int i=0;i<numSettings;i++)
-	{
-		write_I2C_reg_2byte(I2C_MASTER_SLAVE_ADDR_7BIT,	settings[i][0], settings[i][1],	settings[i][2]);
-	}
+	write_I2C_reg_2byte_list(I2C_MASTER_SLAVE_ADDR_7BIT, settings, numSettings);
 }
 
 void I2C_AT1846S_init()
@@ -188,6 +185,7 @@ void I2C_AT1846S_init()
 
 	write_I2C_reg_2byte(I2C_MASTER_SLAVE_ADDR_7BIT, 0x30, 0x40, 0x06); // chip_cal_en Disable calibration
 	vTaskDelay(portTICK_PERIOD_MS * 10);
+	invalidate_I2C_shadow_AT1846();// the calibration may have changed registers behind the shadow
 	// Calibration end
 	// --- end of AT1846_init()
 
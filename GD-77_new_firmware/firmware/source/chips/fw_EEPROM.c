@@ -19,109 +19,417 @@
 #include "fw_EEPROM.h"
 
 const uint8_t EEPROM_ADDRESS 	= 0x50;
-const uint8_t EEPROM_PAGE_SIZE 	= 128;
 
-// !!! Wait 5ms between consecutive calls !!!
-bool EEPROM_Write(int address,uint8_t *buf, int size)
+#define EEPROM_WRITE_SLOTS			4
+#define EEPROM_WRITE_RETRIES		3
+#define EEPROM_ACK_POLL_TIMEOUT_MS	20
+
+// Pending page writes. Bytes written to a page that is already queued are merged into its slot,
+// so a burst of small writes costs one page program cycle instead of one per call.
+typedef struct
+{
+	bool queued;
+	int page;
+	uint32_t sequence;						// queue order, the oldest slot is written first
+	uint32_t generation;					// bumped by every write merged in, a slot changed while it was programmed stays queued
+	uint32_t dirty[EEPROM_PAGE_SIZE / 32];	// one bit per byte of data[]
+	uint8_t data[EEPROM_PAGE_SIZE];
+} eepromWriteSlot_t;
+
+static eepromWriteSlot_t eepromWriteSlots[EEPROM_WRITE_SLOTS];
+static uint32_t eepromWriteSequence = 0;
+static uint8_t eepromPageBuffer[EEPROM_PAGE_SIZE];
+static uint8_t eepromFillBuffer[EEPROM_PAGE_SIZE];
+static SemaphoreHandle_t eepromMutex = NULL;
+
+// How eeprom_lock() got the device. eeprom_unlock() goes by this instead of looking at the context again.
+typedef enum
+{
+	EEPROM_LOCK_BUSY = 0,// polling only, but a task is in the middle of a page write
+	EEPROM_LOCK_POLLED,
+	EEPROM_LOCK_MUTEX
+} eepromLock_t;
+static TaskHandle_t fwEEPROMTaskHandle = NULL;
+
+volatile uint32_t eepromPageWrites = 0;
+volatile uint32_t eepromCoalescedWrites = 0;
+volatile uint32_t eepromAckPolls = 0;
+volatile uint32_t eepromPageCyclesLast = 0;
+volatile uint32_t eepromPageCyclesMax = 0;
+volatile uint32_t eepromWriteErrors = 0;
+
+static void fw_eeprom_task();
+
+void init_EEPROM_task()
+{
+	eepromMutex = xSemaphoreCreateMutex();
+
+	xTaskCreate(fw_eeprom_task,                        /* pointer to the task */
+				"fw eeprom task",                      /* task name for kernel awareness debugging */
+				600L / sizeof(portSTACK_TYPE),       /* task stack size */
+				NULL,                      			 /* optional task startup argument */
+				TASK_PRIORITY_HOUSEKEEPING,          /* initial priority */
+				&fwEEPROMTaskHandle					 /* optional task handle to create */
+				);
+}
+
+static bool eeprom_can_block()
+{
+	return ((eepromMutex != NULL) && (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING) && (__get_BASEPRI() == 0) && (__get_IPSR() == 0));
+}
+
+// Held from the start of a page write until the device acknowledges again, so nothing reads the
+// EEPROM while it NAKs during its internal write cycle. The I2C bus itself stays free for the AT1846S.
+// Where blocking isn't possible the device is only used when no task holds it.
+static eepromLock_t eeprom_lock()
+{
+	if (eeprom_can_block())
+	{
+		xSemaphoreTake(eepromMutex, portMAX_DELAY);
+		return EEPROM_LOCK_MUTEX;
+	}
+	// Nothing here can block, so the holder can't change under us and the ISR variant needs no critical section
+	if ((eepromMutex != NULL) && (xSemaphoreGetMutexHolderFromISR(eepromMutex) != NULL))
+	{
+		return EEPROM_LOCK_BUSY;
+	}
+	return EEPROM_LOCK_POLLED;
+}
+
+static void eeprom_unlock(eepromLock_t lock)
+{
+	if (lock == EEPROM_LOCK_MUTEX)
+	{
+		xSemaphoreGive(eepromMutex);
+	}
+}
+
+static inline bool eeprom_is_dirty(const uint32_t *dirty, int offset)
+{
+	return (dirty[offset >> 5] & (1U << (offset & 31))) != 0;
+}
+
+static bool eeprom_transfer(int address, uint8_t *buf, int size, i2c_direction_t direction)
 {
-	const int COMMAND_SIZE = 2;
-	int transferSize;
-	uint8_t tmpBuf[COMMAND_SIZE];
     i2c_master_transfer_t masterXfer;
     status_t status;
 
+    memset(&masterXfer, 0, sizeof(masterXfer));
+    masterXfer.slaveAddress = EEPROM_ADDRESS;
+    masterXfer.direction = direction;
+    masterXfer.subaddress = address & 0xffff;
+    masterXfer.subaddressSize = 2;
+    masterXfer.data = buf;
+    masterXfer.dataSize = size;
+    masterXfer.flags = kI2C_TransferDefaultFlag;
+
+    status = transfer_I2C(&masterXfer);
+
+    return (status == kStatus_Success);
+}
+
+// The device does not acknowledge its address until the internal write cycle has finished.
+// A task sleeps a tick before each poll, only the polled path before the scheduler spins on the bus.
+static bool eeprom_wait_write_complete()
+{
+    i2c_master_transfer_t masterXfer;
+    status_t status;
+	uint32_t startCycles = DWT->CYCCNT;
+	bool canBlock = eeprom_can_block();
+
+    memset(&masterXfer, 0, sizeof(masterXfer));
+    masterXfer.slaveAddress = EEPROM_ADDRESS;
+    masterXfer.direction = kI2C_Write;
+    masterXfer.flags = kI2C_TransferDefaultFlag;
+
+    do
+    {
+    	if (canBlock)
+    	{
+    		vTaskDelay(1);
+    	}
+    	eepromAckPolls++;
+        status = transfer_I2C(&masterXfer);
+        if (status == kStatus_Success)
+        {
+        	return true;
+        }
+    } while ((DWT->CYCCNT - startCycles) < ((SystemCoreClock / 1000U) * EEPROM_ACK_POLL_TIMEOUT_MS));
+
+    return false;
+}
+
+// Writes the oldest queued page. The slot stays queued until its page has been programmed, so a page that
+// could not be written is kept and tried again by the next flush. Returns false in that case,
+// or with *busy set if the device is held by a task that this context can't wait for.
+static bool eeprom_write_next_slot(bool *busy)
+{
+	eepromLock_t lock;
+	uint32_t dirty[EEPROM_PAGE_SIZE / 32];
+	eepromWriteSlot_t *slot = NULL;
+	uint32_t generation;
+	int page;
+	int first, last;
+	bool holes = false;
+	bool ok = false;
+
+	lock = eeprom_lock();
+	*busy = (lock == EEPROM_LOCK_BUSY);
+	if (*busy)
+	{
+		return false;
+	}
+
+	taskENTER_CRITICAL();
+	for (int i = 0; i < EEPROM_WRITE_SLOTS; i++)
+	{
+		if (eepromWriteSlots[i].queued && ((slot == NULL) || ((int32_t)(eepromWriteSlots[i].sequence - slot->sequence) < 0)))
+		{
+			slot = &eepromWriteSlots[i];
+		}
+	}
+	if (slot == NULL)
+	{
+		taskEXIT_CRITICAL();
+		eeprom_unlock(lock);
+		return true;
+	}
+	page = slot->page;
+	generation = slot->generation;
+	memcpy(dirty, slot->dirty, sizeof(dirty));
+	memcpy(eepromPageBuffer, slot->data, EEPROM_PAGE_SIZE);
+	taskEXIT_CRITICAL();
+
+	first = 0;
+	while (!eeprom_is_dirty(dirty, first))
+	{
+		first++;
+	}
+	last = EEPROM_PAGE_SIZE - 1;
+	while (!eeprom_is_dirty(dirty, last))
+	{
+		last--;
+	}
+	for (int i = first; i <= last; i++)
+	{
+		holes = holes || !eeprom_is_dirty(dirty, i);
+	}
+
+	for (int retry = 0; (retry < EEPROM_WRITE_RETRIES) && !ok; retry++)
+	{
+		uint32_t startCycles = DWT->CYCCNT;
+		int address = (page * EEPROM_PAGE_SIZE) + first;
+		int size = last - first + 1;
+
+		// A page program writes a contiguous run, so any holes between merged writes are filled from the device
+		ok = true;
+		if (holes)
+		{
+			ok = eeprom_transfer(address, &eepromFillBuffer[first], size, kI2C_Read);
+			for (int i = first; ok && (i <= last); i++)
+			{
+				if (!eeprom_is_dirty(dirty, i))
+				{
+					eepromPageBuffer[i] = eepromFillBuffer[i];
+				}
+			}
+			holes = !ok;
+		}
+
+		ok = ok && eeprom_transfer(address, &eepromPageBuffer[first], size, kI2C_Write) && eeprom_wait_write_complete();
+
+		eepromPageCyclesLast = DWT->CYCCNT - startCycles;
+		if (eepromPageCyclesLast > eepromPageCyclesMax)
+		{
+			eepromPageCyclesMax = eepromPageCyclesLast;
+		}
+	}
+
+	if (ok)
+	{
+		eepromPageWrites++;
+		taskENTER_CRITICAL();
+		if (slot->generation == generation)
+		{
+			slot->queued = false;
+		}
+		taskEXIT_CRITICAL();
+	}
+	else
+	{
+		eepromWriteErrors++;
+	}
+
+	eeprom_unlock(lock);
+	return ok;
+}
+
+static bool eeprom_queue_chunk(int address, uint8_t *buf, int size)
+{
+	int page = address / EEPROM_PAGE_SIZE;
+	int offset = address % EEPROM_PAGE_SIZE;
+	eepromWriteSlot_t *slot = NULL;
+
 	taskENTER_CRITICAL();
+	for (int i = 0; i < EEPROM_WRITE_SLOTS; i++)
+	{
+		if (eepromWriteSlots[i].queued && (eepromWriteSlots[i].page == page))
+		{
+			slot = &eepromWriteSlots[i];
+			eepromCoalescedWrites++;
+			break;
+		}
+		if ((slot == NULL) && !eepromWriteSlots[i].queued)
+		{
+			slot = &eepromWriteSlots[i];
+		}
+	}
+	if (slot == NULL)
+	{
+		taskEXIT_CRITICAL();
+		return false;
+	}
+	if (!slot->queued)
+	{
+		slot->queued = true;
+		slot->page = page;
+		slot->sequence = eepromWriteSequence++;
+		memset(slot->dirty, 0, sizeof(slot->dirty));
+	}
+	slot->generation++;
+	memcpy(&slot->data[offset], buf, size);
+	for (int i = offset; i < (offset + size); i++)
+	{
+		slot->dirty[i >> 5] |= (1U << (i & 31));
+	}
+	taskEXIT_CRITICAL();
+
+	return true;
+}
+
+// Queues the data and returns, the writer task programs the pages in the background.
+// EEPROM_Read() sees queued data immediately, use EEPROM_Flush() before removing power.
+// A page the writer task fails to program stays queued, EEPROM_Flush() then returns false.
+bool EEPROM_Write(int address,uint8_t *buf, int size)
+{
+	bool busy;
+
     while(size > 0)
     {
-		transferSize = size>EEPROM_PAGE_SIZE?EEPROM_PAGE_SIZE:size;
-		tmpBuf[0] = address >> 8;
-		tmpBuf[1] = address & 0xff;
-
-		memset(&masterXfer, 0, sizeof(masterXfer));
-		masterXfer.slaveAddress = EEPROM_ADDRESS;
-		masterXfer.direction = kI2C_Write;
-		masterXfer.subaddress = 0;
-		masterXfer.subaddressSize = 0;
-		masterXfer.data = tmpBuf;
-		masterXfer.dataSize = COMMAND_SIZE;
-		masterXfer.flags = kI2C_TransferNoStopFlag;//kI2C_TransferDefaultFlag;
-
-		status = I2C_MasterTransferBlocking(I2C0, &masterXfer);
-		if (status != kStatus_Success)
+		int transferSize = EEPROM_PAGE_SIZE - (address % EEPROM_PAGE_SIZE);
+
+		if (transferSize > size)
 		{
-	    	taskEXIT_CRITICAL();
-			return false;
+			transferSize = size;
 		}
 
-		memset(&masterXfer, 0, sizeof(masterXfer));
-		masterXfer.slaveAddress = EEPROM_ADDRESS;
-		masterXfer.direction = kI2C_Write;
-		masterXfer.subaddress = 0;
-		masterXfer.subaddressSize = 0;
-		masterXfer.data = buf;
-		masterXfer.dataSize = transferSize;
-		masterXfer.flags = kI2C_TransferNoStartFlag;//kI2C_TransferDefaultFlag;
-
-		status = I2C_MasterTransferBlocking(I2C0, &masterXfer);
-		if (status != kStatus_Success)
+		// When the queue is full the caller writes out the oldest page itself
+		while (!eeprom_queue_chunk(address, buf, transferSize))
 		{
-	    	taskEXIT_CRITICAL();
-			return status;
+			if (!eeprom_write_next_slot(&busy))
+			{
+				return false;
+			}
 		}
 		address += transferSize;
+		buf += transferSize;
 		size -= transferSize;
-		if (size!=0)
+    }
+
+    if (eeprom_can_block() && (fwEEPROMTaskHandle != NULL))
+    {
+    	xTaskNotifyGive(fwEEPROMTaskHandle);
+    	return true;
+    }
+	return EEPROM_Flush();
+}
+
+bool EEPROM_Flush()
+{
+	eepromLock_t lock;
+	bool busy;
+	bool pending;
+
+	do
+	{
+		// Stop at a page that can't be written, it stays queued for the next flush
+		if (!eeprom_write_next_slot(&busy))
 		{
-		    vTaskDelay(portTICK_PERIOD_MS * 5);
+			return false;
 		}
-    }
-	taskEXIT_CRITICAL();
-	return true;
+
+		pending = false;
+		taskENTER_CRITICAL();
+		for (int i = 0; i < EEPROM_WRITE_SLOTS; i++)
+		{
+			pending = pending || eepromWriteSlots[i].queued;
+		}
+		taskEXIT_CRITICAL();
+	} while (pending);
+
+	// A page taken by the writer task is complete once its lock can be had
+	lock = eeprom_lock();
+	eeprom_unlock(lock);
+
+	return (lock != EEPROM_LOCK_BUSY);
 }
 
 bool EEPROM_Read(int address,uint8_t *buf, int size)
 {
-	const int COMMAND_SIZE = 2;
-	uint8_t tmpBuf[COMMAND_SIZE];
-    i2c_master_transfer_t masterXfer;
-    status_t status;
+	eepromLock_t lock;
+	bool ok;
+
+	lock = eeprom_lock();
+	if (lock == EEPROM_LOCK_BUSY)
+	{
+		return false;
+	}
+	ok = eeprom_transfer(address, buf, size, kI2C_Read);
 
+	// Overlay data still waiting in the queue
 	taskENTER_CRITICAL();
-    tmpBuf[0] = address >> 8;
-    tmpBuf[1] = address & 0xff;
+	for (int i = 0; i < EEPROM_WRITE_SLOTS; i++)
+	{
+		eepromWriteSlot_t *slot = &eepromWriteSlots[i];
+		int pageAddress = slot->page * EEPROM_PAGE_SIZE;
 
-    memset(&masterXfer, 0, sizeof(masterXfer));
-    masterXfer.slaveAddress = EEPROM_ADDRESS;
-    masterXfer.direction = kI2C_Write;
-    masterXfer.subaddress = 0;
-    masterXfer.subaddressSize = 0;
-    masterXfer.data = tmpBuf;
-    masterXfer.dataSize = COMMAND_SIZE;
-    masterXfer.flags = kI2C_TransferNoStopFlag;
-
-    status = I2C_MasterTransferBlocking(I2C0, &masterXfer);
-    if (status != kStatus_Success)
-    {
-    	taskEXIT_CRITICAL();
-    	return false;
-    }
+		if (!slot->queued || (pageAddress >= (address + size)) || ((pageAddress + EEPROM_PAGE_SIZE) <= address))
+		{
+			continue;
+		}
+		for (int j = 0; j < EEPROM_PAGE_SIZE; j++)
+		{
+			int index = pageAddress + j - address;
 
-    memset(&masterXfer, 0, sizeof(masterXfer));
-    masterXfer.slaveAddress = EEPROM_ADDRESS;
-    masterXfer.direction = kI2C_Read;
-    masterXfer.subaddress = 0;
-    masterXfer.subaddressSize = 0;
-    masterXfer.data = buf;
-    masterXfer.dataSize = size;
-    masterXfer.flags = kI2C_TransferRepeatedStartFlag;
+			if ((index >= 0) && (index < size) && eeprom_is_dirty(slot->dirty, j))
+			{
+				buf[index] = slot->data[j];
+			}
+		}
+	}
+	taskEXIT_CRITICAL();
+	eeprom_unlock(lock);
 
-    status = I2C_MasterTransferBlocking(I2C0, &masterXfer);
-    if (status != kStatus_Success)
-    {
-    	taskEXIT_CRITICAL();
-    	return false;
-    }
+	return ok;
+}
 
+void EEPROM_resetStats()
+{
+	taskENTER_CRITICAL();
+	eepromPageWrites = 0;
+	eepromCoalescedWrites = 0;
+	eepromAckPolls = 0;
+	eepromPageCyclesLast = 0;
+	eepromPageCyclesMax = 0;
+	eepromWriteErrors = 0;
 	taskEXIT_CRITICAL();
-	return true;
+}
+
+static void fw_eeprom_task()
+{
+	while (1U)
+	{
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		EEPROM_Flush();
+	}
 }
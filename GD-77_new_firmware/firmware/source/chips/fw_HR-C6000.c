@@ -25,18 +25,269 @@
 #include <SeggerRTT/RTT/SEGGER_RTT.h>
 #endif
 
-TaskHandle_t fwhrc6000TaskHandle;
-
-volatile bool int_sys;
-volatile bool int_ts;
-volatile int int_timeout;
-
-int slot_state;
-int tick_cnt;
+// Notification bits sent to the HR-C6000 task
+#define HRC6000_NOTIFY_SYS         0x01
+#define HRC6000_NOTIFY_TS          0x02
+#define HRC6000_NOTIFY_RF          0x04
+#define HRC6000_NOTIFY_WAKEUP      0x08
+#define HRC6000_NOTIFY_TIMEOUT     0x10
+#define HRC6000_NOTIFY_RX_TIMEOUT  0x20
+#define HRC6000_NOTIFY_IRQ_MASK    (HRC6000_NOTIFY_SYS | HRC6000_NOTIFY_TS | HRC6000_NOTIFY_RF)
+
+#define HRC6000_INTERRUPT_TIMEOUT_MS 200 // no C6000 interrupt while active
+#define HRC6000_RX_TIMEOUT_MS        300 // 10 timeslots without received data
+#define HRC6000_QSODATA_TIMEOUT_MS   2400
+#define HRC6000_IDLE_WAIT_MS         20  // keeps the watchdog fed while nothing happens
+#define HRC6000_ANALOG_SQUELCH_MS    5   // noise level poll while the squelch is shut, bounds the open latency
+#define HRC6000_ANALOG_SQUELCH_OPEN_MS 20 // while open, the hang time covers the slower poll
+#define HRC6000_VOICE_BURST_MS       60  // one voice burst of our timeslot per TDMA frame
+
+TaskHandle_t fwhrc6000TaskHandle = NULL;
+
+static TimerHandle_t interruptTimeoutTimer;
+static TimerHandle_t rxTimeoutTimer;
+static TimerHandle_t qsodataTimer;
+
+static volatile uint32_t irqTimestamp;
+static volatile bool irqTimestampValid = false;
+static uint32_t serviceTimestamp;// interrupt timestamp of the work in hand
+static bool rxFirstVoice = false;
+static int rxLastVoiceBurst;
+static uint32_t rxLastVoiceTimestamp;
+
+volatile uint32_t hrc6000IrqCount;
+volatile uint32_t hrc6000LatencyLast;
+volatile uint32_t hrc6000LatencyMax;
+volatile uint64_t hrc6000LatencySum;
+
+static volatile bool tsPending = false;
+volatile uint32_t hrc6000TsCount;
+volatile uint32_t hrc6000TsOverruns;
+
+volatile int slot_state;
 int skip_count;
-int qsodata_timer;
 int tx_sequence;
 
+static void hrc6000TimeoutCallback(TimerHandle_t xTimer);
+static void qsodataTimeoutCallback(TimerHandle_t xTimer);
+
+volatile uint32_t hrc6000InitCycles;
+
+// --- start spi_init_daten_senden()
+static const spi_reg_write_t hrc6000_init_script_1[] =
+{
+	{ 0x04, 0x0b, 0x40, 0 },
+	{ 0x04, 0x0c, 0x32, 0 },
+	{ 0x04, 0xb9, 0x05, 0 },
+	{ 0x04, 0x0a, 0x01, 0 },
+
+	// Page 1 tables, written as bursts
+	// GD-77 FW V3.1.1 data from 0x76010 / length 0x06
+	{ 0x01, 0x04, 0xD5, 0 }, { 0x01, 0x05, 0xD7, 0 }, { 0x01, 0x06, 0xF7, 0 }, { 0x01, 0x07, 0x7F, 0 },
+	{ 0x01, 0x08, 0xD7, 0 }, { 0x01, 0x09, 0x57, 0 },
+	// GD-77 FW V3.1.1 data from 0x75F70 / length 0x20
+	{ 0x01, 0x10, 0x69, 0 }, { 0x01, 0x11, 0x69, 0 }, { 0x01, 0x12, 0x96, 0 }, { 0x01, 0x13, 0x96, 0 },
+	{ 0x01, 0x14, 0x96, 0 }, { 0x01, 0x15, 0x99, 0 }, { 0x01, 0x16, 0x99, 0 }, { 0x01, 0x17, 0x99, 0 },
+	{ 0x01, 0x18, 0xA5, 0 }, { 0x01, 0x19, 0xA5, 0 }, { 0x01, 0x1A, 0xAA, 0 }, { 0x01, 0x1B, 0xAA, 0 },
+	{ 0x01, 0x1C, 0xCC, 0 }, { 0x01, 0x1D, 0xCC, 0 }, { 0x01, 0x1E, 0x00, 0 }, { 0x01, 0x1F, 0xF0, 0 },
+	{ 0x01, 0x20, 0x01, 0 }, { 0x01, 0x21, 0xFF, 0 }, { 0x01, 0x22, 0x01, 0 }, { 0x01, 0x23, 0x0F, 0 },
+	{ 0x01, 0x24, 0x00, 0 }, { 0x01, 0x25, 0x00, 0 }, { 0x01, 0x26, 0x00, 0 }, { 0x01, 0x27, 0x00, 0 },
+	{ 0x01, 0x28, 0x10, 0 }, { 0x01, 0x29, 0x70, 0 }, { 0x01, 0x2A, 0x00, 0 }, { 0x01, 0x2B, 0x00, 0 },
+	{ 0x01, 0x2C, 0x00, 0 }, { 0x01, 0x2D, 0x00, 0 }, { 0x01, 0x2E, 0x00, 0 }, { 0x01, 0x2F, 0x00, 0 },
+	// GD-77 FW V3.1.1 data from 0x75F90 / length 0x10
+	{ 0x01, 0x30, 0x00, 0 }, { 0x01, 0x31, 0x00, 0 }, { 0x01, 0x32, 0x14, 0 }, { 0x01, 0x33, 0x1E, 0 },
+	{ 0x01, 0x34, 0x1A, 0 }, { 0x01, 0x35, 0xFF, 0 }, { 0x01, 0x36, 0x3D, 0 }, { 0x01, 0x37, 0x50, 0 },
+	{ 0x01, 0x38, 0x07, 0 }, { 0x01, 0x39, 0x60, 0 }, { 0x01, 0x3A, 0x00, 0 }, { 0x01, 0x3B, 0x00, 0 },
+	{ 0x01, 0x3C, 0x00, 0 }, { 0x01, 0x3D, 0x00, 0 }, { 0x01, 0x3E, 0x00, 0 }, { 0x01, 0x3F, 0x00, 0 },
+	// GD-77 FW V3.1.1 data from 0x75FA0 / length 0x07
+	{ 0x01, 0x40, 0x00, 0 }, { 0x01, 0x41, 0x03, 0 }, { 0x01, 0x42, 0x01, 0 }, { 0x01, 0x43, 0x02, 0 },
+	{ 0x01, 0x44, 0x05, 0 }, { 0x01, 0x45, 0x1E, 0 }, { 0x01, 0x46, 0xF0, 0 },
+	// GD-77 FW V3.1.1 data from 0x75FA8 / length 0x05
+	{ 0x01, 0x51, 0x00, 0 }, { 0x01, 0x52, 0x00, 0 }, { 0x01, 0x53, 0xEB, 0 }, { 0x01, 0x54, 0x78, 0 },
+	{ 0x01, 0x55, 0x67, 0 },
+	// GD-77 FW V3.1.1 data from 0x75FB0 / length 0x60
+	{ 0x01, 0x60, 0x32, 0 }, { 0x01, 0x61, 0xEF, 0 }, { 0x01, 0x62, 0x00, 0 }, { 0x01, 0x63, 0x31, 0 },
+	{ 0x01, 0x64, 0xEF, 0 }, { 0x01, 0x65, 0x00, 0 }, { 0x01, 0x66, 0x12, 0 }, { 0x01, 0x67, 0xEF, 0 },
+	{ 0x01, 0x68, 0x00, 0 }, { 0x01, 0x69, 0x13, 0 }, { 0x01, 0x6A, 0xEF, 0 }, { 0x01, 0x6B, 0x00, 0 },
+	{ 0x01, 0x6C, 0x14, 0 }, { 0x01, 0x6D, 0xEF, 0 }, { 0x01, 0x6E, 0x00, 0 }, { 0x01, 0x6F, 0x15, 0 },
+	{ 0x01, 0x70, 0xEF, 0 }, { 0x01, 0x71, 0x00, 0 }, { 0x01, 0x72, 0x16, 0 }, { 0x01, 0x73, 0xEF, 0 },
+	{ 0x01, 0x74, 0x00, 0 }, { 0x01, 0x75, 0x17, 0 }, { 0x01, 0x76, 0xEF, 0 }, { 0x01, 0x77, 0x00, 0 },
+	{ 0x01, 0x78, 0x18, 0 }, { 0x01, 0x79, 0xEF, 0 }, { 0x01, 0x7A, 0x00, 0 }, { 0x01, 0x7B, 0x19, 0 },
+	{ 0x01, 0x7C, 0xEF, 0 }, { 0x01, 0x7D, 0x00, 0 }, { 0x01, 0x7E, 0x1A, 0 }, { 0x01, 0x7F, 0xEF, 0 },
+	{ 0x01, 0x80, 0x00, 0 }, { 0x01, 0x81, 0x1B, 0 }, { 0x01, 0x82, 0xEF, 0 }, { 0x01, 0x83, 0x00, 0 },
+	{ 0x01, 0x84, 0x1C, 0 }, { 0x01, 0x85, 0xEF, 0 }, { 0x01, 0x86, 0x00, 0 }, { 0x01, 0x87, 0x1D, 0 },
+	{ 0x01, 0x88, 0xEF, 0 }, { 0x01, 0x89, 0x00, 0 }, { 0x01, 0x8A, 0x1E, 0 }, { 0x01, 0x8B, 0xEF, 0 },
+	{ 0x01, 0x8C, 0x00, 0 }, { 0x01, 0x8D, 0x1F, 0 }, { 0x01, 0x8E, 0xEF, 0 }, { 0x01, 0x8F, 0x00, 0 },
+	{ 0x01, 0x90, 0x20, 0 }, { 0x01, 0x91, 0xEF, 0 }, { 0x01, 0x92, 0x00, 0 }, { 0x01, 0x93, 0x21, 0 },
+	{ 0x01, 0x94, 0xEF, 0 }, { 0x01, 0x95, 0x00, 0 }, { 0x01, 0x96, 0x22, 0 }, { 0x01, 0x97, 0xEF, 0 },
+	{ 0x01, 0x98, 0x00, 0 }, { 0x01, 0x99, 0x23, 0 }, { 0x01, 0x9A, 0xEF, 0 }, { 0x01, 0x9B, 0x00, 0 },
+	{ 0x01, 0x9C, 0x24, 0 }, { 0x01, 0x9D, 0xEF, 0 }, { 0x01, 0x9E, 0x00, 0 }, { 0x01, 0x9F, 0x25, 0 },
+	{ 0x01, 0xA0, 0xEF, 0 }, { 0x01, 0xA1, 0x00, 0 }, { 0x01, 0xA2, 0x26, 0 }, { 0x01, 0xA3, 0xEF, 0 },
+	{ 0x01, 0xA4, 0x00, 0 }, { 0x01, 0xA5, 0x27, 0 }, { 0x01, 0xA6, 0xEF, 0 }, { 0x01, 0xA7, 0x00, 0 },
+	{ 0x01, 0xA8, 0x28, 0 }, { 0x01, 0xA9, 0xEF, 0 }, { 0x01, 0xAA, 0x00, 0 }, { 0x01, 0xAB, 0x29, 0 },
+	{ 0x01, 0xAC, 0xEF, 0 }, { 0x01, 0xAD, 0x00, 0 }, { 0x01, 0xAE, 0x2A, 0 }, { 0x01, 0xAF, 0xEF, 0 },
+	{ 0x01, 0xB0, 0x00, 0 }, { 0x01, 0xB1, 0x2B, 0 }, { 0x01, 0xB2, 0xEF, 0 }, { 0x01, 0xB3, 0x00, 0 },
+	{ 0x01, 0xB4, 0x2C, 0 }, { 0x01, 0xB5, 0xEF, 0 }, { 0x01, 0xB6, 0x00, 0 }, { 0x01, 0xB7, 0x2D, 0 },
+	{ 0x01, 0xB8, 0xEF, 0 }, { 0x01, 0xB9, 0x00, 0 }, { 0x01, 0xBA, 0x2E, 0 }, { 0x01, 0xBB, 0xEF, 0 },
+	{ 0x01, 0xBC, 0x00, 0 }, { 0x01, 0xBD, 0x2F, 0 }, { 0x01, 0xBE, 0xEF, 0 }, { 0x01, 0xBF, 0x00, 0 },
+};
+
+static const spi_reg_write_t hrc6000_init_script_2[] =
+{
+	{ 0x04, 0x00, 0x00, SPI_REG_STROBE },
+	{ 0x04, 0x10, 0x6E, 0 }, // (oder 0x02 oder 0x6A)
+	{ 0x04, 0x11, 0x80, 0 },
+	{ 0x04, 0x13, 0x00, 0 },
+	{ 0x04, 0x1F, 0x10, 0 }, // DMR Colour code in upper 4 bits - defaulted to 1, and is updated elsewhere in the code
+	{ 0x04, 0x20, 0x00, 0 },
+	{ 0x04, 0x21, 0xA0, SPI_REG_STROBE },
+	{ 0x04, 0x22, 0x26, SPI_REG_STROBE },
+	{ 0x04, 0x22, 0x86, SPI_REG_STROBE },
+	{ 0x04, 0x25, 0x0E, 0 },
+	{ 0x04, 0x26, 0x7D, 0 },
+	{ 0x04, 0x27, 0x40, 0 },
+	{ 0x04, 0x28, 0x7D, 0 },
+	{ 0x04, 0x29, 0x40, 0 },
+	{ 0x04, 0x2A, 0x0B, 0 },
+	{ 0x04, 0x2B, 0x0B, 0 },
+	{ 0x04, 0x2C, 0x17, 0 },
+	{ 0x04, 0x2D, 0x05, 0 },
+	{ 0x04, 0x2E, 0x04, 0 },
+	{ 0x04, 0x2F, 0x0B, 0 },
+	{ 0x04, 0x32, 0x02, 0 },
+	{ 0x04, 0x33, 0xFF, 0 },
+	{ 0x04, 0x34, 0xF0, 0 },
+	{ 0x04, 0x35, 0x28, 0 },
+	{ 0x04, 0x3E, 0x28, 0 },
+	{ 0x04, 0x3F, 0x10, 0 },
+	{ 0x04, 0x36, 0x00, 0 },
+	{ 0x04, 0x37, 0x00, 0 },
+	{ 0x04, 0x4B, 0x1B, 0 },
+	{ 0x04, 0x4C, 0x00, 0 },
+	{ 0x04, 0x56, 0x00, 0 }, // / (dynamisch)
+	{ 0x04, 0x5F, 0xC0, 0 }, // | (dynamisch)
+	{ 0x04, 0x81, 0xFF, 0 }, // \ (dynamisch)
+	{ 0x04, 0xD1, 0xC4, 0 },
+
+	// --- start subroutine spi_init_daten_senden_sub()
+	{ 0x04, 0x01, 0x70, 0 }, // (dynamisch)
+	{ 0x04, 0x03, 0x00, 0 },
+	{ 0x04, 0x05, 0x00, 0 },
+	{ 0x04, 0x12, 0x15, 0 }, // (dynamisch)
+	{ 0x04, 0xA1, 0x80, 0 }, // (dynamisch)
+	{ 0x04, 0xC0, 0x0A, 0 },
+	{ 0x04, 0x06, 0x21, 0 },
+	{ 0x04, 0x07, 0x0B, 0 },
+	{ 0x04, 0x08, 0xB8, 0 },
+	{ 0x04, 0x09, 0x00, 0 },
+	{ 0x04, 0x0D, 0x10, 0 },
+	{ 0x04, 0x0E, 0x8E, 0 },
+	{ 0x04, 0x0F, 0xB8, 0 },
+	{ 0x04, 0xC2, 0x00, 0 },
+	{ 0x04, 0xE0, 0x8B, 0 },
+	{ 0x04, 0xE1, 0x0F, 0 },
+	{ 0x04, 0xE2, 0x06, 0 },
+	{ 0x04, 0xE3, 0x52, 0 },
+	{ 0x04, 0xE4, 0x4A, 0 },
+	{ 0x04, 0xE5, 0x1A, 0 },
+	// --- end subroutine spi_init_daten_senden_sub()
+
+	{ 0x04, 0x40, 0xC3, SPI_REG_STROBE }, // / (dynamisch)
+	{ 0x04, 0x41, 0x40, SPI_REG_STROBE }, // \ (dynamisch)
+};
+// --- end spi_init_daten_senden()
+
+static const spi_reg_write_t hrc6000_postinit_script_1[] =
+{
+	{ 0x04, 0x04, 0xE8, 0 },
+	{ 0x04, 0x46, 0x37, 0 },
+	{ 0x04, 0x48, 0x03, 0 },
+	{ 0x04, 0x47, 0xE8, 0 },
+	{ 0x04, 0x41, 0x20, SPI_REG_STROBE },
+	{ 0x04, 0x40, 0x03, SPI_REG_STROBE },
+	{ 0x04, 0x41, 0x00, SPI_REG_STROBE },
+	{ 0x04, 0x00, 0x3F, SPI_REG_STROBE },
+	// GD-77 FW V3.1.1 data from 0x76010 / length 0x06
+	{ 0x01, 0x04, 0xD5, 0 }, { 0x01, 0x05, 0xD7, 0 }, { 0x01, 0x06, 0xF7, 0 }, { 0x01, 0x07, 0x7F, 0 },
+	{ 0x01, 0x08, 0xD7, 0 }, { 0x01, 0x09, 0x57, 0 },
+};
+
+static const spi_reg_write_t hrc6000_postinit_script_2[] =
+{
+	{ 0x04, 0x10, 0x6E, 0 },
+	{ 0x04, 0x1F, 0x10, 0 }, // DMR Colour code in upper 4 bits - defaulted to 1, and is updated elsewhere in the code
+	{ 0x04, 0x26, 0x7D, 0 },
+	{ 0x04, 0x27, 0x40, 0 },
+	{ 0x04, 0x28, 0x7D, 0 },
+	{ 0x04, 0x29, 0x40, 0 },
+	{ 0x04, 0x2A, 0x0B, 0 },
+	{ 0x04, 0x2B, 0x0B, 0 },
+	{ 0x04, 0x2C, 0x17, 0 },
+	{ 0x04, 0x2D, 0x05, 0 },
+	{ 0x04, 0x56, 0x00, 0 },
+	{ 0x04, 0x5F, 0xC0, 0 },
+	{ 0x04, 0x81, 0xFF, 0 },
+	{ 0x04, 0x01, 0x70, 0 },
+	{ 0x04, 0x03, 0x00, 0 },
+	{ 0x04, 0x05, 0x00, 0 },
+	{ 0x04, 0x12, 0x15, 0 },
+	{ 0x04, 0xA1, 0x80, 0 },
+	{ 0x04, 0xC0, 0x0A, 0 },
+	{ 0x04, 0x06, 0x21, 0 },
+	{ 0x04, 0x07, 0x0B, 0 },
+	{ 0x04, 0x08, 0xB8, 0 },
+	{ 0x04, 0x09, 0x00, 0 },
+	{ 0x04, 0x0D, 0x10, 0 },
+	{ 0x04, 0x0E, 0x8E, 0 },
+	{ 0x04, 0x0F, 0xB8, 0 },
+	{ 0x04, 0xC2, 0x00, 0 },
+	{ 0x04, 0xE0, 0x8B, 0 },
+	{ 0x04, 0xE1, 0x0F, 0 },
+	{ 0x04, 0xE2, 0x06, 0 },
+	{ 0x04, 0xE3, 0x52, 0 },
+	{ 0x04, 0xE4, 0x4A, 0 },
+	{ 0x04, 0xE5, 0x1A, 0 },
+	{ 0x04, 0x26, 0x7D, 0 },
+	{ 0x04, 0x27, 0x40, 0 },
+	{ 0x04, 0x28, 0x7D, 0 },
+	{ 0x04, 0x29, 0x40, 0 },
+	{ 0x04, 0x41, 0x20, SPI_REG_STROBE },
+	{ 0x04, 0x40, 0xC3, SPI_REG_STROBE },
+	{ 0x04, 0x41, 0x40, SPI_REG_STROBE },
+	{ 0x04, 0x01, 0x70, 0 },
+	{ 0x04, 0x10, 0x6E, 0 },
+	{ 0x04, 0x00, 0x3F, SPI_REG_STROBE },
+	{ 0x04, 0xE4, 0x4B, 0 },
+};
+
+static const spi_reg_write_t hrc6000_dmr_rx_script[] =
+{
+	{ 0x04, 0x41, 0x20, SPI_REG_STROBE },
+	{ 0x04, 0x41, 0x00, SPI_REG_STROBE },
+	{ 0x04, 0x41, 0x20, SPI_REG_STROBE },
+	{ 0x04, 0x41, 0x40, SPI_REG_STROBE },
+};
+
+static const spi_reg_write_t hrc6000_tx_next_slot_script[] =
+{
+	{ 0x04, 0x41, 0x80, SPI_REG_STROBE },
+	{ 0x04, 0x50, 0x10, SPI_REG_STROBE },
+};
+
+static const spi_reg_write_t hrc6000_tx_end_script[] =
+{
+	{ 0x04, 0x41, 0x80, SPI_REG_STROBE },
+	{ 0x04, 0x50, 0x20, SPI_REG_STROBE },
+};
+
+static const spi_reg_write_t hrc6000_tx_start_script[] =
+{
+	{ 0x04, 0x40, 0xE3, SPI_REG_STROBE }, // TX and RX enable
+	{ 0x04, 0x21, 0xA2, SPI_REG_STROBE }, // reset vocoder codingbuffer
+	{ 0x04, 0x22, 0x86, SPI_REG_STROBE }, // I2S master encode start
+};
+
+
 void SPI_HR_C6000_init()
 {
     // C6000 interrupts
@@ -61,93 +312,12 @@ void SPI_HR_C6000_init()
 	vTaskDelay(portTICK_PERIOD_MS * 10);
     GPIO_PinWrite(GPIO_INT_C6000_PWD, Pin_INT_C6000_PWD, 0);
 	vTaskDelay(portTICK_PERIOD_MS * 10);
-
-	// GD-77 FW V3.1.1 data from 0x76010 / length 0x06
-	uint8_t spi_init_values_1[] = { 0xd5, 0xd7, 0xf7, 0x7f, 0xd7, 0x57 };
-	// GD-77 FW V3.1.1 data from 0x75F70 / length 0x20
-	uint8_t spi_init_values_2[] = { 0x69, 0x69, 0x96, 0x96, 0x96, 0x99, 0x99, 0x99, 0xa5, 0xa5, 0xaa, 0xaa, 0xcc, 0xcc, 0x00, 0xf0, 0x01, 0xff, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x10, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
-	// GD-77 FW V3.1.1 data from 0x75F90 / length 0x10
-	uint8_t spi_init_values_3[] = { 0x00, 0x00, 0x14, 0x1e, 0x1a, 0xff, 0x3d, 0x50, 0x07, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
-	// GD-77 FW V3.1.1 data from 0x75FA0 / length 0x07
-	uint8_t spi_init_values_4[] = { 0x00, 0x03, 0x01, 0x02, 0x05, 0x1e, 0xf0 };
-	// GD-77 FW V3.1.1 data from 0x75FA8 / length 0x05
-	uint8_t spi_init_values_5[] = { 0x00, 0x00, 0xeb, 0x78, 0x67 };
-	// GD-77 FW V3.1.1 data from 0x75FB0 / length 0x60
-	uint8_t spi_init_values_6[] = { 0x32, 0xef, 0x00, 0x31, 0xef, 0x00, 0x12, 0xef, 0x00, 0x13, 0xef, 0x00, 0x14, 0xef, 0x00, 0x15, 0xef, 0x00, 0x16, 0xef, 0x00, 0x17, 0xef, 0x00, 0x18, 0xef, 0x00, 0x19, 0xef, 0x00, 0x1a, 0xef, 0x00, 0x1b, 0xef, 0x00, 0x1c, 0xef, 0x00, 0x1d, 0xef, 0x00, 0x1e, 0xef, 0x00, 0x1f, 0xef, 0x00, 0x20, 0xef, 0x00, 0x21, 0xef, 0x00, 0x22, 0xef, 0x00, 0x23, 0xef, 0x00, 0x24, 0xef, 0x00, 0x25, 0xef, 0x00, 0x26, 0xef, 0x00, 0x27, 0xef, 0x00, 0x28, 0xef, 0x00, 0x29, 0xef, 0x00, 0x2a, 0xef, 0x00, 0x2b, 0xef, 0x00, 0x2c, 0xef, 0x00, 0x2d, 0xef, 0x00, 0x2e, 0xef, 0x00, 0x2f, 0xef, 0x00 };
+	invalidate_all_SPI_shadow_SPI0(); // the registers are back at their reset values
 
 	// --- start spi_init_daten_senden()
-	write_SPI_page_reg_byte_SPI0(0x04, 0x0b, 0x40);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x0c, 0x32);
-	write_SPI_page_reg_byte_SPI0(0x04, 0xb9, 0x05);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x0a, 0x01);
-
-	write_SPI_page_reg_bytearray_SPI0(0x01, 0x04, spi_init_values_1, 0x06);
-	write_SPI_page_reg_bytearray_SPI0(0x01, 0x10, spi_init_values_2, 0x20);
-	write_SPI_page_reg_bytearray_SPI0(0x01, 0x30, spi_init_values_3, 0x10);
-	write_SPI_page_reg_bytearray_SPI0(0x01, 0x40, spi_init_values_4, 0x07);
-	write_SPI_page_reg_bytearray_SPI0(0x01, 0x51, spi_init_values_5, 0x05);
-	write_SPI_page_reg_bytearray_SPI0(0x01, 0x60, spi_init_values_6, 0x60);
-
-	write_SPI_page_reg_byte_SPI0(0x04, 0x00, 0x00);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x10, 0x6E); // (oder 0x02 oder 0x6A)
-	write_SPI_page_reg_byte_SPI0(0x04, 0x11, 0x80);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x13, 0x00);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x1F, 0x10); // DMR Colour code in upper 4 bits - defaulted to 1, and is updated elsewhere in the code
-	write_SPI_page_reg_byte_SPI0(0x04, 0x20, 0x00);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x21, 0xA0);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x22, 0x26);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x22, 0x86);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x25, 0x0E);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x26, 0x7D);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x27, 0x40);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x28, 0x7D);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x29, 0x40);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x2A, 0x0B);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x2B, 0x0B);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x2C, 0x17);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x2D, 0x05);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x2E, 0x04);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x2F, 0x0B);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x32, 0x02);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x33, 0xFF);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x34, 0xF0);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x35, 0x28);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x3E, 0x28);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x3F, 0x10);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x36, 0x00);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x37, 0x00);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x4B, 0x1B);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x4C, 0x00);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x56, 0x00); // / (dynamisch)
-	write_SPI_page_reg_byte_SPI0(0x04, 0x5F, 0xC0); // | (dynamisch)
-	write_SPI_page_reg_byte_SPI0(0x04, 0x81, 0xFF); // \ (dynamisch)
-	write_SPI_page_reg_byte_SPI0(0x04, 0xD1, 0xC4);
-
-	// --- start subroutine spi_init_daten_senden_sub()
-	write_SPI_page_reg_byte_SPI0(0x04, 0x01, 0x70); // (dynamisch)
-	write_SPI_page_reg_byte_SPI0(0x04, 0x03, 0x00);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x05, 0x00);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x12, 0x15); // (dynamisch)
-	write_SPI_page_reg_byte_SPI0(0x04, 0xA1, 0x80); // (dynamisch)
-	write_SPI_page_reg_byte_SPI0(0x04, 0xC0, 0x0A);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x06, 0x21);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x07, 0x0B);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x08, 0xB8);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x09, 0x00);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x0D, 0x10);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x0E, 0x8E);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x0F, 0xB8);
-	write_SPI_page_reg_byte_SPI0(0x04, 0xC2, 0x00);
-	write_SPI_page_reg_byte_SPI0(0x04, 0xE0, 0x8B);
-	write_SPI_page_reg_byte_SPI0(0x04, 0xE1, 0x0F);
-	write_SPI_page_reg_byte_SPI0(0x04, 0xE2, 0x06);
-	write_SPI_page_reg_byte_SPI0(0x04, 0xE3, 0x52);
-	write_SPI_page_reg_byte_SPI0(0x04, 0xE4, 0x4A);
-	write_SPI_page_reg_byte_SPI0(0x04, 0xE5, 0x1A);
-	// --- end subroutine spi_init_daten_senden_sub()
-
-	write_SPI_page_reg_byte_SPI0(0x04, 0x40, 0xC3); // / (dynamisch)
-	write_SPI_page_reg_byte_SPI0(0x04, 0x41, 0x40); // \ (dynamisch)
+	uint32_t startCycles = DWT->CYCCNT;
+	write_SPI_page_reg_script_SPI0(hrc6000_init_script_1, SPI_REG_SCRIPT_LENGTH(hrc6000_init_script_1));
+	write_SPI_page_reg_script_SPI0(hrc6000_init_script_2, SPI_REG_SCRIPT_LENGTH(hrc6000_init_script_2));
 	// --- end spi_init_daten_senden()
 
 	// ------ start spi_more_init
@@ -172,99 +342,81 @@ void SPI_HR_C6000_init()
 	write_SPI_page_reg_byte_SPI0(0x04, 0x37, 0x9E); // (dynamisch)
 	set_clear_SPI_page_reg_byte_with_mask_SPI0(0x04, 0xE4, 0x3F, 0x00); // CLEAR
 	// ------ end spi_more_init
+
+	hrc6000InitCycles = DWT->CYCCNT - startCycles;
 }
 
 void SPI_C6000_postinit()
 {
-	write_SPI_page_reg_byte_SPI0(0x04, 0x04, 0xE8);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x46, 0x37);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x48, 0x03);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x47, 0xE8);
-	// GD-77 FW V3.1.1 data from 0x76010 / length 0x06
-	uint8_t spi_init_values_1[] = { 0xd5, 0xd7, 0xf7, 0x7f, 0xd7, 0x57 };
-	write_SPI_page_reg_byte_SPI0(0x04, 0x41, 0x20);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x40, 0x03);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x41, 0x00);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x00, 0x3F);
-	write_SPI_page_reg_bytearray_SPI0(0x01, 0x04, spi_init_values_1, 0x06);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x10, 0x6E);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x1F, 0x10); // DMR Colour code in upper 4 bits - defaulted to 1, and is updated elsewhere in the code
-	write_SPI_page_reg_byte_SPI0(0x04, 0x26, 0x7D);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x27, 0x40);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x28, 0x7D);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x29, 0x40);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x2A, 0x0B);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x2B, 0x0B);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x2C, 0x17);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x2D, 0x05);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x56, 0x00);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x5F, 0xC0);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x81, 0xFF);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x01, 0x70);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x03, 0x00);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x05, 0x00);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x12, 0x15);
-	write_SPI_page_reg_byte_SPI0(0x04, 0xA1, 0x80);
-	write_SPI_page_reg_byte_SPI0(0x04, 0xC0, 0x0A);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x06, 0x21);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x07, 0x0B);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x08, 0xB8);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x09, 0x00);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x0D, 0x10);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x0E, 0x8E);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x0F, 0xB8);
-	write_SPI_page_reg_byte_SPI0(0x04, 0xC2, 0x00);
-	write_SPI_page_reg_byte_SPI0(0x04, 0xE0, 0x8B);
-	write_SPI_page_reg_byte_SPI0(0x04, 0xE1, 0x0F);
-	write_SPI_page_reg_byte_SPI0(0x04, 0xE2, 0x06);
-	write_SPI_page_reg_byte_SPI0(0x04, 0xE3, 0x52);
-	write_SPI_page_reg_byte_SPI0(0x04, 0xE4, 0x4A);
-	write_SPI_page_reg_byte_SPI0(0x04, 0xE5, 0x1A);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x26, 0x7D);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x27, 0x40);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x28, 0x7D);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x29, 0x40);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x41, 0x20);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x40, 0xC3);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x41, 0x40);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x01, 0x70);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x10, 0x6E);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x00, 0x3F);
-	write_SPI_page_reg_byte_SPI0(0x04, 0xE4, 0x4B);
+	uint32_t startCycles = DWT->CYCCNT;
+
+	write_SPI_page_reg_script_SPI0(hrc6000_postinit_script_1, SPI_REG_SCRIPT_LENGTH(hrc6000_postinit_script_1));
+	write_SPI_page_reg_script_SPI0(hrc6000_postinit_script_2, SPI_REG_SCRIPT_LENGTH(hrc6000_postinit_script_2));
+
+	hrc6000InitCycles += DWT->CYCCNT - startCycles;
 }
 
 void PORTC_IRQHandler(void)
 {
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+	uint32_t bits = 0;
+
     if ((1U << Pin_INT_C6000_SYS) & PORT_GetPinsInterruptFlags(Port_INT_C6000_SYS))
     {
-    	int_sys=true;
+    	bits |= HRC6000_NOTIFY_SYS;
         PORT_ClearPinsInterruptFlags(Port_INT_C6000_SYS, (1U << Pin_INT_C6000_SYS));
     }
     if ((1U << Pin_INT_C6000_TS) & PORT_GetPinsInterruptFlags(Port_INT_C6000_TS))
     {
-    	int_ts=true;
+    	bits |= HRC6000_NOTIFY_TS;
         PORT_ClearPinsInterruptFlags(Port_INT_C6000_TS, (1U << Pin_INT_C6000_TS));
     }
     if ((1U << Pin_INT_C6000_RF_RX) & PORT_GetPinsInterruptFlags(Port_INT_C6000_RF_RX))
     {
     	trx_deactivateTX();
+    	bits |= HRC6000_NOTIFY_RF;
         PORT_ClearPinsInterruptFlags(Port_INT_C6000_RF_RX, (1U << Pin_INT_C6000_RF_RX));
     }
     if ((1U << Pin_INT_C6000_RF_TX) & PORT_GetPinsInterruptFlags(Port_INT_C6000_RF_TX))
     {
     	trx_activateTX();
+    	bits |= HRC6000_NOTIFY_RF;
         PORT_ClearPinsInterruptFlags(Port_INT_C6000_RF_TX, (1U << Pin_INT_C6000_RF_TX));
     }
 
-    int_timeout=0;
+    if ((bits != 0) && (fwhrc6000TaskHandle != NULL))
+    {
+    	// A timeslot interrupt that arrives before the task has picked up the previous one means a slot was missed
+    	if (bits & HRC6000_NOTIFY_TS)
+    	{
+    		hrc6000TsCount++;
+    		if (tsPending)
+    		{
+    			hrc6000TsOverruns++;
+    		}
+    		tsPending = true;
+    	}
+    	// Only the oldest unserviced interrupt is timestamped
+    	if (!irqTimestampValid)
+    	{
+    		irqTimestamp = DWT->CYCCNT;
+    		irqTimestampValid = true;
+    	}
+    	xTaskNotifyFromISR(fwhrc6000TaskHandle, bits, eSetBits, &xHigherPriorityTaskWoken);
+    }
 
     /* Add for ARM errata 838869, affects Cortex-M4, Cortex-M4F Store immediate overlapping
     exception return operation might vector to incorrect interrupt */
     __DSB();
+    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
 }
 
 void init_HR_C6000_interrupts()
 {
+	interruptTimeoutTimer = xTimerCreate("C6000 int", pdMS_TO_TICKS(HRC6000_INTERRUPT_TIMEOUT_MS), pdFALSE, (void *)HRC6000_NOTIFY_TIMEOUT, hrc6000TimeoutCallback);
+	rxTimeoutTimer = xTimerCreate("C6000 rx", pdMS_TO_TICKS(HRC6000_RX_TIMEOUT_MS), pdFALSE, (void *)HRC6000_NOTIFY_RX_TIMEOUT, hrc6000TimeoutCallback);
+	qsodataTimer = xTimerCreate("QSO data", pdMS_TO_TICKS(HRC6000_QSODATA_TIMEOUT_MS), pdFALSE, NULL, qsodataTimeoutCallback);
+
 	init_digital_state();
 
     PORT_SetPinInterruptConfig(Port_INT_C6000_SYS, Pin_INT_C6000_SYS, kPORT_InterruptEitherEdge);
@@ -277,23 +429,16 @@ void init_HR_C6000_interrupts()
 
 void init_digital_state()
 {
-	taskENTER_CRITICAL();
-	int_sys=false;
-	int_ts=false;
-	int_timeout=0;
-	taskEXIT_CRITICAL();
 	slot_state = DMR_STATE_IDLE;
-	tick_cnt=0;
 	skip_count=0;
-	qsodata_timer = 0;
+	xTimerStop(interruptTimeoutTimer, 0);
+	xTimerStop(rxTimeoutTimer, 0);
+	xTimerStop(qsodataTimer, 0);
 }
 
 void init_digital_DMR_RX()
 {
-	write_SPI_page_reg_byte_SPI0(0x04, 0x41, 0x20);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x41, 0x00);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x41, 0x20);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x41, 0x40);
+	write_SPI_page_reg_script_SPI0(hrc6000_dmr_rx_script, SPI_REG_SCRIPT_LENGTH(hrc6000_dmr_rx_script));
 }
 
 void init_digital()
@@ -317,7 +462,7 @@ void terminate_digital()
 void store_qsodata()
 {
 	// If this is the start of a newly received signal, we always need to trigger the display to show this, even if its the same station calling again.
-	if (qsodata_timer==0)
+	if (xTimerIsTimerActive(qsodataTimer)==pdFALSE)
 	{
 		menuDisplayQSODataState = QSO_DISPLAY_CALLER_DATA;
 	}
@@ -326,7 +471,7 @@ void store_qsodata()
 	if (tmp_ram[1] == 0x00  && (tmp_ram[0]==0x00 || (tmp_ram[0]>=0x04 && tmp_ram[0]<=0x7)))
 	{
 		lastHeardListUpdate(tmp_ram);
-		qsodata_timer=2400;
+		xTimerReset(qsodataTimer, 0);
 	}
 }
 
@@ -336,62 +481,135 @@ void init_hrc6000_task()
 				"fw hrc6000 task",                      /* task name for kernel awareness debugging */
 				5000L / sizeof(portSTACK_TYPE),      /* task stack size */
 				NULL,                      			 /* optional task startup argument */
-				5U,                                  /* initial priority */
-				fwhrc6000TaskHandle					 /* optional task handle to create */
+				TASK_PRIORITY_RADIO,                 /* initial priority */
+				&fwhrc6000TaskHandle				 /* optional task handle to create */
 				);
 }
 
+void wakeup_hrc6000_task()
+{
+	if (fwhrc6000TaskHandle != NULL)
+	{
+		xTaskNotify(fwhrc6000TaskHandle, HRC6000_NOTIFY_WAKEUP, eSetBits);
+	}
+}
+
+void reset_hrc6000_latency()
+{
+	taskENTER_CRITICAL();
+	hrc6000IrqCount=0;
+	hrc6000LatencyLast=0;
+	hrc6000LatencyMax=0;
+	hrc6000LatencySum=0;
+	hrc6000TsCount=0;
+	hrc6000TsOverruns=0;
+	taskEXIT_CRITICAL();
+}
+
+static void hrc6000TimeoutCallback(TimerHandle_t xTimer)
+{
+	xTaskNotify(fwhrc6000TaskHandle, (uint32_t)pvTimerGetTimerID(xTimer), eSetBits);
+}
+
+static void qsodataTimeoutCallback(TimerHandle_t xTimer)
+{
+	menuDisplayQSODataState= QSO_DISPLAY_DEFAULT_SCREEN;
+}
+
+static void update_hrc6000_latency()
+{
+	taskENTER_CRITICAL();
+	if (irqTimestampValid)
+	{
+		uint32_t latency = DWT->CYCCNT - irqTimestamp;
+		serviceTimestamp = irqTimestamp;
+		irqTimestampValid = false;
+		hrc6000IrqCount++;
+		hrc6000LatencyLast = latency;
+		hrc6000LatencySum += latency;
+		if (latency > hrc6000LatencyMax)
+		{
+			hrc6000LatencyMax = latency;
+		}
+	}
+	taskEXIT_CRITICAL();
+}
+
+// An interrupt the task does not service in digital mode, in analog mode or while a beep plays, is not a latency sample.
+// Its timestamp would otherwise be measured at the next digital pass, seconds or minutes later.
+static void discard_hrc6000_latency()
+{
+	taskENTER_CRITICAL();
+	irqTimestampValid = false;
+	taskEXIT_CRITICAL();
+}
+
 void fw_hrc6000_task()
 {
+	uint32_t notifiedBits;
+	uint32_t pendingBits = 0;
+	TickType_t lastSquelchCheck = xTaskGetTickCount();
+	TickType_t squelchPeriod = pdMS_TO_TICKS(HRC6000_ANALOG_SQUELCH_MS);
+
     while (1U)
     {
-    	taskENTER_CRITICAL();
-    	uint32_t tmp_timer_hrc6000task=timer_hrc6000task;
-    	taskEXIT_CRITICAL();
-    	if (tmp_timer_hrc6000task==0)
+    	// The end of a melody is polled and the analog squelch is sampled periodically, otherwise sleep until the C6000 interrupts
+    	TickType_t waitTime = pdMS_TO_TICKS(HRC6000_IDLE_WAIT_MS);
+    	if (melody_is_playing())
     	{
-        	taskENTER_CRITICAL();
-        	timer_hrc6000task=10;
-        	alive_hrc6000task=true;
-        	taskEXIT_CRITICAL();
+    		waitTime = pdMS_TO_TICKS(1);
+    	}
+    	else if (trxGetMode() == RADIO_MODE_ANALOG)
+    	{
+    		waitTime = squelchPeriod;
+    	}
 
-    		if (melody_play==NULL)
+    	if (xTaskNotifyWait(0, 0xFFFFFFFF, &notifiedBits, waitTime) == pdTRUE)
+    	{
+    		pendingBits |= notifiedBits;
+    		if (notifiedBits & HRC6000_NOTIFY_TS)
     		{
-    	    	if (trxGetMode() == RADIO_MODE_DIGITAL)
-    	    	{
-    				tick_HR_C6000();
-    	    	}
-    	    	else if (trxGetMode() == RADIO_MODE_ANALOG)
-    	    	{
-    	    		trx_check_analog_squelch();
-    	    	}
+    			tsPending = false;
     		}
     	}
 
-		vTaskDelay(0);
+    	taskENTER_CRITICAL();
+    	alive_hrc6000task=true;
+    	taskEXIT_CRITICAL();
+
+		if (!melody_is_playing())
+		{
+	    	if (trxGetMode() == RADIO_MODE_DIGITAL)
+	    	{
+	    		update_hrc6000_latency();
+				tick_HR_C6000(pendingBits);
+	    	}
+	    	else
+	    	{
+	    		discard_hrc6000_latency();
+	    		if ((trxGetMode() == RADIO_MODE_ANALOG) && ((xTaskGetTickCount() - lastSquelchCheck) >= squelchPeriod))
+	    		{
+	    			lastSquelchCheck = xTaskGetTickCount();
+	    			squelchPeriod = pdMS_TO_TICKS(trx_check_analog_squelch() ? HRC6000_ANALOG_SQUELCH_OPEN_MS : HRC6000_ANALOG_SQUELCH_MS);
+	    		}
+	    	}
+	    	pendingBits = 0;
+		}
+		else
+		{
+			discard_hrc6000_latency();
+		}
     }
 }
 
-void tick_HR_C6000()
+void tick_HR_C6000(uint32_t bits)
 {
-	bool tmp_int_sys=false;
-	bool tmp_int_ts=false;
-	taskENTER_CRITICAL();
-	if (int_sys)
-	{
-		tmp_int_sys=true;
-		int_sys=false;
-	}
-	if (int_ts)
-	{
-		tmp_int_ts=true;
-		int_ts=false;
-	}
-	taskEXIT_CRITICAL();
+	bool tmp_int_sys = (bits & HRC6000_NOTIFY_SYS) != 0;
+	bool tmp_int_ts = (bits & HRC6000_NOTIFY_TS) != 0;
 
 	if (trxIsTransmitting==true && (slot_state == DMR_STATE_IDLE)) // Start TX (first step)
 	{
-		init_codec();
+		init_codec_tx();
 		uint8_t spi_tx[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
 		spi_tx[3] = (trxTalkGroup >> 16) & 0xFF;
 		spi_tx[4] = (trxTalkGroup >> 8) & 0xFF;
@@ -400,32 +618,18 @@ void tick_HR_C6000()
 		spi_tx[7] = (trxDMRID >> 8) & 0xFF;
 		spi_tx[8] = (trxDMRID >> 0) & 0xFF;
 		write_SPI_page_reg_bytearray_SPI0(0x02, 0x00, spi_tx, 0x0c);
-		write_SPI_page_reg_byte_SPI0(0x04, 0x40, 0xE3); // TX and RX enable
-		write_SPI_page_reg_byte_SPI0(0x04, 0x21, 0xA2); // reset vocoder codingbuffer
-		write_SPI_page_reg_byte_SPI0(0x04, 0x22, 0x86); // I2S master encode start
+		write_SPI_page_reg_script_SPI0(hrc6000_tx_start_script, SPI_REG_SCRIPT_LENGTH(hrc6000_tx_start_script));
 		slot_state = DMR_STATE_TX_START_1;
 	}
 
 	// Timeout interrupt
-	if (slot_state != DMR_STATE_IDLE)
+	if ((bits & HRC6000_NOTIFY_TIMEOUT) && !(bits & HRC6000_NOTIFY_IRQ_MASK) && (slot_state != DMR_STATE_IDLE))
 	{
-		if (int_timeout<200)
-		{
-			int_timeout++;
-			if (int_timeout==200)
-			{
-	            	init_digital();
-	            	slot_state = DMR_STATE_IDLE;
-	            	int_timeout=0;
+		init_digital();
+		slot_state = DMR_STATE_IDLE;
 #if defined(USE_SEGGER_RTT) && defined(DEBUG_DMR_DATA)
-            	SEGGER_RTT_printf(0, ">>> INTERRUPT TIMEOUT\r\n");
+		SEGGER_RTT_printf(0, ">>> INTERRUPT TIMEOUT\r\n");
 #endif
-			}
-		}
-	}
-	else
-	{
-		int_timeout=0;
 	}
 
 	if (tmp_int_ts)
@@ -450,8 +654,7 @@ void tick_HR_C6000()
 			slot_state = DMR_STATE_IDLE;
 			break;
 		case DMR_STATE_TX_START_1: // Start TX (second step)
-			write_SPI_page_reg_byte_SPI0(0x04, 0x41, 0x80);
-			write_SPI_page_reg_byte_SPI0(0x04, 0x50, 0x10);
+			write_SPI_page_reg_script_SPI0(hrc6000_tx_next_slot_script, SPI_REG_SCRIPT_LENGTH(hrc6000_tx_next_slot_script));
 			slot_state = DMR_STATE_TX_START_2;
 			break;
 		case DMR_STATE_TX_START_2: // Start TX (third step)
@@ -459,8 +662,7 @@ void tick_HR_C6000()
 			slot_state = DMR_STATE_TX_START_3;
 			break;
 		case DMR_STATE_TX_START_3: // Start TX (fourth step)
-			write_SPI_page_reg_byte_SPI0(0x04, 0x41, 0x80);
-			write_SPI_page_reg_byte_SPI0(0x04, 0x50, 0x10);
+			write_SPI_page_reg_script_SPI0(hrc6000_tx_next_slot_script, SPI_REG_SCRIPT_LENGTH(hrc6000_tx_next_slot_script));
 			slot_state = DMR_STATE_TX_START_4;
 			break;
 		case DMR_STATE_TX_START_4: // Start TX (fifth step)
@@ -469,8 +671,7 @@ void tick_HR_C6000()
 			break;
 		case DMR_STATE_TX_START_5: // Start TX (sixth step)
 			tick_TXsoundbuffer();
-			write_SPI_page_reg_byte_SPI0(0x04, 0x41, 0x80);
-			write_SPI_page_reg_byte_SPI0(0x04, 0x50, 0x10);
+			write_SPI_page_reg_script_SPI0(hrc6000_tx_next_slot_script, SPI_REG_SCRIPT_LENGTH(hrc6000_tx_next_slot_script));
 			tx_sequence=0;
 			slot_state = DMR_STATE_TX_1;
 			break;
@@ -488,7 +689,7 @@ void tick_HR_C6000()
 		case DMR_STATE_TX_2: // Ongoing TX (active timeslot)
 			tick_TXsoundbuffer();
 			tick_codec_encode(tmp_ram);
-			write_SPI_page_reg_bytearray_SPI1(0x03, 0x00, tmp_ram, 27);
+			write_SPI_page_reg_bytearray_SPI1_start(0x03, 0x00, tmp_ram, 27);// the AMBE frame goes out on SPI1 while SPI0 is set up
 			write_SPI_page_reg_byte_SPI0(0x04, 0x41, 0x80); // TXnextslotenable
 			switch (tx_sequence)
 			{
@@ -516,11 +717,11 @@ void tick_HR_C6000()
 			{
 				tx_sequence=0;
 			}
+			SPI_wait_SPI1();
 			slot_state = DMR_STATE_TX_1;
 			break;
 		case DMR_STATE_TX_END_1: // Stop TX (first step)
-			write_SPI_page_reg_byte_SPI0(0x04, 0x41, 0x80);
-			write_SPI_page_reg_byte_SPI0(0x04, 0x50, 0x20);
+			write_SPI_page_reg_script_SPI0(hrc6000_tx_end_script, SPI_REG_SCRIPT_LENGTH(hrc6000_tx_end_script));
 			slot_state = DMR_STATE_TX_END_2;
 			break;
 		case DMR_STATE_TX_END_2: // Stop TX (second step)
@@ -531,18 +732,15 @@ void tick_HR_C6000()
 			break;
 		}
 
-		// Timeout interrupted RX
-    	if ((slot_state < DMR_STATE_TX_START_1) && (tick_cnt<10))
-    	{
-    		tick_cnt++;
-            if (tick_cnt==10)
-            {
-            	slot_state = DMR_STATE_RX_END;
+	}
+
+	// Timeout interrupted RX
+	if ((bits & HRC6000_NOTIFY_RX_TIMEOUT) && (slot_state < DMR_STATE_TX_START_1))
+	{
+		slot_state = DMR_STATE_RX_END;
 #if defined(USE_SEGGER_RTT) && defined(DEBUG_DMR_DATA)
-            	SEGGER_RTT_printf(0, ">>> TIMEOUT\r\n");
+		SEGGER_RTT_printf(0, ">>> TIMEOUT\r\n");
 #endif
-            }
-    	}
 	}
 
 	if (tmp_int_sys)
@@ -551,8 +749,14 @@ void tick_HR_C6000()
 		read_SPI_page_reg_byte_SPI0(0x04, 0x86, &tmp_val_0x86);
 		read_SPI_page_reg_byte_SPI0(0x04, 0x51, &tmp_val_0x51);
 		read_SPI_page_reg_byte_SPI0(0x04, 0x52, &tmp_val_0x52);
-		read_SPI_page_reg_byte_SPI0(0x04, 0x57, &tmp_val_0x57);
-		read_SPI_page_reg_byte_SPI0(0x04, 0x5f, &tmp_val_0x5f);
+#if !(defined(USE_SEGGER_RTT) && defined(DEBUG_DMR_DATA))
+		if (HR_C6000_datalogging)
+#endif
+		{
+			// Only needed for the logging
+			read_SPI_page_reg_byte_SPI0(0x04, 0x57, &tmp_val_0x57);
+			read_SPI_page_reg_byte_SPI0(0x04, 0x5f, &tmp_val_0x5f);
+		}
 		read_SPI_page_reg_bytearray_SPI0(0x02, 0x00, tmp_ram, 0x0c);
 
 		// Check for correct received packet
@@ -582,8 +786,11 @@ void tick_HR_C6000()
                 {
                 	slot_state = DMR_STATE_RX_1;
                 	store_qsodata();
-                	init_codec();
-                	skip_count = 2;
+                	init_codec_rx();
+                	codec_mark_late_entry(serviceTimestamp);
+                	codec_ber_start_call((tmp_ram[6]<<16)+(tmp_ram[7]<<8)+(tmp_ram[8]<<0));
+                	rxFirstVoice = true;
+                	skip_count = 1;// start at the next voice sync burst
 #if defined(USE_SEGGER_RTT) && defined(DEBUG_DMR_DATA)
             	SEGGER_RTT_printf(0, ">>> START LATE\r\n");
 #endif
@@ -606,7 +813,7 @@ void tick_HR_C6000()
     		if (tmp_val_0x82 & 0x08) // InterRecvData
     		{
     			// Reset RX timeout
-    			tick_cnt = 0;
+    			xTimerReset(rxTimeoutTimer, 0);
 
     			// Start RX
     			int rxdt = (tmp_val_0x51 >> 4) & 0x0f;
@@ -615,7 +822,9 @@ void tick_HR_C6000()
                 {
                 	slot_state = DMR_STATE_RX_1;
                 	store_qsodata();
-                	init_codec();
+                	init_codec_rx();
+                	codec_ber_start_call((tmp_ram[6]<<16)+(tmp_ram[7]<<8)+(tmp_ram[8]<<0));
+                	rxFirstVoice = true;
                 	skip_count = 0;
 #if defined(USE_SEGGER_RTT) && defined(DEBUG_DMR_DATA)
             	SEGGER_RTT_printf(0, ">>> START\r\n");
@@ -640,8 +849,38 @@ void tick_HR_C6000()
                 {
                 	store_qsodata();
                     read_SPI_page_reg_bytearray_SPI1(0x03, 0x00, tmp_ram, 27);
-                	tick_codec_decode(tmp_ram);
-                	tick_RXsoundbuffer();
+                    if (rxFirstVoice)
+                    {
+                    	mark_rx_audio_start(serviceTimestamp);
+                    	rxFirstVoice = false;
+                    }
+                    else
+                    {
+                    	// Voice bursts A to F follow each other every 60 ms, each missing one is 3 AMBE frames lost.
+                    	// The burst letters only give the gap modulo 6, the time since the last burst adds whole superframes.
+                    	uint32_t burstCycles = (SystemCoreClock / 1000U) * HRC6000_VOICE_BURST_MS;
+                    	uint32_t bursts = ((serviceTimestamp - rxLastVoiceTimestamp) + (burstCycles / 2)) / burstCycles;
+                    	uint32_t lost = ((rxdt & 0x07) + 11 - rxLastVoiceBurst) % 6;
+
+                    	if (bursts > (lost + 1))
+                    	{
+                    		lost += 6 * ((bursts - (lost + 1) + 3) / 6);
+                    	}
+                    	codec_ber_add_lost(3 * lost);
+                    }
+                    rxLastVoiceBurst = rxdt & 0x07;
+                    rxLastVoiceTimestamp = serviceTimestamp;
+                    rx_audio_burst_arrived(serviceTimestamp);
+                	tick_codec_decode(tmp_ram);// starts playback by itself once the jitter target is buffered
+
+                	// The last heard entry is updated once per superframe
+                	if (rxLastVoiceBurst == 0x06)
+                	{
+                		int ber;
+                		int frameLoss;
+                		int id = codec_ber_link_quality(&ber, &frameLoss);
+                		lastHeardUpdateLinkQuality(id, ber, frameLoss);
+                	}
                 }
 
 #if defined(USE_SEGGER_RTT) && defined(DEBUG_DMR_DATA)
@@ -694,12 +933,16 @@ void tick_HR_C6000()
         }
 	}
 
-	if (qsodata_timer>0)
+	// Any C6000 interrupt restarts the interrupt timeout, which only runs while not idle
+	if (slot_state != DMR_STATE_IDLE)
 	{
-		qsodata_timer--;
-		if (qsodata_timer==0)
+		if ((bits & HRC6000_NOTIFY_IRQ_MASK) || (xTimerIsTimerActive(interruptTimeoutTimer)==pdFALSE))
 		{
-			menuDisplayQSODataState= QSO_DISPLAY_DEFAULT_SCREEN;
+			xTimerReset(interruptTimeoutTimer, 0);
 		}
 	}
+	else if (xTimerIsTimerActive(interruptTimeoutTimer)!=pdFALSE)
+	{
+		xTimerStop(interruptTimeoutTimer, 0);
+	}
 }
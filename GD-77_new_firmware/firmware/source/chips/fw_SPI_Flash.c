@@ -25,6 +25,40 @@ static uint8_t spi_flash_transfer(uint8_t c);
 static void spi_flash_setWriteEnable(bool cmd);
 static void spi_flash_enable();
 static void spi_flash_disable();
+static void spi_flash_lock();
+static void spi_flash_unlock();
+static void spi_flash_write_buf(const uint8_t *buf,int size);
+static void spi_flash_read_buf(uint8_t *buf,int size);
+static bool spi_flash_fast_read(uint32_t addr,uint8_t *dataBuf,int size);
+static void spi_flash_cache_invalidate(uint32_t addr,int size);
+static void spi_flash_cache_invalidate_all();
+
+// The flash is shared by the UI and USB tasks
+static SemaphoreHandle_t spiFlashMutex = NULL;
+
+// Least recently used cache of whole flash pages, only accessed with the flash locked
+#define SPI_FLASH_PAGE_SIZE     256
+#define SPI_FLASH_CACHE_PAGES   8
+#define SPI_FLASH_CACHE_BYPASS  (SPI_FLASH_PAGE_SIZE * 2) // longer reads are streamed past the cache
+
+typedef struct
+{
+	uint32_t page;// address >> 8, SPI_FLASH_CACHE_EMPTY if unused
+	uint32_t lastUse;
+	uint8_t data[SPI_FLASH_PAGE_SIZE];
+} spi_flash_cache_page_t;
+
+#define SPI_FLASH_CACHE_EMPTY 0xFFFFFFFF
+
+static spi_flash_cache_page_t spiFlashCache[SPI_FLASH_CACHE_PAGES];
+static uint32_t spiFlashCacheUseCounter = 0;
+// A miss only loads the whole page when the read follows on from the previous one, or the page missed last time too.
+// Other short reads are read straight from the flash, a random 16 byte lookup shouldn't clock in 256 bytes.
+static uint32_t spiFlashNextReadAddr = SPI_FLASH_CACHE_EMPTY;
+static uint32_t spiFlashLastMissPage = SPI_FLASH_CACHE_EMPTY;
+
+volatile uint32_t spiFlashCacheHits = 0;
+volatile uint32_t spiFlashCacheMisses = 0;
 
 //COMMANDS. Not all implemented or used
 #define W_EN 			0x06	//write enable
@@ -57,6 +91,13 @@ static void spi_flash_disable();
 bool SPI_Flash_init()
 {
 	int partNumber;
+
+	if (spiFlashMutex == NULL)
+	{
+		spiFlashMutex = xSemaphoreCreateMutex();
+	}
+	spi_flash_cache_invalidate_all();
+
     PORT_SetPinMux(Port_SPI_FLASH_CS_U, Pin_SPI_FLASH_CS_U, kPORT_MuxAsGpio);//CS
     GPIO_PinInit(GPIO_SPI_FLASH_CS_U, Pin_SPI_FLASH_CS_U, &pin_config_output);
 
@@ -85,23 +126,210 @@ bool SPI_Flash_init()
     }
 }
 
+static spi_flash_cache_page_t *spi_flash_cache_find(uint32_t page)
+{
+	for (int i=0; i<SPI_FLASH_CACHE_PAGES; i++)
+	{
+		if (spiFlashCache[i].page == page)
+		{
+			spiFlashCacheHits++;
+			spiFlashCache[i].lastUse = ++spiFlashCacheUseCounter;
+			return &spiFlashCache[i];
+		}
+	}
+	spiFlashCacheMisses++;
+	return NULL;
+}
+
+// Replace the least recently used page
+static spi_flash_cache_page_t *spi_flash_cache_fill(uint32_t page)
+{
+	spi_flash_cache_page_t *entry = &spiFlashCache[0];
+
+	for (int i=1; i<SPI_FLASH_CACHE_PAGES; i++)
+	{
+		if (spiFlashCache[i].lastUse < entry->lastUse)
+		{
+			entry = &spiFlashCache[i];
+		}
+	}
+
+	entry->page = SPI_FLASH_CACHE_EMPTY;
+	if (!spi_flash_fast_read(page * SPI_FLASH_PAGE_SIZE, entry->data, SPI_FLASH_PAGE_SIZE))
+	{
+		return NULL;
+	}
+	entry->page = page;
+	entry->lastUse = ++spiFlashCacheUseCounter;
+	return entry;
+}
+
+static void spi_flash_cache_invalidate(uint32_t addr,int size)
+{
+	for (int i=0; i<SPI_FLASH_CACHE_PAGES; i++)
+	{
+		if ((spiFlashCache[i].page >= addr / SPI_FLASH_PAGE_SIZE) && (spiFlashCache[i].page <= (addr + size - 1) / SPI_FLASH_PAGE_SIZE))
+		{
+			spiFlashCache[i].page = SPI_FLASH_CACHE_EMPTY;
+			spiFlashCache[i].lastUse = 0;
+		}
+	}
+}
+
+static void spi_flash_cache_invalidate_all()
+{
+	for (int i=0; i<SPI_FLASH_CACHE_PAGES; i++)
+	{
+		spiFlashCache[i].page = SPI_FLASH_CACHE_EMPTY;
+		spiFlashCache[i].lastUse = 0;
+	}
+	spiFlashNextReadAddr = SPI_FLASH_CACHE_EMPTY;
+	spiFlashLastMissPage = SPI_FLASH_CACHE_EMPTY;
+}
+
 // Returns false for failed
-// Note. There is no error checking that the device is not initially busy.
+// Short reads are served from the page cache where it pays, long ones are streamed straight from the flash
 bool SPI_Flash_read(uint32_t addr,uint8_t *dataBuf,int size)
 {
-  uint8_t commandBuf[4]= {READ,addr>>16,addr>>8,addr} ;// command
-  if(spi_flash_busy())
-  {
-    return false;
-  }
-  spi_flash_enable();
-  spi_flash_transfer_buf(commandBuf,commandBuf,4);
-  for(int i=0;i<size;i++)
-  {
-	  *dataBuf++ = spi_flash_transfer(0x00);
-  }
-  spi_flash_disable();
-  return true;
+	bool ok = true;
+
+	spi_flash_lock();
+	if (size > SPI_FLASH_CACHE_BYPASS)
+	{
+		ok = spi_flash_fast_read(addr, dataBuf, size);
+	}
+	else
+	{
+		bool sequential = (addr == spiFlashNextReadAddr);
+
+		spiFlashNextReadAddr = addr + size;
+		while ((size > 0) && ok)
+		{
+			uint32_t page = addr / SPI_FLASH_PAGE_SIZE;
+			spi_flash_cache_page_t *entry = spi_flash_cache_find(page);
+			int offset = addr % SPI_FLASH_PAGE_SIZE;
+			int length = SPI_FLASH_PAGE_SIZE - offset;
+
+			if (length > size)
+			{
+				length = size;
+			}
+			if (entry == NULL)
+			{
+				if (sequential || (page == spiFlashLastMissPage))
+				{
+					entry = spi_flash_cache_fill(page);
+					ok = (entry != NULL);
+				}
+				else
+				{
+					spiFlashLastMissPage = page;
+					ok = spi_flash_fast_read(addr, dataBuf, length);
+				}
+			}
+			if (entry != NULL)
+			{
+				memcpy(dataBuf, &entry->data[offset], length);
+			}
+			dataBuf += length;
+			addr += length;
+			size -= length;
+		}
+	}
+	spi_flash_unlock();
+	return ok;
+}
+
+// Note. There is no error checking that the device is not initially busy.
+static bool spi_flash_fast_read(uint32_t addr,uint8_t *dataBuf,int size)
+{
+	const uint8_t commandBuf[5]= {FAST_READ,addr>>16,addr>>8,addr,0x00} ;// command, address and one dummy byte
+
+	if(spi_flash_busy())
+	{
+		return false;
+	}
+	spi_flash_enable();
+	spi_flash_write_buf(commandBuf,5);
+	spi_flash_read_buf(dataBuf,size);
+	spi_flash_disable();
+	return true;
+}
+
+void SPI_Flash_resetCacheStats()
+{
+	taskENTER_CRITICAL();
+	spiFlashCacheHits = 0;
+	spiFlashCacheMisses = 0;
+	taskEXIT_CRITICAL();
+}
+
+// Read throughput in KB/s, of the original READ command byte loop and of the current driver
+void SPI_Flash_benchmark(spiFlashBenchmark_t *result)
+{
+	uint8_t buf[128];
+	uint32_t startCycles;
+	uint32_t cycles;
+	uint32_t seed;
+
+	// Sequential, 4k in 128 byte reads
+	spi_flash_lock();
+	startCycles = DWT->CYCCNT;
+	for (uint32_t addr=0; addr<4096; addr+=sizeof(buf))
+	{
+		uint8_t commandBuf[4]= {READ,addr>>16,addr>>8,addr} ;
+		spi_flash_enable();
+		spi_flash_transfer_buf(commandBuf,commandBuf,4);
+		for(int i=0;i<sizeof(buf);i++)
+		{
+			buf[i] = spi_flash_transfer(0x00);
+		}
+		spi_flash_disable();
+	}
+	cycles = DWT->CYCCNT - startCycles;
+	result->legacySequential = (uint32_t)(((uint64_t)4 * SystemCoreClock) / cycles);
+
+	spi_flash_cache_invalidate_all();
+	spi_flash_unlock();
+	startCycles = DWT->CYCCNT;
+	for (uint32_t addr=0; addr<4096; addr+=sizeof(buf))
+	{
+		SPI_Flash_read(addr, buf, sizeof(buf));
+	}
+	cycles = DWT->CYCCNT - startCycles;
+	result->sequential = (uint32_t)(((uint64_t)4 * SystemCoreClock) / cycles);
+
+	// Random, 256 reads of 16 bytes within 16k, like the codeplug and DMR ID lookups
+	spi_flash_lock();
+	seed = 1;
+	startCycles = DWT->CYCCNT;
+	for (int n=0; n<256; n++)
+	{
+		seed = seed * 1103515245 + 12345;
+		uint32_t addr = (seed >> 8) & 0x3FF0;
+		uint8_t commandBuf[4]= {READ,addr>>16,addr>>8,addr} ;
+		spi_flash_enable();
+		spi_flash_transfer_buf(commandBuf,commandBuf,4);
+		for(int i=0;i<16;i++)
+		{
+			buf[i] = spi_flash_transfer(0x00);
+		}
+		spi_flash_disable();
+	}
+	cycles = DWT->CYCCNT - startCycles;
+	result->legacyRandom = (uint32_t)(((uint64_t)4 * SystemCoreClock) / cycles);
+
+	spi_flash_cache_invalidate_all();
+	spi_flash_unlock();
+	seed = 1;
+	startCycles = DWT->CYCCNT;
+	for (int n=0; n<256; n++)
+	{
+		seed = seed * 1103515245 + 12345;
+		SPI_Flash_read((seed >> 8) & 0x3FF0, buf, 16);
+	}
+	cycles = DWT->CYCCNT - startCycles;
+	result->random = (uint32_t)(((uint64_t)4 * SystemCoreClock) / cycles);
 }
 
 int SPI_Flash_readStatusRegister()
@@ -143,16 +371,14 @@ bool SPI_Flash_writePage(uint32_t addr_start,uint8_t *dataBuf)
 	int waitCounter = 5;// Worst case is something like 3mS
 	uint8_t commandBuf[4]= {PAGE_PGM,addr_start>>16,addr_start>>8,0x00} ;
 
+	spi_flash_lock();
+	spi_flash_cache_invalidate(addr_start & ~0xFF, SPI_FLASH_PAGE_SIZE);
 	spi_flash_setWriteEnable(true);
 
 	spi_flash_enable();
 
-	spi_flash_transfer_buf(commandBuf,commandBuf,4);// send the command and the address
-
-	for(int i=0;i<0x100;i++)
-	{
-		spi_flash_transfer(*dataBuf++);
-	}
+	spi_flash_write_buf(commandBuf,4);// send the command and the address
+	spi_flash_write_buf(dataBuf,0x100);
 
 	spi_flash_disable();
 
@@ -161,6 +387,7 @@ bool SPI_Flash_writePage(uint32_t addr_start,uint8_t *dataBuf)
 	    vTaskDelay(portTICK_PERIOD_MS * 1);
 		isBusy = spi_flash_busy();
 	} while (waitCounter-->0 && isBusy);
+	spi_flash_unlock();
 
 	return !isBusy;
 }
@@ -171,6 +398,8 @@ bool SPI_Flash_eraseSector(uint32_t addr_start)
 	int waitCounter=500;// erase can take up to 500 mS
 	bool isBusy;
 	uint8_t commandBuf[4]= {SECTOR_E,addr_start>>16,addr_start>>8,0x00} ;
+	spi_flash_lock();
+	spi_flash_cache_invalidate(addr_start & ~0xFFF, 4096);
 	spi_flash_enable();
 	spi_flash_setWriteEnable(true);
 	spi_flash_disable();
@@ -184,9 +413,26 @@ bool SPI_Flash_eraseSector(uint32_t addr_start)
 	    vTaskDelay(portTICK_PERIOD_MS * 1);
 		isBusy = spi_flash_busy();
 	} while (waitCounter-->0 && isBusy);
+	spi_flash_unlock();
 	return !isBusy;// If still busy after
 }
 
+static void spi_flash_lock()
+{
+	if ((spiFlashMutex != NULL) && (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING))
+	{
+		xSemaphoreTake(spiFlashMutex, portMAX_DELAY);
+	}
+}
+
+static void spi_flash_unlock()
+{
+	if ((spiFlashMutex != NULL) && (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING))
+	{
+		xSemaphoreGive(spiFlashMutex);
+	}
+}
+
 static void spi_flash_enable()
 {
 	GPIO_PinWrite(GPIO_SPI_FLASH_CS_U, Pin_SPI_FLASH_CS_U, 0);
@@ -230,6 +476,67 @@ static void spi_flash_transfer_buf(uint8_t *inBuf,uint8_t *outBuf,int size)
 	}
 }
 
+// Transfer engine for the bulk data. The directions are handled separately, so a write does not sample
+// the input and a read does not drive the output, and the bit loops are unrolled.
+#define SPI_FLASH_CLK_MASK (1U << Pin_SPI_FLASH_CLK_U)
+#define SPI_FLASH_DO_MASK  (1U << Pin_SPI_FLASH_DO_U)
+
+#define SPI_FLASH_WRITE_BIT(c, bit) \
+	GPIO_SPI_FLASH_CLK_U->PCOR = SPI_FLASH_CLK_MASK; \
+	if ((c) & (1U << (bit))) \
+	{ \
+		GPIO_SPI_FLASH_DO_U->PSOR = SPI_FLASH_DO_MASK; \
+	} \
+	else \
+	{ \
+		GPIO_SPI_FLASH_DO_U->PCOR = SPI_FLASH_DO_MASK; \
+	} \
+	GPIO_SPI_FLASH_CLK_U->PSOR = SPI_FLASH_CLK_MASK;
+
+#define SPI_FLASH_READ_BIT(w) \
+	GPIO_SPI_FLASH_CLK_U->PCOR = SPI_FLASH_CLK_MASK; \
+	__asm volatile( "nop" ); \
+	w = (w << 1) | ((GPIO_SPI_FLASH_DI_U->PDIR >> Pin_SPI_FLASH_DI_U) & 0x01U); \
+	GPIO_SPI_FLASH_CLK_U->PSOR = SPI_FLASH_CLK_MASK;
+
+#define SPI_FLASH_READ_BYTE(w) \
+	SPI_FLASH_READ_BIT(w) SPI_FLASH_READ_BIT(w) SPI_FLASH_READ_BIT(w) SPI_FLASH_READ_BIT(w) \
+	SPI_FLASH_READ_BIT(w) SPI_FLASH_READ_BIT(w) SPI_FLASH_READ_BIT(w) SPI_FLASH_READ_BIT(w)
+
+static void spi_flash_write_buf(const uint8_t *buf,int size)
+{
+	while(size-->0)
+	{
+		uint32_t c = *buf++;
+		SPI_FLASH_WRITE_BIT(c, 7) SPI_FLASH_WRITE_BIT(c, 6) SPI_FLASH_WRITE_BIT(c, 5) SPI_FLASH_WRITE_BIT(c, 4)
+		SPI_FLASH_WRITE_BIT(c, 3) SPI_FLASH_WRITE_BIT(c, 2) SPI_FLASH_WRITE_BIT(c, 1) SPI_FLASH_WRITE_BIT(c, 0)
+	}
+}
+
+static void spi_flash_read_buf(uint8_t *buf,int size)
+{
+	uint32_t w = 0;
+
+	GPIO_SPI_FLASH_DO_U->PCOR = SPI_FLASH_DO_MASK;
+
+	// A word at a time, then the remaining bytes
+	while (size >= 4)
+	{
+		SPI_FLASH_READ_BYTE(w) SPI_FLASH_READ_BYTE(w) SPI_FLASH_READ_BYTE(w) SPI_FLASH_READ_BYTE(w)
+		buf[0] = w >> 24;
+		buf[1] = w >> 16;
+		buf[2] = w >> 8;
+		buf[3] = w;
+		buf += 4;
+		size -= 4;
+	}
+	while (size-- > 0)
+	{
+		SPI_FLASH_READ_BYTE(w)
+		*buf++ = w;
+	}
+}
+
 static bool spi_flash_busy()
 {
   uint8_t r1;
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C)2019 Kai Ludwig, DG4KLU
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+#include "fw_codec_ber.h"
+
+static codecBerCall_t codecBerCalls[CODEC_BER_CALLS];
+static int codecBerCurrent = 0;
+
+// Called from the HR-C6000 task when a transmission starts, the oldest record is reused
+void codec_ber_start_call(int id)
+{
+	taskENTER_CRITICAL();
+	codecBerCurrent = (codecBerCurrent + 1) % CODEC_BER_CALLS;
+	memset(&codecBerCalls[codecBerCurrent], 0, sizeof(codecBerCall_t));
+	codecBerCalls[codecBerCurrent].id = id;
+	taskEXIT_CRITICAL();
+}
+
+// Called from the decoder with the data bits corrected in C0 and C1 of one AMBE frame
+void codec_ber_add_frame(int bitErrors)
+{
+	codecBerCall_t *call = &codecBerCalls[codecBerCurrent];
+
+	call->frames++;
+	call->bitErrors += bitErrors;
+	if (bitErrors >= CODEC_BER_HISTOGRAM_BINS)
+	{
+		bitErrors = CODEC_BER_HISTOGRAM_BINS - 1;
+	}
+	call->histogram[bitErrors]++;
+}
+
+void codec_ber_add_lost(int frames)
+{
+	codecBerCalls[codecBerCurrent].lostFrames += frames;
+}
+
+// BER and frame loss of the current transmission in 0.1 % units, returns its DMR ID
+int codec_ber_link_quality(int *ber, int *frameLoss)
+{
+	codecBerCall_t *call = &codecBerCalls[codecBerCurrent];
+	uint32_t frames = call->frames + call->lostFrames;
+
+	*ber = (call->frames > 0) ? ((call->bitErrors * 1000) / (call->frames * CODEC_BER_BITS_PER_FRAME)) : 0;
+	*frameLoss = (frames > 0) ? ((call->lostFrames * 1000) / frames) : 0;
+
+	return call->id;
+}
+
+// age 0 is the current or last transmission
+bool codec_ber_get_call(int age, codecBerCall_t *call)
+{
+	if ((age < 0) || (age >= CODEC_BER_CALLS))
+	{
+		return false;
+	}
+	taskENTER_CRITICAL();
+	*call = codecBerCalls[(codecBerCurrent + CODEC_BER_CALLS - age) % CODEC_BER_CALLS];
+	taskEXIT_CRITICAL();
+
+	return true;
+}
@@ -19,11 +19,20 @@
 
 #include "fw_mbelib.h"
 
-const int golayGenerator[12] = {
-  0x63a, 0x31d, 0x7b4, 0x3da, 0x1ed, 0x6cc, 0x366, 0x1b3, 0x6e3, 0x54b, 0x49f, 0x475
+/*
+ * The 72 bit AMBE frame is handled as four packed codewords, bit n of ambe_fr[i] holds
+ * what mbelib keeps in the char array ambe_fr[i][n].
+ */
+
+// Parity of the 12 Golay data bits, one table per nibble
+static const uint16_t golayParity[3][16] = {
+  { 0x000, 0x475, 0x49f, 0x0ea, 0x54b, 0x13e, 0x1d4, 0x5a1, 0x6e3, 0x296, 0x27c, 0x609, 0x3a8, 0x7dd, 0x737, 0x342 },
+  { 0x000, 0x1b3, 0x366, 0x2d5, 0x6cc, 0x77f, 0x5aa, 0x419, 0x1ed, 0x05e, 0x28b, 0x338, 0x721, 0x692, 0x447, 0x5f4 },
+  { 0x000, 0x3da, 0x7b4, 0x46e, 0x31d, 0x0c7, 0x4a9, 0x773, 0x63a, 0x5e0, 0x18e, 0x254, 0x527, 0x6fd, 0x293, 0x149 }
 };
 
-const int golayMatrix[2048] = {
+// Error pattern of the 12 data bits for each of the 2048 syndromes
+static const uint16_t golayMatrix[2048] = {
   0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 72, 0, 0, 0, 0, 0, 0, 0, 2084, 0, 0, 0, 769, 0, 1024, 144,
   2, 0, 0, 0, 0, 0, 0, 0, 72, 0, 0, 0, 72, 0, 72, 72, 72, 0, 0, 0, 16, 0, 1, 1538, 384, 0, 134, 2048, 1056, 288,
   2576, 5, 72, 0, 0, 0, 0, 0, 0, 0, 1280, 0, 0, 0, 4, 0, 546, 144, 2049, 0, 0, 0, 66, 0, 1, 144, 520, 0, 2056, 144,
@@ -96,228 +105,433 @@ const int golayMatrix[2048] = {
 };
 
 /*
- * DMR AMBE interleave schedule
+ * DMR AMBE interleave schedule. The frame is taken a nibble at a time, MSB first,
+ * each entry holds the bits the nibble value contributes to the four codewords.
  */
-
-const int rW[36] = {
-  0, 1, 0, 1, 0, 1,
-  0, 1, 0, 1, 0, 1,
-  0, 1, 0, 1, 0, 1,
-  0, 1, 0, 1, 0, 2,
-  0, 2, 0, 2, 0, 2,
-  0, 2, 0, 2, 0, 2
-};
-
-const int rX[36] = {
-  23, 10, 22, 9, 21, 8,
-  20, 7, 19, 6, 18, 5,
-  17, 4, 16, 3, 15, 2,
-  14, 1, 13, 0, 12, 10,
-  11, 9, 10, 8, 9, 7,
-  8, 6, 7, 5, 6, 4
+static const uint32_t ambeDeinterleave[18][16][4] = {
+  {
+    { 0x000000, 0x000000, 0x000000, 0x000000 },
+    { 0x000000, 0x000000, 0x000008, 0x000000 },
+    { 0x000000, 0x000400, 0x000000, 0x000000 },
+    { 0x000000, 0x000400, 0x000008, 0x000000 },
+    { 0x000020, 0x000000, 0x000000, 0x000000 },
+    { 0x000020, 0x000000, 0x000008, 0x000000 },
+    { 0x000020, 0x000400, 0x000000, 0x000000 },
+    { 0x000020, 0x000400, 0x000008, 0x000000 },
+    { 0x800000, 0x000000, 0x000000, 0x000000 },
+    { 0x800000, 0x000000, 0x000008, 0x000000 },
+    { 0x800000, 0x000400, 0x000000, 0x000000 },
+    { 0x800000, 0x000400, 0x000008, 0x000000 },
+    { 0x800020, 0x000000, 0x000000, 0x000000 },
+    { 0x800020, 0x000000, 0x000008, 0x000000 },
+    { 0x800020, 0x000400, 0x000000, 0x000000 },
+    { 0x800020, 0x000400, 0x000008, 0x000000 }
+  },
+  {
+    { 0x000000, 0x000000, 0x000000, 0x000000 },
+    { 0x000000, 0x000000, 0x000004, 0x000000 },
+    { 0x000000, 0x000200, 0x000000, 0x000000 },
+    { 0x000000, 0x000200, 0x000004, 0x000000 },
+    { 0x000010, 0x000000, 0x000000, 0x000000 },
+    { 0x000010, 0x000000, 0x000004, 0x000000 },
+    { 0x000010, 0x000200, 0x000000, 0x000000 },
+    { 0x000010, 0x000200, 0x000004, 0x000000 },
+    { 0x400000, 0x000000, 0x000000, 0x000000 },
+    { 0x400000, 0x000000, 0x000004, 0x000000 },
+    { 0x400000, 0x000200, 0x000000, 0x000000 },
+    { 0x400000, 0x000200, 0x000004, 0x000000 },
+    { 0x400010, 0x000000, 0x000000, 0x000000 },
+    { 0x400010, 0x000000, 0x000004, 0x000000 },
+    { 0x400010, 0x000200, 0x000000, 0x000000 },
+    { 0x400010, 0x000200, 0x000004, 0x000000 }
+  },
+  {
+    { 0x000000, 0x000000, 0x000000, 0x000000 },
+    { 0x000000, 0x000000, 0x000002, 0x000000 },
+    { 0x000000, 0x000100, 0x000000, 0x000000 },
+    { 0x000000, 0x000100, 0x000002, 0x000000 },
+    { 0x000008, 0x000000, 0x000000, 0x000000 },
+    { 0x000008, 0x000000, 0x000002, 0x000000 },
+    { 0x000008, 0x000100, 0x000000, 0x000000 },
+    { 0x000008, 0x000100, 0x000002, 0x000000 },
+    { 0x200000, 0x000000, 0x000000, 0x000000 },
+    { 0x200000, 0x000000, 0x000002, 0x000000 },
+    { 0x200000, 0x000100, 0x000000, 0x000000 },
+    { 0x200000, 0x000100, 0x000002, 0x000000 },
+    { 0x200008, 0x000000, 0x000000, 0x000000 },
+    { 0x200008, 0x000000, 0x000002, 0x000000 },
+    { 0x200008, 0x000100, 0x000000, 0x000000 },
+    { 0x200008, 0x000100, 0x000002, 0x000000 }
+  },
+  {
+    { 0x000000, 0x000000, 0x000000, 0x000000 },
+    { 0x000000, 0x000000, 0x000001, 0x000000 },
+    { 0x000000, 0x000080, 0x000000, 0x000000 },
+    { 0x000000, 0x000080, 0x000001, 0x000000 },
+    { 0x000004, 0x000000, 0x000000, 0x000000 },
+    { 0x000004, 0x000000, 0x000001, 0x000000 },
+    { 0x000004, 0x000080, 0x000000, 0x000000 },
+    { 0x000004, 0x000080, 0x000001, 0x000000 },
+    { 0x100000, 0x000000, 0x000000, 0x000000 },
+    { 0x100000, 0x000000, 0x000001, 0x000000 },
+    { 0x100000, 0x000080, 0x000000, 0x000000 },
+    { 0x100000, 0x000080, 0x000001, 0x000000 },
+    { 0x100004, 0x000000, 0x000000, 0x000000 },
+    { 0x100004, 0x000000, 0x000001, 0x000000 },
+    { 0x100004, 0x000080, 0x000000, 0x000000 },
+    { 0x100004, 0x000080, 0x000001, 0x000000 }
+  },
+  {
+    { 0x000000, 0x000000, 0x000000, 0x000000 },
+    { 0x000000, 0x000000, 0x000000, 0x002000 },
+    { 0x000000, 0x000040, 0x000000, 0x000000 },
+    { 0x000000, 0x000040, 0x000000, 0x002000 },
+    { 0x000002, 0x000000, 0x000000, 0x000000 },
+    { 0x000002, 0x000000, 0x000000, 0x002000 },
+    { 0x000002, 0x000040, 0x000000, 0x000000 },
+    { 0x000002, 0x000040, 0x000000, 0x002000 },
+    { 0x080000, 0x000000, 0x000000, 0x000000 },
+    { 0x080000, 0x000000, 0x000000, 0x002000 },
+    { 0x080000, 0x000040, 0x000000, 0x000000 },
+    { 0x080000, 0x000040, 0x000000, 0x002000 },
+    { 0x080002, 0x000000, 0x000000, 0x000000 },
+    { 0x080002, 0x000000, 0x000000, 0x002000 },
+    { 0x080002, 0x000040, 0x000000, 0x000000 },
+    { 0x080002, 0x000040, 0x000000, 0x002000 }
+  },
+  {
+    { 0x000000, 0x000000, 0x000000, 0x000000 },
+    { 0x000000, 0x000000, 0x000000, 0x001000 },
+    { 0x000000, 0x000020, 0x000000, 0x000000 },
+    { 0x000000, 0x000020, 0x000000, 0x001000 },
+    { 0x000001, 0x000000, 0x000000, 0x000000 },
+    { 0x000001, 0x000000, 0x000000, 0x001000 },
+    { 0x000001, 0x000020, 0x000000, 0x000000 },
+    { 0x000001, 0x000020, 0x000000, 0x001000 },
+    { 0x040000, 0x000000, 0x000000, 0x000000 },
+    { 0x040000, 0x000000, 0x000000, 0x001000 },
+    { 0x040000, 0x000020, 0x000000, 0x000000 },
+    { 0x040000, 0x000020, 0x000000, 0x001000 },
+    { 0x040001, 0x000000, 0x000000, 0x000000 },
+    { 0x040001, 0x000000, 0x000000, 0x001000 },
+    { 0x040001, 0x000020, 0x000000, 0x000000 },
+    { 0x040001, 0x000020, 0x000000, 0x001000 }
+  },
+  {
+    { 0x000000, 0x000000, 0x000000, 0x000000 },
+    { 0x000000, 0x000000, 0x000000, 0x000800 },
+    { 0x000000, 0x000010, 0x000000, 0x000000 },
+    { 0x000000, 0x000010, 0x000000, 0x000800 },
+    { 0x000000, 0x400000, 0x000000, 0x000000 },
+    { 0x000000, 0x400000, 0x000000, 0x000800 },
+    { 0x000000, 0x400010, 0x000000, 0x000000 },
+    { 0x000000, 0x400010, 0x000000, 0x000800 },
+    { 0x020000, 0x000000, 0x000000, 0x000000 },
+    { 0x020000, 0x000000, 0x000000, 0x000800 },
+    { 0x020000, 0x000010, 0x000000, 0x000000 },
+    { 0x020000, 0x000010, 0x000000, 0x000800 },
+    { 0x020000, 0x400000, 0x000000, 0x000000 },
+    { 0x020000, 0x400000, 0x000000, 0x000800 },
+    { 0x020000, 0x400010, 0x000000, 0x000000 },
+    { 0x020000, 0x400010, 0x000000, 0x000800 }
+  },
+  {
+    { 0x000000, 0x000000, 0x000000, 0x000000 },
+    { 0x000000, 0x000000, 0x000000, 0x000400 },
+    { 0x000000, 0x000008, 0x000000, 0x000000 },
+    { 0x000000, 0x000008, 0x000000, 0x000400 },
+    { 0x000000, 0x200000, 0x000000, 0x000000 },
+    { 0x000000, 0x200000, 0x000000, 0x000400 },
+    { 0x000000, 0x200008, 0x000000, 0x000000 },
+    { 0x000000, 0x200008, 0x000000, 0x000400 },
+    { 0x010000, 0x000000, 0x000000, 0x000000 },
+    { 0x010000, 0x000000, 0x000000, 0x000400 },
+    { 0x010000, 0x000008, 0x000000, 0x000000 },
+    { 0x010000, 0x000008, 0x000000, 0x000400 },
+    { 0x010000, 0x200000, 0x000000, 0x000000 },
+    { 0x010000, 0x200000, 0x000000, 0x000400 },
+    { 0x010000, 0x200008, 0x000000, 0x000000 },
+    { 0x010000, 0x200008, 0x000000, 0x000400 }
+  },
+  {
+    { 0x000000, 0x000000, 0x000000, 0x000000 },
+    { 0x000000, 0x000000, 0x000000, 0x000200 },
+    { 0x000000, 0x000004, 0x000000, 0x000000 },
+    { 0x000000, 0x000004, 0x000000, 0x000200 },
+    { 0x000000, 0x100000, 0x000000, 0x000000 },
+    { 0x000000, 0x100000, 0x000000, 0x000200 },
+    { 0x000000, 0x100004, 0x000000, 0x000000 },
+    { 0x000000, 0x100004, 0x000000, 0x000200 },
+    { 0x008000, 0x000000, 0x000000, 0x000000 },
+    { 0x008000, 0x000000, 0x000000, 0x000200 },
+    { 0x008000, 0x000004, 0x000000, 0x000000 },
+    { 0x008000, 0x000004, 0x000000, 0x000200 },
+    { 0x008000, 0x100000, 0x000000, 0x000000 },
+    { 0x008000, 0x100000, 0x000000, 0x000200 },
+    { 0x008000, 0x100004, 0x000000, 0x000000 },
+    { 0x008000, 0x100004, 0x000000, 0x000200 }
+  },
+  {
+    { 0x000000, 0x000000, 0x000000, 0x000000 },
+    { 0x000000, 0x000000, 0x000000, 0x000100 },
+    { 0x000000, 0x000002, 0x000000, 0x000000 },
+    { 0x000000, 0x000002, 0x000000, 0x000100 },
+    { 0x000000, 0x080000, 0x000000, 0x000000 },
+    { 0x000000, 0x080000, 0x000000, 0x000100 },
+    { 0x000000, 0x080002, 0x000000, 0x000000 },
+    { 0x000000, 0x080002, 0x000000, 0x000100 },
+    { 0x004000, 0x000000, 0x000000, 0x000000 },
+    { 0x004000, 0x000000, 0x000000, 0x000100 },
+    { 0x004000, 0x000002, 0x000000, 0x000000 },
+    { 0x004000, 0x000002, 0x000000, 0x000100 },
+    { 0x004000, 0x080000, 0x000000, 0x000000 },
+    { 0x004000, 0x080000, 0x000000, 0x000100 },
+    { 0x004000, 0x080002, 0x000000, 0x000000 },
+    { 0x004000, 0x080002, 0x000000, 0x000100 }
+  },
+  {
+    { 0x000000, 0x000000, 0x000000, 0x000000 },
+    { 0x000000, 0x000000, 0x000000, 0x000080 },
+    { 0x000000, 0x000001, 0x000000, 0x000000 },
+    { 0x000000, 0x000001, 0x000000, 0x000080 },
+    { 0x000000, 0x040000, 0x000000, 0x000000 },
+    { 0x000000, 0x040000, 0x000000, 0x000080 },
+    { 0x000000, 0x040001, 0x000000, 0x000000 },
+    { 0x000000, 0x040001, 0x000000, 0x000080 },
+    { 0x002000, 0x000000, 0x000000, 0x000000 },
+    { 0x002000, 0x000000, 0x000000, 0x000080 },
+    { 0x002000, 0x000001, 0x000000, 0x000000 },
+    { 0x002000, 0x000001, 0x000000, 0x000080 },
+    { 0x002000, 0x040000, 0x000000, 0x000000 },
+    { 0x002000, 0x040000, 0x000000, 0x000080 },
+    { 0x002000, 0x040001, 0x000000, 0x000000 },
+    { 0x002000, 0x040001, 0x000000, 0x000080 }
+  },
+  {
+    { 0x000000, 0x000000, 0x000000, 0x000000 },
+    { 0x000000, 0x000000, 0x000000, 0x000040 },
+    { 0x000000, 0x000000, 0x000400, 0x000000 },
+    { 0x000000, 0x000000, 0x000400, 0x000040 },
+    { 0x000000, 0x020000, 0x000000, 0x000000 },
+    { 0x000000, 0x020000, 0x000000, 0x000040 },
+    { 0x000000, 0x020000, 0x000400, 0x000000 },
+    { 0x000000, 0x020000, 0x000400, 0x000040 },
+    { 0x001000, 0x000000, 0x000000, 0x000000 },
+    { 0x001000, 0x000000, 0x000000, 0x000040 },
+    { 0x001000, 0x000000, 0x000400, 0x000000 },
+    { 0x001000, 0x000000, 0x000400, 0x000040 },
+    { 0x001000, 0x020000, 0x000000, 0x000000 },
+    { 0x001000, 0x020000, 0x000000, 0x000040 },
+    { 0x001000, 0x020000, 0x000400, 0x000000 },
+    { 0x001000, 0x020000, 0x000400, 0x000040 }
+  },
+  {
+    { 0x000000, 0x000000, 0x000000, 0x000000 },
+    { 0x000000, 0x000000, 0x000000, 0x000020 },
+    { 0x000000, 0x000000, 0x000200, 0x000000 },
+    { 0x000000, 0x000000, 0x000200, 0x000020 },
+    { 0x000000, 0x010000, 0x000000, 0x000000 },
+    { 0x000000, 0x010000, 0x000000, 0x000020 },
+    { 0x000000, 0x010000, 0x000200, 0x000000 },
+    { 0x000000, 0x010000, 0x000200, 0x000020 },
+    { 0x000800, 0x000000, 0x000000, 0x000000 },
+    { 0x000800, 0x000000, 0x000000, 0x000020 },
+    { 0x000800, 0x000000, 0x000200, 0x000000 },
+    { 0x000800, 0x000000, 0x000200, 0x000020 },
+    { 0x000800, 0x010000, 0x000000, 0x000000 },
+    { 0x000800, 0x010000, 0x000000, 0x000020 },
+    { 0x000800, 0x010000, 0x000200, 0x000000 },
+    { 0x000800, 0x010000, 0x000200, 0x000020 }
+  },
+  {
+    { 0x000000, 0x000000, 0x000000, 0x000000 },
+    { 0x000000, 0x000000, 0x000000, 0x000010 },
+    { 0x000000, 0x000000, 0x000100, 0x000000 },
+    { 0x000000, 0x000000, 0x000100, 0x000010 },
+    { 0x000000, 0x008000, 0x000000, 0x000000 },
+    { 0x000000, 0x008000, 0x000000, 0x000010 },
+    { 0x000000, 0x008000, 0x000100, 0x000000 },
+    { 0x000000, 0x008000, 0x000100, 0x000010 },
+    { 0x000400, 0x000000, 0x000000, 0x000000 },
+    { 0x000400, 0x000000, 0x000000, 0x000010 },
+    { 0x000400, 0x000000, 0x000100, 0x000000 },
+    { 0x000400, 0x000000, 0x000100, 0x000010 },
+    { 0x000400, 0x008000, 0x000000, 0x000000 },
+    { 0x000400, 0x008000, 0x000000, 0x000010 },
+    { 0x000400, 0x008000, 0x000100, 0x000000 },
+    { 0x000400, 0x008000, 0x000100, 0x000010 }
+  },
+  {
+    { 0x000000, 0x000000, 0x000000, 0x000000 },
+    { 0x000000, 0x000000, 0x000000, 0x000008 },
+    { 0x000000, 0x000000, 0x000080, 0x000000 },
+    { 0x000000, 0x000000, 0x000080, 0x000008 },
+    { 0x000000, 0x004000, 0x000000, 0x000000 },
+    { 0x000000, 0x004000, 0x000000, 0x000008 },
+    { 0x000000, 0x004000, 0x000080, 0x000000 },
+    { 0x000000, 0x004000, 0x000080, 0x000008 },
+    { 0x000200, 0x000000, 0x000000, 0x000000 },
+    { 0x000200, 0x000000, 0x000000, 0x000008 },
+    { 0x000200, 0x000000, 0x000080, 0x000000 },
+    { 0x000200, 0x000000, 0x000080, 0x000008 },
+    { 0x000200, 0x004000, 0x000000, 0x000000 },
+    { 0x000200, 0x004000, 0x000000, 0x000008 },
+    { 0x000200, 0x004000, 0x000080, 0x000000 },
+    { 0x000200, 0x004000, 0x000080, 0x000008 }
+  },
+  {
+    { 0x000000, 0x000000, 0x000000, 0x000000 },
+    { 0x000000, 0x000000, 0x000000, 0x000004 },
+    { 0x000000, 0x000000, 0x000040, 0x000000 },
+    { 0x000000, 0x000000, 0x000040, 0x000004 },
+    { 0x000000, 0x002000, 0x000000, 0x000000 },
+    { 0x000000, 0x002000, 0x000000, 0x000004 },
+    { 0x000000, 0x002000, 0x000040, 0x000000 },
+    { 0x000000, 0x002000, 0x000040, 0x000004 },
+    { 0x000100, 0x000000, 0x000000, 0x000000 },
+    { 0x000100, 0x000000, 0x000000, 0x000004 },
+    { 0x000100, 0x000000, 0x000040, 0x000000 },
+    { 0x000100, 0x000000, 0x000040, 0x000004 },
+    { 0x000100, 0x002000, 0x000000, 0x000000 },
+    { 0x000100, 0x002000, 0x000000, 0x000004 },
+    { 0x000100, 0x002000, 0x000040, 0x000000 },
+    { 0x000100, 0x002000, 0x000040, 0x000004 }
+  },
+  {
+    { 0x000000, 0x000000, 0x000000, 0x000000 },
+    { 0x000000, 0x000000, 0x000000, 0x000002 },
+    { 0x000000, 0x000000, 0x000020, 0x000000 },
+    { 0x000000, 0x000000, 0x000020, 0x000002 },
+    { 0x000000, 0x001000, 0x000000, 0x000000 },
+    { 0x000000, 0x001000, 0x000000, 0x000002 },
+    { 0x000000, 0x001000, 0x000020, 0x000000 },
+    { 0x000000, 0x001000, 0x000020, 0x000002 },
+    { 0x000080, 0x000000, 0x000000, 0x000000 },
+    { 0x000080, 0x000000, 0x000000, 0x000002 },
+    { 0x000080, 0x000000, 0x000020, 0x000000 },
+    { 0x000080, 0x000000, 0x000020, 0x000002 },
+    { 0x000080, 0x001000, 0x000000, 0x000000 },
+    { 0x000080, 0x001000, 0x000000, 0x000002 },
+    { 0x000080, 0x001000, 0x000020, 0x000000 },
+    { 0x000080, 0x001000, 0x000020, 0x000002 }
+  },
+  {
+    { 0x000000, 0x000000, 0x000000, 0x000000 },
+    { 0x000000, 0x000000, 0x000000, 0x000001 },
+    { 0x000000, 0x000000, 0x000010, 0x000000 },
+    { 0x000000, 0x000000, 0x000010, 0x000001 },
+    { 0x000000, 0x000800, 0x000000, 0x000000 },
+    { 0x000000, 0x000800, 0x000000, 0x000001 },
+    { 0x000000, 0x000800, 0x000010, 0x000000 },
+    { 0x000000, 0x000800, 0x000010, 0x000001 },
+    { 0x000040, 0x000000, 0x000000, 0x000000 },
+    { 0x000040, 0x000000, 0x000000, 0x000001 },
+    { 0x000040, 0x000000, 0x000010, 0x000000 },
+    { 0x000040, 0x000000, 0x000010, 0x000001 },
+    { 0x000040, 0x000800, 0x000000, 0x000000 },
+    { 0x000040, 0x000800, 0x000000, 0x000001 },
+    { 0x000040, 0x000800, 0x000010, 0x000000 },
+    { 0x000040, 0x000800, 0x000010, 0x000001 }
+  }
 };
 
-const int rY[36] = {
-  0, 2, 0, 2, 0, 2,
-  0, 2, 0, 3, 0, 3,
-  1, 3, 1, 3, 1, 3,
-  1, 3, 1, 3, 1, 3,
-  1, 3, 1, 3, 1, 3,
-  1, 3, 1, 3, 1, 3
-};
-
-const int rZ[36] = {
-  5, 3, 4, 2, 3, 1,
-  2, 0, 1, 13, 0, 12,
-  22, 11, 21, 10, 20, 9,
-  19, 8, 18, 7, 17, 6,
-  16, 5, 15, 4, 14, 3,
-  13, 2, 12, 1, 11, 0
-};
-
-void mbe_checkGolayBlock (long int *block)
+// Corrects the data bits of a 23 bit Golay block in place, returns the number of data bits that were flipped
+int mbe_golay2312 (uint32_t *block)
 {
-  static int i, syndrome, eccexpected, eccbits, databits;
-  long int mask, block_l;
+  uint32_t databits = *block >> 11;
+  uint32_t syndrome;
+  uint32_t error;
 
-  block_l = *block;
+  syndrome = golayParity[0][databits & 0x0f] ^ golayParity[1][(databits >> 4) & 0x0f] ^ golayParity[2][databits >> 8];
+  syndrome ^= *block & 0x7ff;
 
-  mask = 0x400000l;
-  eccexpected = 0;
-  for (i = 0; i < 12; i++)
-    {
-      if ((block_l & mask) != 0l)
-        {
-          eccexpected ^= golayGenerator[i];
-        }
-      mask = mask >> 1;
-    }
-  eccbits = (int) (block_l & 0x7ffl);
-  syndrome = eccexpected ^ eccbits;
+  error = golayMatrix[syndrome];
+  *block ^= error << 11;
 
-  databits = (int) (block_l >> 11);
-  databits = databits ^ golayMatrix[syndrome];
-
-  *block = (long) databits;
+  return __builtin_popcount (error);
 }
 
-int mbe_golay2312 (char *in, char *out)
+void mbe_deinterleaveAmbe3600x2450 (const uint8_t *indata, uint32_t ambe_fr[4])
 {
+  uint32_t c0 = 0, c1 = 0, c2 = 0, c3 = 0;
 
-  int i, errs;
-  long block;
-
-  block = 0;
-  for (i = 22; i >= 0; i--)
+  for (int i = 0; i < 9; i++)
     {
-      block = block << 1;
-      block = block + in[i];
-    }
+      const uint32_t *hi = ambeDeinterleave[2 * i][indata[i] >> 4];
+      const uint32_t *lo = ambeDeinterleave[2 * i + 1][indata[i] & 0x0f];
 
-  mbe_checkGolayBlock (&block);
-
-  for (i = 22; i >= 11; i--)
-    {
-      out[i] = (block & 2048) >> 11;
-      block = block << 1;
-    }
-  for (i = 10; i >= 0; i--)
-    {
-      out[i] = in[i];
+      c0 |= hi[0] | lo[0];
+      c1 |= hi[1] | lo[1];
+      c2 |= hi[2] | lo[2];
+      c3 |= hi[3] | lo[3];
     }
 
-  errs = 0;
-  for (i = 22; i >= 11; i--)
-    {
-      if (out[i] != in[i])
-        {
-          errs++;
-        }
-    }
-  return (errs);
+  ambe_fr[0] = c0;
+  ambe_fr[1] = c1;
+  ambe_fr[2] = c2;
+  ambe_fr[3] = c3;
 }
 
-int mbe_eccAmbe3600x2450C0 (char ambe_fr[4][24])
+int mbe_eccAmbe3600x2450C0 (uint32_t ambe_fr[4])
 {
+  // Bit 0 of C0 is the golay24 parity bit, it is not checked
+  uint32_t block = ambe_fr[0] >> 1;
+  int errs;
 
-  int j, errs;
-  char in[23], out[23];
-
-  for (j = 0; j < 23; j++)
-    {
-      in[j] = ambe_fr[0][j + 1];
-    }
-  errs = mbe_golay2312 (in, out);
-  // ambe_fr[0][0] should be the C0 golay24 parity bit.
-  // TODO: actually test that here...
-  for (j = 0; j < 23; j++)
-    {
-      ambe_fr[0][j + 1] = out[j];
-    }
+  errs = mbe_golay2312 (&block);
+  ambe_fr[0] = (block << 1) | (ambe_fr[0] & 1);
 
   return (errs);
 }
 
-int mbe_eccAmbe3600x2450Data (char ambe_fr[4][24], char *ambe_d)
+// C1 is scrambled with a sequence seeded from the 12 data bits of C0
+void mbe_demodulateAmbe3600x2450Data (uint32_t ambe_fr[4])
 {
+  uint16_t pr = (uint16_t)(16 * ((ambe_fr[0] >> 12) & 0xfff));
+  uint32_t mask = 0;
 
-  int j, errs;
-  char *ambe, gin[24], gout[24];
-
-  ambe = ambe_d;
-  // just copy C0
-  for (j = 23; j > 11; j--)
-    {
-      *ambe = ambe_fr[0][j];
-      ambe++;
-    }
-
-  // ecc and copy C1
-  for (j = 0; j < 23; j++)
-    {
-      gin[j] = ambe_fr[1][j];
-    }
-  errs = mbe_golay2312 (gin, gout);
-  for (j = 22; j > 10; j--)
+  for (int k = 1; k < 24; k++)
     {
-      *ambe = gout[j];
-      ambe++;
+      pr = (uint16_t)((173 * pr) + 13849);
+      mask = (mask << 1) | (pr >> 15);
     }
-
-  // just copy C2
-  for (j = 10; j >= 0; j--)
-    {
-      *ambe = ambe_fr[2][j];
-      ambe++;
-    }
-
-  // just copy C3
-  for (j = 13; j >= 0; j--)
-    {
-      *ambe = ambe_fr[3][j];
-      ambe++;
-    }
-
-  return (errs);
+  ambe_fr[1] ^= mask;
 }
 
-void mbe_demodulateAmbe3600x2450Data (char ambe_fr[4][24])
+int mbe_eccAmbe3600x2450Data (uint32_t ambe_fr[4], short *ambe_d)
 {
-  int i, j, k;
-  unsigned short pr[115];
-  unsigned short foo = 0;
+  uint32_t block = ambe_fr[1] & 0x7fffff;
+  int errs;
 
-  // create pseudo-random modulator
-  for (i = 23; i >= 12; i--)
+  errs = mbe_golay2312 (&block);
+  ambe_fr[1] = block;
+
+  // C0 bits 23-12, C1 bits 22-11, C2 bits 10-0, C3 bits 13-0, each MSB first
+  for (int j = 23; j > 11; j--)
     {
-      foo <<= 1;
-      foo |= ambe_fr[0][i];
+      *ambe_d++ = (ambe_fr[0] >> j) & 1;
     }
-  pr[0] = (16 * foo);
-  for (i = 1; i < 24; i++)
+  for (int j = 22; j > 10; j--)
     {
-      pr[i] = (173 * pr[i - 1]) + 13849 - (65536 * (((173 * pr[i - 1]) + 13849) / 65536));
+      *ambe_d++ = (ambe_fr[1] >> j) & 1;
     }
-  for (i = 1; i < 24; i++)
+  for (int j = 10; j >= 0; j--)
     {
-      pr[i] = pr[i] / 32768;
+      *ambe_d++ = (ambe_fr[2] >> j) & 1;
     }
-
-  // demodulate ambe_fr with pr
-  k = 1;
-  for (j = 22; j >= 0; j--)
+  for (int j = 13; j >= 0; j--)
     {
-      ambe_fr[1][j] = ((ambe_fr[1][j]) ^ pr[k]);
-      k++;
+      *ambe_d++ = (ambe_fr[3] >> j) & 1;
     }
+
+  return (errs);
 }
 
-void prepare_framedata(uint8_t *indata, char *ambe_d, int *errs, int *errs2)
+void prepare_framedata(const uint8_t *indata, short *ambe_d, int *errs, int *errs2)
 {
-	char ambe_fr[4][24];
-	int *w, *x, *y, *z;
-	uint8_t rampos = 0;
-
-	w = (int*)rW;
-	x = (int*)rX;
-	y = (int*)rY;
-	z = (int*)rZ;
-	for (int i = 0; i < 9; i++)
-	{
-		for (int j = 0; j < 4; j++)
-		{
-			ambe_fr[*w][*x] = (indata[rampos]>>(7-(2*j))) & 1;
-			ambe_fr[*y][*z] = (indata[rampos]>>(7-(2*j+1))) & 1;
-			w++;
-			x++;
-			y++;
-			z++;
-		}
-		rampos++;
-	}
+	uint32_t ambe_fr[4];
 
-    *errs = 0;
-    *errs2 = 0;
+	mbe_deinterleaveAmbe3600x2450 (indata, ambe_fr);
     *errs = mbe_eccAmbe3600x2450C0 (ambe_fr);
     mbe_demodulateAmbe3600x2450Data (ambe_fr);
     *errs2 = *errs;
@@ -25,9 +25,65 @@
 #include "UC1701_charset.h"
 #include "fw_settings.h"
 
+// Menus draw into screenBuf, render posts it to frontBuf for the flush task to send
 static uint8_t screenBuf[1024];
+static uint8_t frontBuf[1024];
+// What the panel RAM currently holds, so a flush only sends the columns which changed
+static uint8_t renderedBuf[1024];
+static bool renderedBufValid = false;
+// The display start line, in pages, of the frame being drawn, the posted frame and the panel.
+// Logical page n of a frame is held in page (n + start page) of the panel RAM.
+static int screenStartPage = 0;
+static int frontStartPage = 0;
+static int panelStartPage = 0;
+static volatile bool frameReady = false;
+static SemaphoreHandle_t displayMutex = NULL;
+static TaskHandle_t fwDisplayTaskHandle = NULL;
+
+volatile uint32_t uc1701FramesPosted;
+volatile uint32_t uc1701FramesSuperseded;
+volatile uint32_t uc1701FramesIdentical;
+volatile uint32_t uc1701Scrolls;
+volatile uint32_t uc1701RenderCount;
+volatile uint32_t uc1701RenderPages;
+volatile uint32_t uc1701RenderBytes;
+volatile uint32_t uc1701RenderCyclesLast;
+volatile uint32_t uc1701RenderCyclesMax;
+volatile uint64_t uc1701RenderCyclesSum;
+
+static void fw_display_task();
 int activeBufNum=0;
 
+void UC1701_initFlushTask()
+{
+	displayMutex = xSemaphoreCreateMutex();
+
+	xTaskCreate(fw_display_task,                        /* pointer to the task */
+				"fw display task",                      /* task name for kernel awareness debugging */
+				400L / sizeof(portSTACK_TYPE),       /* task stack size */
+				NULL,                      			 /* optional task startup argument */
+				TASK_PRIORITY_HOUSEKEEPING,          /* initial priority */
+				&fwDisplayTaskHandle					 /* optional task handle to create */
+				);
+}
+
+// Held while anything is sent to the panel, so commands from the UI task cannot split a flush
+static void UC1701_lock()
+{
+	if (displayMutex != NULL)
+	{
+		xSemaphoreTake(displayMutex, portMAX_DELAY);
+	}
+}
+
+static void UC1701_unlock()
+{
+	if (displayMutex != NULL)
+	{
+		xSemaphoreGive(displayMutex);
+	}
+}
+
 void UC1701_setCommandMode(bool isCommand)
 {
 	GPIO_PinWrite(GPIO_Display_RS, Pin_Display_RS, !isCommand);
@@ -74,28 +130,74 @@ int i;
   return 0;
 }
 
-void UC1701_render()
+static void UC1701_flush()
 {
-	uint8_t *rowPos = screenBuf;
-	for(int row=0;row<8;row++)
+	uint32_t startCycles = DWT->CYCCNT;
+	uint32_t cycles;
+	static uint8_t rowBuf[128];// only used with the display lock held, and kept off the 400 byte task stack
+	bool changed = false;
+	int startPage;
+
+	UC1701_lock();
+	taskENTER_CRITICAL();
+	startPage = frontStartPage;
+	taskEXIT_CRITICAL();
+
+	if (!renderedBufValid || (startPage != panelStartPage))
 	{
 		UC1701_setCommandMode(true);
-		UC1701_transfer(0xb0 | row); // set Y
-		UC1701_transfer(0x10 | 0); // set X (high MSB)
+		UC1701_transfer(0x40 | (startPage << 3)); // set display start line
+		UC1701_setCommandMode(false);
+		panelStartPage = startPage;
+		uc1701Scrolls++;
+		changed = true;
+	}
 
-// Note there are 4 pixels at the left which are no in the hardware of the LCD panel, but are in the RAM buffer of the controller
-		UC1701_transfer(0x00 | 4); // set X (low MSB).
+	for(int row=0;row<8;row++)
+	{
+		int panelRow = (row + panelStartPage) & 0x07;
+		uint8_t *rowPos = rowBuf;
+		uint8_t *renderedPos = renderedBuf + (panelRow << 7);
+		int first = 0;
+		int last = 127;
+
+		// A page at a time, so a frame posted during the flush cannot tear a page
+		taskENTER_CRITICAL();
+		memcpy(rowBuf, frontBuf + (row << 7), 128);
+		taskEXIT_CRITICAL();
+
+		if (renderedBufValid)
+		{
+			while ((first < 128) && (rowPos[first] == renderedPos[first]))
+			{
+				first++;
+			}
+			if (first == 128)
+			{
+				continue;// page unchanged
+			}
+			while (rowPos[last] == renderedPos[last])
+			{
+				last--;
+			}
+		}
+		changed = true;
 
+		UC1701_setCommandMode(true);
+		UC1701_transfer(0xb0 | panelRow); // set Y
+// Note there are 4 pixels at the left which are no in the hardware of the LCD panel, but are in the RAM buffer of the controller
+		UC1701_transfer(0x10 | ((first + 4) >> 4)); // set X (high MSB)
+		UC1701_transfer(0x00 | ((first + 4) & 0x0f)); // set X (low MSB).
 		UC1701_setCommandMode(false);
 		uint8_t data1;
-		for(int line=0;line<128;line++)
+		for(int line=first;line<=last;line++)
 		{
 			//UC1701_transfer(*rowPos++);
-			data1= *rowPos;
+			data1= rowPos[line];
+			renderedPos[line] = data1;
 			for (register int i=0; i<8; i++)
 			{
 				GPIO_Display_SCK->PCOR = 1U << Pin_Display_SCK;
-
 				if ((data1&0x80) == 0U)
 				{
 					GPIO_Display_SDA->PCOR = 1U << Pin_Display_SDA;// Hopefully the compiler will otimise this to a value rather than using a shift
@@ -105,55 +207,356 @@ void UC1701_render()
 					GPIO_Display_SDA->PSOR = 1U << Pin_Display_SDA;// Hopefully the compiler will otimise this to a value rather than using a shift
 				}
 				GPIO_Display_SCK->PSOR = 1U << Pin_Display_SCK;// Hopefully the compiler will otimise this to a value rather than using a shift
-
 				data1=data1<<1;
 			}
-			rowPos++;
 		}
+		uc1701RenderPages++;
+		uc1701RenderBytes += last - first + 1;
+	}
+	renderedBufValid = true;
+	UC1701_unlock();
+
+	if (!changed)
+	{
+		uc1701FramesIdentical++;
+		return;
+	}
+
+	cycles = DWT->CYCCNT - startCycles;
+	uc1701RenderCount++;
+	uc1701RenderCyclesLast = cycles;
+	uc1701RenderCyclesSum += cycles;
+	if (cycles > uc1701RenderCyclesMax)
+	{
+		uc1701RenderCyclesMax = cycles;
 	}
 }
 
-int UC1701_printCore(int x, int y, char *szMsg, int iSize, int alignment, bool isInverted)
+// Posts the frame drawn so far. Once the flush task runs this does not wait for the panel,
+// a frame which has not been sent by the time the next one is posted is dropped.
+void UC1701_render()
 {
-int i, sLen;
-uint8_t *currentCharData;
-int charWidthPixels;
-int charHeightPixels;
-int bytesPerChar;
-int startCode;
-uint8_t *currentFont;
-uint8_t *writePos;
-uint8_t *readPos;
+	taskENTER_CRITICAL();
+	memcpy(frontBuf, screenBuf, sizeof(frontBuf));
+	frontStartPage = screenStartPage;
+	uc1701FramesPosted++;
+	if (frameReady)
+	{
+		uc1701FramesSuperseded++;
+	}
+	frameReady = true;
+	taskEXIT_CRITICAL();
 
-    sLen = strlen(szMsg);
+	if (fwDisplayTaskHandle != NULL)
+	{
+		xTaskNotifyGive(fwDisplayTaskHandle);
+	}
+	else
+	{
+		// Before the task is started, e.g. the low battery screen during init
+		frameReady = false;
+		UC1701_flush();
+	}
+}
+
+static void fw_display_task()
+{
+	TickType_t lastFlushTime = xTaskGetTickCount();
+
+	while (1U)
+	{
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+		// Frames posted while waiting for the next slot replace the one which woke the task
+		TickType_t sinceLastFlush = xTaskGetTickCount() - lastFlushTime;
+		if (sinceLastFlush < pdMS_TO_TICKS(UC1701_FRAME_INTERVAL_MS))
+		{
+			vTaskDelay(pdMS_TO_TICKS(UC1701_FRAME_INTERVAL_MS) - sinceLastFlush);
+			ulTaskNotifyTake(pdTRUE, 0);
+		}
+
+		taskENTER_CRITICAL();
+		frameReady = false;
+		taskEXIT_CRITICAL();
+
+		UC1701_flush();
+		lastFlushTime = xTaskGetTickCount();
+	}
+}
+
+// Makes the next render send the whole frame, for when the panel RAM may not match what was last sent
+void UC1701_invalidate()
+{
+	UC1701_lock();
+	renderedBufValid = false;
+	UC1701_unlock();
+}
+
+void UC1701_resetRenderStats()
+{
+	taskENTER_CRITICAL();
+	uc1701FramesPosted = 0;
+	uc1701FramesSuperseded = 0;
+	uc1701FramesIdentical = 0;
+	uc1701Scrolls = 0;
+	uc1701PrintChars = 0;
+	uc1701PrintCycles = 0;
+	uc1701RenderCount = 0;
+	uc1701RenderPages = 0;
+	uc1701RenderBytes = 0;
+	uc1701RenderCyclesLast = 0;
+	uc1701RenderCyclesMax = 0;
+	uc1701RenderCyclesSum = 0;
+	taskEXIT_CRITICAL();
+}
+
+// Font header, as written by UC1701FontConverter, is parsed once when the font changes
+typedef struct
+{
+	const uint8_t *glyphs;
+	const uint8_t *offsets;// RLE fonts only, little endian offset of each character from glyphs
+	int startCode;
+	int endCode;
+	int charWidthPixels;
+	int charHeightPages;
+	int bytesPerChar;
+	bool isCompressed;
+} fontMetrics_t;
+
+static fontMetrics_t fontMetrics;
+static int fontMetricsSize = -1;
+
+volatile uint32_t uc1701PrintChars;
+volatile uint64_t uc1701PrintCycles;
+
+static bool UC1701_selectFont(int iSize)
+{
+	const uint8_t *currentFont;
+
+	if (iSize == fontMetricsSize)
+	{
+		return true;
+	}
 
     switch(iSize)
     {
     	case UC1701_FONT_6X8:
-    		currentFont = (uint8_t *) font_6x8;
+    		currentFont = font_6x8;
     		break;
     	case UC1701_FONT_6X8_bold:
-			currentFont = (uint8_t *) font_6x8_bold;
+			currentFont = font_6x8_bold;
     		break;
     	case UC1701_FONT_8X8:
-    		currentFont = (uint8_t *) font_8x8;
+    		currentFont = font_8x8;
     		break;
     	case UC1701_FONT_GD77_8x16:
-    		currentFont = (uint8_t *) font_gd77_8x16;
+    		currentFont = font_gd77_8x16;
 			break;
     	case UC1701_FONT_16x32:
-    		currentFont = (uint8_t *) font_16x32;
+    		currentFont = font_16x32;
 			break;
-
     	default:
-    		return -2;// Invalid font selected
+    		return false;// Invalid font selected
     		break;
     }
 
-    startCode   		= currentFont[2];  // get first defined character
-    charWidthPixels   	= currentFont[4];  // width in pixel of one char
-    charHeightPixels  	= currentFont[5];  // page count per char
-    bytesPerChar 		= currentFont[7];  // bytes per char
+    fontMetrics.isCompressed		= (currentFont[0] == UC1701_FONT_FORMAT_RLE);
+    fontMetrics.startCode   		= currentFont[2];  // get first defined character
+    fontMetrics.endCode   			= currentFont[3];  // get last defined character
+    fontMetrics.charWidthPixels   	= currentFont[4];  // width in pixel of one char
+    fontMetrics.charHeightPages  	= currentFont[5] / 8;  // page count per char
+    fontMetrics.bytesPerChar 		= currentFont[7];  // bytes per char
+    if (fontMetrics.isCompressed)
+    {
+    	fontMetrics.offsets = &currentFont[8];
+    	fontMetrics.glyphs = &currentFont[8 + 2 * (fontMetrics.endCode - fontMetrics.startCode + 2)];
+    }
+    else
+    {
+    	fontMetrics.offsets = NULL;
+    	fontMetrics.glyphs = &currentFont[8];
+    }
+    fontMetricsSize = iSize;
+    return true;
+}
+
+// The character's bitmap, or for an RLE font the start of its compressed data
+static const uint8_t *UC1701_getGlyph(int code)
+{
+	int offset;
+
+	if (!fontMetrics.isCompressed)
+	{
+		return &fontMetrics.glyphs[(code - fontMetrics.startCode) * fontMetrics.bytesPerChar];
+	}
+
+	offset = (code - fontMetrics.startCode) * 2;
+	return fontMetrics.glyphs + (fontMetrics.offsets[offset] | (fontMetrics.offsets[offset + 1] << 8));
+}
+
+// Draws one character in a single pass over its bytes. A row which is not aligned to a page is shifted
+// to 16 bits, the top half going into the next page down. Pages off the bottom of the screen are clipped.
+static void UC1701_blitGlyph(uint8_t *writePos, const uint8_t *readPos, int shiftNum, int visiblePages, bool isInverted)
+{
+	int width = fontMetrics.charWidthPixels;
+	int pages = fontMetrics.charHeightPages;
+
+	if (pages > visiblePages)
+	{
+		pages = visiblePages;
+	}
+
+	for(int row=0;row < pages;row++)
+	{
+		uint8_t *lowPos = writePos + (row << 7);
+		uint8_t *highPos = lowPos + 128;
+
+		if (shiftNum == 0)
+		{
+			// y position is aligned to a row
+			if (isInverted)
+			{
+				for(int p=0;p<width;p++)
+				{
+					lowPos[p] &= ~readPos[p];
+				}
+			}
+			else
+			{
+				for(int p=0;p<width;p++)
+				{
+					lowPos[p] |= readPos[p];
+				}
+			}
+		}
+		else if (row + 1 < visiblePages)
+		{
+			if (isInverted)
+			{
+				for(int p=0;p<width;p++)
+				{
+					uint32_t column = readPos[p] << shiftNum;
+					lowPos[p] &= ~column;
+					highPos[p] &= ~(column >> 8);
+				}
+			}
+			else
+			{
+				for(int p=0;p<width;p++)
+				{
+					uint32_t column = readPos[p] << shiftNum;
+					lowPos[p] |= column;
+					highPos[p] |= (column >> 8);
+				}
+			}
+		}
+		else
+		{
+			// the lower part of the row is off the screen
+			if (isInverted)
+			{
+				for(int p=0;p<width;p++)
+				{
+					lowPos[p] &= ~(readPos[p] << shiftNum);
+				}
+			}
+			else
+			{
+				for(int p=0;p<width;p++)
+				{
+					lowPos[p] |= (readPos[p] << shiftNum);
+				}
+			}
+		}
+		readPos += width;
+	}
+}
+
+// Blits an RLE character straight from flash. Runs are a control byte 0x80|n followed by the byte to repeat n+1 times,
+// otherwise the control byte n is followed by n+1 literal bytes. Runs of blank columns are skipped without touching the screen.
+static inline __attribute__((always_inline)) void UC1701_blitCompressed(uint8_t *writePos, const uint8_t *readPos, int shiftNum, int visiblePages, const bool isInverted)
+{
+	int width = fontMetrics.charWidthPixels;
+	int pages = fontMetrics.charHeightPages;
+	int row = 0;
+	int col = 0;
+
+	if (pages > visiblePages)
+	{
+		pages = visiblePages;
+	}
+
+	while (row < pages)
+	{
+		uint8_t control = *readPos++;
+		int length = (control & 0x7f) + 1;
+		bool isRun = (control & 0x80) != 0;
+
+		if (isRun && (*readPos == 0))
+		{
+			readPos++;
+			col += length;
+			while (col >= width)
+			{
+				col -= width;
+				row++;
+			}
+			continue;
+		}
+
+		while (length-- > 0)
+		{
+			uint8_t *lowPos = writePos + (row << 7) + col;
+			uint32_t column = (isRun ? *readPos : *readPos++) << shiftNum;
+
+			if (isInverted)
+			{
+				lowPos[0] &= ~column;
+				if ((shiftNum != 0) && (row + 1 < visiblePages))
+				{
+					lowPos[128] &= ~(column >> 8);
+				}
+			}
+			else
+			{
+				lowPos[0] |= column;
+				if ((shiftNum != 0) && (row + 1 < visiblePages))
+				{
+					lowPos[128] |= (column >> 8);
+				}
+			}
+
+			if (++col == width)
+			{
+				col = 0;
+				if (++row == pages)
+				{
+					return;// the rest is off the screen
+				}
+			}
+		}
+		if (isRun)
+		{
+			readPos++;
+		}
+	}
+}
+
+int UC1701_printCore(int x, int y, char *szMsg, int iSize, int alignment, bool isInverted)
+{
+int i, sLen;
+int charWidthPixels;
+int startPage;
+uint8_t *writePos;
+uint32_t startCycles = DWT->CYCCNT;
+
+    sLen = strlen(szMsg);
+
+    if (!UC1701_selectFont(iSize))
+    {
+    	return -2;// Invalid font selected
+    }
+    charWidthPixels = fontMetrics.charWidthPixels;
 
     if ((charWidthPixels*sLen) + x > 128)
 	{
@@ -178,69 +581,43 @@ uint8_t *readPos;
 			break;
 	}
 
+	startPage = y >> 3;
+	if (startPage < 0 || startPage > 7)
+	{
+		return -1;
+	}
+
 	for (i=0; i<sLen; i++)
 	{
-		currentCharData = (unsigned char *)&currentFont[8 + ((szMsg[i] - startCode) * bytesPerChar)];
+		int code = (uint8_t)szMsg[i];
 
-		for(int row=0;row < charHeightPixels / 8 ;row++)
+		if (code < fontMetrics.startCode || code > fontMetrics.endCode)
 		{
-			readPos = (currentCharData + row*charWidthPixels);
-			writePos = (screenBuf + x + (i*charWidthPixels) + ((y>>3) + row)*128) ;
-
-			if ((y&0x07)==0)
-			{
-				// y position is aligned to a row
-				for(int p=0;p<charWidthPixels;p++)
-				{
-					if (isInverted)
-					{
-						*writePos++ &= ~(*readPos++);
-					}
-					else
-					{
-						*writePos++ |= *readPos++;
-					}
-				}
-			}
-			else
-			{
-				int shiftNum = y & 0x07;
-				// y position is NOT aligned to a row
-
-				for(int p=0;p<charWidthPixels;p++)
-				{
-					if (isInverted)
-					{
-						*writePos++ &= ~((*readPos++) << shiftNum);
-					}
-					else
-					{
-						*writePos++ |= ((*readPos++) << shiftNum);
-					}
-				}
-
-				readPos = (currentCharData + row*charWidthPixels);
-				writePos = (screenBuf + x + (i*charWidthPixels) + ((y>>3) + row + 1)*128) ;
-
-				for(int p=0;p<charWidthPixels;p++)
-				{
-					if (isInverted)
-					{
-						*writePos++ &= ~((*readPos++) >> (8 - shiftNum));
-					}
-					else
-					{
-						*writePos++ |= ((*readPos++) >> (8 - shiftNum));
-					}
-				}
-			}
+			continue;// not in the font, leave a gap
+		}
+		writePos = screenBuf + x + (i*charWidthPixels) + (startPage << 7);
+		if (!fontMetrics.isCompressed)
+		{
+			UC1701_blitGlyph(writePos, UC1701_getGlyph(code), y & 0x07, 8 - startPage, isInverted);
+		}
+		else if (isInverted)
+		{
+			UC1701_blitCompressed(writePos, UC1701_getGlyph(code), y & 0x07, 8 - startPage, true);
+		}
+		else
+		{
+			UC1701_blitCompressed(writePos, UC1701_getGlyph(code), y & 0x07, 8 - startPage, false);
 		}
 	}
+
+	uc1701PrintChars += sLen;
+	uc1701PrintCycles += DWT->CYCCNT - startCycles;
 	return 0;
 }
 
 void UC1701_setInverseVideo(bool isInverted)
 {
+	UC1701_lock();
 	UC1701_setCommandMode(true);
 	if (isInverted)
 	{
@@ -253,10 +630,12 @@ void UC1701_setInverseVideo(bool isInverted)
 
     UC1701_transfer(0xAF); // Set Display Enable
     UC1701_setCommandMode(false);
+	UC1701_unlock();
 }
 
 void UC1701_begin(bool isInverted)
 {
+	UC1701_lock();
 	GPIO_PinWrite(GPIO_Display_CS, Pin_Display_CS, 0);// Enable CS permanently
     // Set the LCD parameters...
 	UC1701_setCommandMode(true);
@@ -278,16 +657,23 @@ void UC1701_begin(bool isInverted)
 
     UC1701_setCommandMode(true);
     UC1701_transfer(0xAF); // Set Display Enable
+    renderedBufValid = false;// the reset may have cleared the panel RAM
+	UC1701_unlock();
+
+    screenStartPage = 0;
+
     UC1701_clearBuf();
     UC1701_render();
 }
 
 void UC1701_setContrast(uint8_t contrast)
 {
+	UC1701_lock();
 	UC1701_setCommandMode(true);
 	UC1701_transfer(0x81);              // command to set contrast
 	UC1701_transfer(contrast);          // set contrast
 	UC1701_setCommandMode(false);
+	UC1701_unlock();
 }
 
 void UC1701_clearBuf()
@@ -295,6 +681,28 @@ void UC1701_clearBuf()
 	memset(screenBuf,0x00,1024);
 }
 
+// Scrolls the frame being drawn by whole pages, positive moves the content up. The pages which
+// come into view are cleared. The panel moves its display start line to match, so content which
+// is only scrolled is not sent again when the frame is rendered.
+void UC1701_scrollPages(int pages)
+{
+	if (pages >= 8 || pages <= -8)
+	{
+		UC1701_clearBuf();
+	}
+	else if (pages > 0)
+	{
+		memmove(screenBuf, screenBuf + (pages << 7), (8 - pages) << 7);
+		memset(screenBuf + ((8 - pages) << 7), 0x00, pages << 7);
+	}
+	else if (pages < 0)
+	{
+		memmove(screenBuf + ((-pages) << 7), screenBuf, (8 + pages) << 7);
+		memset(screenBuf, 0x00, (-pages) << 7);
+	}
+	screenStartPage = (screenStartPage + pages) & 0x07;
+}
+
 void UC1701_printCentered(uint8_t y, char *text, int fontSize)
 {
 	UC1701_printCore(0, y, text, fontSize, 1, false);
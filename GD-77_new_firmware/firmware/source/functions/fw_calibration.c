@@ -21,150 +21,98 @@
 
 calibrationStruct_t calibrationVHF;
 calibrationStruct_t calibrationUHF;
+static bool calibrationLoaded = false;
 
-void read_val_DACDATA_shift(int offset, uint8_t* val_shift)
+static uint8_t calibration_byte(const uint8_t *block, uint32_t address, int offset)
 {
-	uint8_t buffer[1];
-	SPI_Flash_read(EXT_DACDATA_shift+offset,buffer,1);
-
-	*val_shift=buffer[0]+1;
-	if (*val_shift>31)
-	{
-		*val_shift=31;
-	}
-	*val_shift|=0x80;
-}
-
-void read_val_twopoint_mod(int offset, uint8_t* val_0x47, uint8_t* val_0x48)
-{
-	uint8_t buffer[2];
-	SPI_Flash_read(EXT_twopoint_mod+offset,buffer,2);
-	*val_0x47=buffer[0];
-	*val_0x48=buffer[1];
-}
-
-void read_val_Q_MOD2_offset(int offset, uint8_t* val_0x04)
-{
-	uint8_t buffer[1];
-	SPI_Flash_read(EXT_Q_MOD2_offset+offset,buffer,1);
-	*val_0x04=buffer[0];
-}
-
-void read_val_phase_reduce(int offset, uint8_t* val_0x46)
-{
-	uint8_t buffer[1];
-	SPI_Flash_read(EXT_phase_reduce+offset,buffer,1);
-	*val_0x46=buffer[0];
-}
-
-void read_val_pga_gain(int offset, uint8_t* value)
-{
-	uint8_t buffer[1];
-	SPI_Flash_read(EXT_pga_gain+offset,buffer,1);
-	*value=buffer[0] & 0x1f;
+	return block[address - EXT_CALIBRATION_BASE + offset];
 }
 
-void read_val_voice_gain_tx(int offset, uint8_t* value)
+static uint16_t calibration_threshold(const uint8_t *block, uint32_t address, int offset)
 {
-	uint8_t buffer[1];
-	SPI_Flash_read(EXT_voice_gain_tx+offset,buffer,1);
-	*value=buffer[0] & 0x7f;
+	return ((calibration_byte(block, address, offset) & 0x7f) << 7) + ((calibration_byte(block, address, offset + 1) & 0x7f) << 0);
 }
 
-void read_val_gain_tx(int offset, uint8_t* value)
+static uint16_t calibration_deviation(const uint8_t *block, uint32_t address, int offset)
 {
-	uint8_t buffer[1];
-	SPI_Flash_read(EXT_gain_tx+offset,buffer,1);
-	*value=buffer[0] & 0x0f;
+	return calibration_byte(block, address, offset) + ((calibration_byte(block, address, offset + 1) & 0x03) << 8);
 }
 
-void read_val_padrv_ibit(int offset, uint8_t* value)
+static uint8_t calibration_DACDATA_shift(const uint8_t *block, int offset)
 {
-	uint8_t buffer[1];
-	SPI_Flash_read(EXT_padrv_ibit+offset,buffer,1);
-	*value=buffer[0] & 0x0f;
-}
-
-void read_val_xmitter_dev_wideband(int offset, uint16_t* value)
-{
-	uint8_t buffer[2];
-	SPI_Flash_read(EXT_xmitter_dev_wideband+offset,buffer,2);
-	*value=buffer[0] + ((buffer[1] & 0x03) << 8);
+	uint8_t val_shift=calibration_byte(block, EXT_DACDATA_shift, offset)+1;
+	if (val_shift>31)
+	{
+		val_shift=31;
+	}
+	return val_shift | 0x80;
 }
 
-void read_val_xmitter_dev_narrowband(int offset, uint16_t* value)
+static uint16_t calibration_squelch_th(const uint8_t *block, int offset)
 {
-	uint8_t buffer[2];
-	SPI_Flash_read(EXT_xmitter_dev_narrowband+offset,buffer,2);
-	*value=buffer[0] + ((buffer[1] & 0x03) << 8);
+	uint8_t v1 = calibration_byte(block, EXT_squelch_th, offset)-3;
+	uint8_t v2 = calibration_byte(block, EXT_squelch_th, offset)-6;
+	if ( v1 >= 127 || v2 >= 127 || v1 < v2 )
+	{
+	  v1 = 24;
+	  v2 = 21;
+	}
+	return (v1 << 7) + (v2 << 0);
 }
 
-void read_val_dac_vgain_analog(int offset, uint8_t* value)
+static void calibration_parse_band(const uint8_t *block, int band_offset, calibrationStruct_t *cal)
 {
-	uint8_t buffer[1];
-	SPI_Flash_read(EXT_dac_vgain_analog+offset,buffer,1);
-	*value=buffer[0] & 0x0f;
-}
+	cal->DACDATA_shift = calibration_DACDATA_shift(block, band_offset);
+	cal->twopoint_mod_0x47 = calibration_byte(block, EXT_twopoint_mod, band_offset);
+	cal->twopoint_mod_0x48 = calibration_byte(block, EXT_twopoint_mod, band_offset + 1);
+	cal->Q_MOD2_offset = calibration_byte(block, EXT_Q_MOD2_offset, band_offset);
 
-void read_val_volume_analog(int offset, uint8_t* value)
-{
-	uint8_t buffer[1];
-	SPI_Flash_read(EXT_volume_analog+offset,buffer,1);
-	*value=buffer[0] & 0x0f;
-}
+	cal->pga_gain = calibration_byte(block, EXT_pga_gain, band_offset) & 0x1f;
+	cal->voice_gain_tx = calibration_byte(block, EXT_voice_gain_tx, band_offset) & 0x7f;
+	cal->gain_tx = calibration_byte(block, EXT_gain_tx, band_offset) & 0x0f;
+	cal->padrv_ibit = calibration_byte(block, EXT_padrv_ibit, band_offset) & 0x0f;
 
-void read_val_noise1_th_wideband(int offset, uint16_t* value)
-{
-	uint8_t buffer[2];
-	SPI_Flash_read(EXT_noise1_th_wideband+offset,buffer,2);
-	*value=((buffer[0] & 0x7f) << 7) + ((buffer[1] & 0x7f) << 0);
-}
+	cal->xmitter_dev_wideband = calibration_deviation(block, EXT_xmitter_dev_wideband, band_offset);
+	cal->xmitter_dev_narrowband = calibration_deviation(block, EXT_xmitter_dev_narrowband, band_offset);
 
-void read_val_noise2_th_wideband(int offset, uint16_t* value)
-{
-	uint8_t buffer[2];
-	SPI_Flash_read(EXT_noise2_th_wideband+offset,buffer,2);
-	*value=((buffer[0] & 0x7f) << 7) + ((buffer[1] & 0x7f) << 0);
-}
+	cal->dac_vgain_analog = calibration_byte(block, EXT_dac_vgain_analog, band_offset) & 0x0f;
+	cal->volume_analog = calibration_byte(block, EXT_volume_analog, band_offset) & 0x0f;
 
-void read_val_rssi3_th_wideband(int offset, uint16_t* value)
-{
-	uint8_t buffer[2];
-	SPI_Flash_read(EXT_rssi3_th_wideband+offset,buffer,2);
-	*value=((buffer[0] & 0x7f) << 7) + ((buffer[1] & 0x7f) << 0);
-}
+	cal->noise1_th_wideband = calibration_threshold(block, EXT_noise1_th_wideband, band_offset);
+	cal->noise2_th_wideband = calibration_threshold(block, EXT_noise2_th_wideband, band_offset);
+	cal->rssi3_th_wideband = calibration_threshold(block, EXT_rssi3_th_wideband, band_offset);
+	cal->noise1_th_narrowband = calibration_threshold(block, EXT_noise1_th_narrowband, band_offset);
+	cal->noise2_th_narrowband = calibration_threshold(block, EXT_noise2_th_narrowband, band_offset);
+	cal->rssi3_th_narrowband = calibration_threshold(block, EXT_rssi3_th_narrowband, band_offset);
 
-void read_val_noise1_th_narrowband(int offset, uint16_t* value)
-{
-	uint8_t buffer[2];
-	SPI_Flash_read(EXT_noise1_th_narrowband+offset,buffer,2);
-	*value=((buffer[0] & 0x7f) << 7) + ((buffer[1] & 0x7f) << 0);
+	for (int freq_offset=0; freq_offset<CALIBRATION_FREQ_STEPS; freq_offset++)
+	{
+		cal->phase_reduce[freq_offset] = calibration_byte(block, EXT_phase_reduce, band_offset + freq_offset);
+		cal->squelch_th[freq_offset] = calibration_squelch_th(block, band_offset + freq_offset);
+	}
 }
 
-void read_val_noise2_th_narrowband(int offset, uint16_t* value)
+// Reads the calibration area of both bands with a single flash read, retuning then only needs the RAM copies
+bool calibrationInit()
 {
-	uint8_t buffer[2];
-	SPI_Flash_read(EXT_noise2_th_narrowband+offset,buffer,2);
-	*value=((buffer[0] & 0x7f) << 7) + ((buffer[1] & 0x7f) << 0);
-}
+	uint8_t block[EXT_CALIBRATION_LENGTH];
 
-void read_val_rssi3_th_narrowband(int offset, uint16_t* value)
-{
-	uint8_t buffer[2];
-	SPI_Flash_read(EXT_rssi3_th_narrowband+offset,buffer,2);
-	*value=((buffer[0] & 0x7f) << 7) + ((buffer[1] & 0x7f) << 0);
+	if (!SPI_Flash_read(EXT_CALIBRATION_BASE, block, EXT_CALIBRATION_LENGTH))
+	{
+		return false;
+	}
+	calibration_parse_band(block, CALIBRATION_BAND_OFFSET_UHF, &calibrationUHF);
+	calibration_parse_band(block, CALIBRATION_BAND_OFFSET_VHF, &calibrationVHF);
+	calibrationLoaded = true;
+	return true;
 }
 
-void read_val_squelch_th(int offset, uint16_t* value)
+// Tries the flash again if the read at startup failed, like every retune did before the RAM copies
+calibrationStruct_t *calibrationGetBand(int band_offset)
 {
-	uint8_t buffer[1];
-	SPI_Flash_read(EXT_squelch_th+offset,buffer,1);
-	uint8_t v1 = buffer[0]-3;
-	uint8_t v2 = buffer[0]-6;
-	if ( v1 >= 127 || v2 >= 127 || v1 < v2 )
+	if (!calibrationLoaded)
 	{
-	  v1 = 24;
-	  v2 = 21;
+		calibrationInit();
 	}
-	*value=(v1 << 7) + (v2 << 0);
+	return (band_offset == CALIBRATION_BAND_OFFSET_VHF) ? &calibrationVHF : &calibrationUHF;
 }
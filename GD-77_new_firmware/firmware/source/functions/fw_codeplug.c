@@ -18,6 +18,8 @@
 #include <fw_codeplug.h>
 #include "fw_EEPROM.h"
 #include "fw_SPI_Flash.h"
+#include "fw_settings.h"
+#include "menu/menuSystem.h"
 
 const int CODEPLUG_ADDR_EX_ZONE_BASIC = 0x8000;
 const int CODEPLUG_ADDR_EX_ZONE_INUSE_PACKED_DATA =  0x8010;
@@ -42,6 +44,30 @@ const int CODEPLUG_ADDR_BOOT_LINE1 = 0x7540;
 const int CODEPLUG_ADDR_BOOT_LINE2 = 0x7550;
 const int CODEPLUG_ADDR_VFO_A_CHANNEL = 0x7590;
 
+// The index lives in the lower SRAM bank, on either side of the codec work areas (see .codec_RAM2 in firmware.ld).
+// The part above them is not cleared at startup, codeplugIndexInit() does that.
+#define CODEPLUG_INDEX_RAM __attribute__((section(".bss.$SRAM_LOWER")))
+#define CODEPLUG_INDEX_RAM_ABOVE_CODEC __attribute__((section(".noinit.$ABOVE_CODEC")))
+
+static struct_codeplugZone_t indexZones[CODEPLUG_ZONE_INDEX_MAX_COUNT] CODEPLUG_INDEX_RAM_ABOVE_CODEC;
+static struct_codeplugRxGroup_t indexRxGroups[CODEPLUG_RX_GROUP_INDEX_MAX_COUNT] CODEPLUG_INDEX_RAM_ABOVE_CODEC;
+static struct_codeplugContact_t indexContacts[CODEPLUG_CONTACTS_INDEX_MAX_COUNT] CODEPLUG_INDEX_RAM;
+// Decoded channels, by channel number modulo the cache size. Channel numbers start from 1, 0 marks an empty entry.
+static struct_codeplugChannel_t indexChannels[CODEPLUG_CHANNEL_CACHE_SIZE] CODEPLUG_INDEX_RAM;
+static uint16_t indexChannelNumbers[CODEPLUG_CHANNEL_CACHE_SIZE] CODEPLUG_INDEX_RAM;
+static int indexZoneCount = 0;
+static bool indexBuilt = false;
+
+volatile uint32_t codeplugIndexBuildCycles = 0;
+volatile uint32_t codeplugIndexUpdates = 0;
+volatile uint32_t codeplugChannelHits = 0;
+volatile uint32_t codeplugChannelMisses = 0;
+
+static void codeplugZoneRead(int index,struct_codeplugZone_t *returnBuf);
+static void codeplugChannelRead(int index, struct_codeplugChannel_t *channelBuf);
+static void codeplugRxGroupRead(int index, struct_codeplugRxGroup_t *rxGroupBuf);
+static void codeplugContactRead(int index, struct_codeplugContact_t *contact);
+
 uint32_t byteSwap32(uint32_t n)
 {
     return ((((n)&0x000000FFU) << 24U) | (((n)&0x0000FF00U) << 8U) | (((n)&0x00FF0000U) >> 8U) | (((n)&0xFF000000U) >> 24U));// from usb_misc.h
@@ -75,7 +101,7 @@ void codeplugUtilConvertBufToString(char *inBuf,char *outBuf,int len)
 	return;
 }
 
-int codeplugZonesGetCount()
+static int codeplugZonesReadCount()
 {
 	uint8_t buf[CODEPLUG_ADDR_EX_ZONE_INUSE_PACKED_DATA_SIZE];
 	int numZones = 0;
@@ -88,11 +114,20 @@ int codeplugZonesGetCount()
 	return numZones;
 }
 
-void codeplugZoneGetDataForIndex(int index,struct_codeplugZone_t *returnBuf)
+int codeplugZonesGetCount()
+{
+	if (indexBuilt)
+	{
+		return indexZoneCount;
+	}
+	return codeplugZonesReadCount();
+}
+
+static void codeplugZoneRead(int index,struct_codeplugZone_t *returnBuf)
 {
 	// IMPORTANT. read size is different from the size of the data, because I added a extra property to the struct to hold the number of channels in the zone.
-	EEPROM_Read(CODEPLUG_ADDR_EX_ZONE_LIST + (index * CODEPLUG_ZONE_DATA_SIZE), (uint8_t*)returnBuf, sizeof(struct_codeplugZone_t));
-	for(int i=0;i<32;i++)
+	EEPROM_Read(CODEPLUG_ADDR_EX_ZONE_LIST + (index * CODEPLUG_ZONE_DATA_SIZE), (uint8_t*)returnBuf, CODEPLUG_ZONE_DATA_SIZE);
+	for(int i=0;i<16;i++)
 	{
 		// Empty channels seem to be filled with zeros
 		if (returnBuf->channels[i] == 0)
@@ -101,10 +136,22 @@ void codeplugZoneGetDataForIndex(int index,struct_codeplugZone_t *returnBuf)
 			return;
 		}
 	}
-	returnBuf->NOT_IN_MEMORY_numChannelsInZone=32;
+	returnBuf->NOT_IN_MEMORY_numChannelsInZone=16;
 }
 
-void codeplugChannelGetDataForIndex(int index, struct_codeplugChannel_t *channelBuf)
+void codeplugZoneGetDataForIndex(int index,struct_codeplugZone_t *returnBuf)
+{
+	if (indexBuilt && index >= 0 && index < indexZoneCount)
+	{
+		taskENTER_CRITICAL();
+		memcpy(returnBuf, &indexZones[index], sizeof(struct_codeplugZone_t));
+		taskEXIT_CRITICAL();
+		return;
+	}
+	codeplugZoneRead(index, returnBuf);
+}
+
+static void codeplugChannelRead(int index, struct_codeplugChannel_t *channelBuf)
 {
 	// lower 128 channels are in EEPROM. Remaining channels are in Flash ! (What a mess...)
 	index--; // I think the channel index numbers start from 1 not zero.
@@ -138,8 +185,39 @@ void codeplugChannelGetDataForIndex(int index, struct_codeplugChannel_t *channel
 	}
 }
 
+void codeplugChannelGetDataForIndex(int index, struct_codeplugChannel_t *channelBuf)
+{
+	int slot = index & (CODEPLUG_CHANNEL_CACHE_SIZE - 1);
+	bool hit;
 
-void codeplugRxGroupGetDataForIndex(int index, struct_codeplugRxGroup_t *rxGroupBuf)
+	if (!indexBuilt || index <= 0)
+	{
+		codeplugChannelRead(index, channelBuf);
+		return;
+	}
+
+	taskENTER_CRITICAL();
+	hit = (indexChannelNumbers[slot] == index);
+	if (hit)
+	{
+		memcpy(channelBuf, &indexChannels[slot], sizeof(struct_codeplugChannel_t));
+	}
+	taskEXIT_CRITICAL();
+	if (hit)
+	{
+		codeplugChannelHits++;
+		return;
+	}
+
+	codeplugChannelMisses++;
+	codeplugChannelRead(index, channelBuf);
+	taskENTER_CRITICAL();
+	memcpy(&indexChannels[slot], channelBuf, sizeof(struct_codeplugChannel_t));
+	indexChannelNumbers[slot] = index;
+	taskEXIT_CRITICAL();
+}
+
+static void codeplugRxGroupRead(int index, struct_codeplugRxGroup_t *rxGroupBuf)
 {
 	int i=0;
 	index--; //Index numbers start from 1 not zero
@@ -156,13 +234,180 @@ void codeplugRxGroupGetDataForIndex(int index, struct_codeplugRxGroup_t *rxGroup
 	rxGroupBuf->NOT_IN_MEMORY_numTGsInGroup = i;
 }
 
-void codeplugContactGetDataForIndex(int index, struct_codeplugContact_t *contact)
+void codeplugRxGroupGetDataForIndex(int index, struct_codeplugRxGroup_t *rxGroupBuf)
+{
+	if (indexBuilt && index >= 1 && index <= CODEPLUG_RX_GROUP_INDEX_MAX_COUNT)
+	{
+		taskENTER_CRITICAL();
+		memcpy(rxGroupBuf, &indexRxGroups[index - 1], sizeof(struct_codeplugRxGroup_t));
+		taskEXIT_CRITICAL();
+		return;
+	}
+	codeplugRxGroupRead(index, rxGroupBuf);
+}
+
+static void codeplugContactRead(int index, struct_codeplugContact_t *contact)
 {
 	index--;
 	SPI_Flash_read(CODEPLUG_ADDR_CONTACTS + index*sizeof(struct_codeplugContact_t),(uint8_t *)contact,sizeof(struct_codeplugContact_t));
 	contact->tgNumber = bcd2int(byteSwap32(contact->tgNumber));
 }
 
+void codeplugContactGetDataForIndex(int index, struct_codeplugContact_t *contact)
+{
+	if (indexBuilt && index >= 1 && index <= CODEPLUG_CONTACTS_INDEX_MAX_COUNT)
+	{
+		taskENTER_CRITICAL();
+		memcpy(contact, &indexContacts[index - 1], sizeof(struct_codeplugContact_t));
+		taskEXIT_CRITICAL();
+		return;
+	}
+	codeplugContactRead(index, contact);
+}
+
+// Reads zones first to last, or those overlapping a write, into the index. Records are read into a local
+// buffer and copied in with interrupts masked, so a reader in another task never sees half a record.
+static void codeplugIndexZones(int first, int last)
+{
+	struct_codeplugZone_t zoneBuf;
+
+	for (int i = first; i <= last && i < CODEPLUG_ZONE_INDEX_MAX_COUNT; i++)
+	{
+		codeplugZoneRead(i, &zoneBuf);
+		taskENTER_CRITICAL();
+		memcpy(&indexZones[i], &zoneBuf, sizeof(struct_codeplugZone_t));
+		taskEXIT_CRITICAL();
+	}
+}
+
+static void codeplugIndexRxGroups(int first, int last)
+{
+	struct_codeplugRxGroup_t rxGroupBuf;
+
+	for (int i = first; i <= last && i < CODEPLUG_RX_GROUP_INDEX_MAX_COUNT; i++)
+	{
+		codeplugRxGroupRead(i + 1, &rxGroupBuf);
+		taskENTER_CRITICAL();
+		memcpy(&indexRxGroups[i], &rxGroupBuf, sizeof(struct_codeplugRxGroup_t));
+		taskEXIT_CRITICAL();
+	}
+}
+
+static void codeplugIndexContacts(int first, int last)
+{
+	struct_codeplugContact_t contactBuf;
+
+	for (int i = first; i <= last && i < CODEPLUG_CONTACTS_INDEX_MAX_COUNT; i++)
+	{
+		codeplugContactRead(i + 1, &contactBuf);
+		taskENTER_CRITICAL();
+		memcpy(&indexContacts[i], &contactBuf, sizeof(struct_codeplugContact_t));
+		taskEXIT_CRITICAL();
+	}
+}
+
+static void codeplugIndexChannelsInvalidate()
+{
+	taskENTER_CRITICAL();
+	memset(indexChannelNumbers, 0, sizeof(indexChannelNumbers));
+	taskEXIT_CRITICAL();
+	menuChannelModeInvalidateNeighbours();
+}
+
+// Called once the EEPROM and the SPI flash are set up
+void codeplugIndexInit()
+{
+	uint32_t startCycles = DWT->CYCCNT;
+	struct_codeplugZone_t zoneBuf;
+	struct_codeplugChannel_t channelBuf;
+
+	memset(indexZones, 0, sizeof(indexZones));
+	memset(indexRxGroups, 0, sizeof(indexRxGroups));
+	indexZoneCount = codeplugZonesReadCount();
+	codeplugIndexZones(0, indexZoneCount - 1);
+	codeplugIndexRxGroups(0, CODEPLUG_RX_GROUP_INDEX_MAX_COUNT - 1);
+	codeplugIndexContacts(0, CODEPLUG_CONTACTS_INDEX_MAX_COUNT - 1);
+	codeplugIndexChannelsInvalidate();
+	indexBuilt = true;
+
+	// The channels of the current zone are the ones the channel screen steps through
+	codeplugZoneGetDataForIndex(nonVolatileSettings.currentZone, &zoneBuf);
+	for (int i = 0; i < zoneBuf.NOT_IN_MEMORY_numChannelsInZone; i++)
+	{
+		codeplugChannelGetDataForIndex(zoneBuf.channels[i], &channelBuf);
+	}
+	codeplugChannelMisses = 0;
+
+	codeplugIndexBuildCycles = DWT->CYCCNT - startCycles;
+}
+
+static bool codeplugRangesOverlap(int address, int length, int regionStart, int regionLength)
+{
+	return (address < regionStart + regionLength) && (regionStart < address + length);
+}
+
+// Re-reads the index records a write to the EEPROM touched
+void codeplugIndexUpdateEEPROM(int address, int length)
+{
+	if (!indexBuilt || length <= 0)
+	{
+		return;
+	}
+
+	if (codeplugRangesOverlap(address, length, CODEPLUG_ADDR_EX_ZONE_INUSE_PACKED_DATA, CODEPLUG_ADDR_EX_ZONE_INUSE_PACKED_DATA_SIZE))
+	{
+		int previousCount = indexZoneCount;
+		int count = codeplugZonesReadCount();
+
+		codeplugIndexZones(previousCount, count - 1);
+		indexZoneCount = count;
+		menuChannelModeInvalidateNeighbours();
+	}
+	if (codeplugRangesOverlap(address, length, CODEPLUG_ADDR_EX_ZONE_LIST, CODEPLUG_ZONE_MAX_COUNT * CODEPLUG_ZONE_DATA_SIZE))
+	{
+		int first = (address - CODEPLUG_ADDR_EX_ZONE_LIST) / CODEPLUG_ZONE_DATA_SIZE;
+		int last = (address + length - 1 - CODEPLUG_ADDR_EX_ZONE_LIST) / CODEPLUG_ZONE_DATA_SIZE;
+
+		codeplugIndexZones((first < 0) ? 0 : first, (last < indexZoneCount) ? last : (indexZoneCount - 1));
+		menuChannelModeInvalidateNeighbours();
+	}
+	if (codeplugRangesOverlap(address, length, CODEPLUG_ADDR_CHANNEL_EEPROM, 128 * CODEPLUG_CHANNEL_DATA_SIZE))
+	{
+		codeplugIndexChannelsInvalidate();
+	}
+	codeplugIndexUpdates++;
+}
+
+// Re-reads the index records a write to the SPI flash touched
+void codeplugIndexUpdateFlash(int address, int length)
+{
+	if (!indexBuilt || length <= 0)
+	{
+		return;
+	}
+
+	if (codeplugRangesOverlap(address, length, CODEPLUG_ADDR_RX_GROUP, CODEPLUG_RX_GROUP_INDEX_MAX_COUNT * CODEPLUG_RX_GROUP_LEN))
+	{
+		int first = (address - CODEPLUG_ADDR_RX_GROUP) / CODEPLUG_RX_GROUP_LEN;
+		int last = (address + length - 1 - CODEPLUG_ADDR_RX_GROUP) / CODEPLUG_RX_GROUP_LEN;
+
+		codeplugIndexRxGroups((first < 0) ? 0 : first, last);
+	}
+	if (codeplugRangesOverlap(address, length, CODEPLUG_ADDR_CONTACTS, CODEPLUG_CONTACTS_INDEX_MAX_COUNT * CODEPLUG_CONTACTS_LEN))
+	{
+		int first = (address - CODEPLUG_ADDR_CONTACTS) / CODEPLUG_CONTACTS_LEN;
+		int last = (address + length - 1 - CODEPLUG_ADDR_CONTACTS) / CODEPLUG_CONTACTS_LEN;
+
+		codeplugIndexContacts((first < 0) ? 0 : first, last);
+	}
+	// 896 channels of 56 bytes, with a 16 byte gap every 128 channels
+	if (codeplugRangesOverlap(address, length, CODEPLUG_ADDR_CHANNEL_FLASH, 7 * (16 + 128 * CODEPLUG_CHANNEL_DATA_SIZE)))
+	{
+		codeplugIndexChannelsInvalidate();
+	}
+	codeplugIndexUpdates++;
+}
+
 int codeplugGetUserDMRID()
 {
 	int dmrId;
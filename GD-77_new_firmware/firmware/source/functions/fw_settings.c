@@ -22,6 +22,7 @@
 #include "fw_trx.h"
 #include "menu/menuSystem.h"
 #include "fw_codeplug.h"
+#include "fw_sound.h"
 
 const int BAND_VHF_MIN 	= 1440000;
 const int BAND_VHF_MAX 	= 1480000;
@@ -39,7 +40,6 @@ struct_codeplugChannel_t channelScreenChannelData={.rxFreq=0};
 void settingsSaveSettings()
 {
 	EEPROM_Write(STORAGE_BASE_ADDRESS, (uint8_t*)&nonVolatileSettings, sizeof(settingsStruct_t));
-    vTaskDelay(portTICK_PERIOD_MS * 5);
 }
 
 void settingsLoadSettings()
@@ -61,6 +61,38 @@ void settingsLoadSettings()
 		}
 	}
 	trxDMRID = codeplugGetUserDMRID();
+	settingsApplyAudioSettings();
+	settingsApplySquelchSettings();
+}
+
+// Settings saved before the field existed read back as 0 or erased, both get the default
+void settingsApplyAudioSettings()
+{
+	int frames = nonVolatileSettings.rxAudioStartFrames;
+
+	if ((frames == 0) || (frames > SOUND_RX_START_FRAMES_MAX))
+	{
+		frames = SOUND_RX_START_FRAMES_DEFAULT;
+	}
+	set_rx_audio_start_frames(frames);
+}
+
+// As above, 0 or erased selects the default
+void settingsApplySquelchSettings()
+{
+	int hangTimeMs = nonVolatileSettings.squelchHangTime * 10;
+	int hysteresis = nonVolatileSettings.squelchHysteresis;
+
+	if ((hangTimeMs == 0) || (hangTimeMs > TRX_SQUELCH_HANG_MS_MAX))
+	{
+		hangTimeMs = TRX_SQUELCH_HANG_MS_DEFAULT;
+	}
+	if ((hysteresis == 0) || (hysteresis > TRX_SQUELCH_HYSTERESIS_MAX))
+	{
+		hysteresis = TRX_SQUELCH_HYSTERESIS_DEFAULT;
+	}
+	trxSetSquelchHangTime(hangTimeMs);
+	trxSetSquelchHysteresis(hysteresis);
 }
 
 void initVFOChannel()
@@ -113,6 +145,9 @@ void settingsRestoreDefaultSettings()
 	nonVolatileSettings.txPower=1600;// intialized to about original firmware LOW
 	nonVolatileSettings.overrideTG=0;// 0 = No override
 	nonVolatileSettings.useCalibration = 0x01;// enable the new calibration system
+	nonVolatileSettings.rxAudioStartFrames = 0;// default jitter buffer target
+	nonVolatileSettings.squelchHangTime = 0;// default squelch hang time
+	nonVolatileSettings.squelchHysteresis = 0;// default squelch hysteresis
 	initVFOChannel();
 	currentChannelData = &nonVolatileSettings.vfoChannel;// Set the current channel data to point to the VFO data since the default screen will be the VFO
 
@@ -18,49 +18,109 @@
 
 #include "fw_sound.h"
 
-TaskHandle_t fwBeepTaskHandle;
+#define BEEP_TASK_IDLE_WAIT_MS 100 // keeps the watchdog fed while nothing is played
 
-const uint8_t sine_beep[] = { 0x00, 0x00, 0x19, 0x00, 0x32, 0x00, 0x4B, 0x00, 0x65, 0x00, 0x7E, 0x00, 0x97, 0x00, 0xB0, 0x00, 0xC9, 0x00, 0xE2, 0x00, 0xFB, 0x00, 0x14, 0x01, 0x2D, 0x01, 0x47, 0x01, 0x60, 0x01, 0x79, 0x01, 0x92, 0x01, 0xAB, 0x01, 0xC4, 0x01, 0xDD, 0x01, 0xF6, 0x01, 0x0F, 0x02, 0x28, 0x02, 0x42, 0x02, 0x5B, 0x02, 0x74, 0x02, 0x8D, 0x02, 0xA6, 0x02, 0xBF, 0x02, 0xD8, 0x02, 0xF1, 0x02, 0x0A, 0x03, 0x23, 0x03, 0x3C, 0x03, 0x55, 0x03, 0x6E, 0x03, 0x87, 0x03, 0xA0, 0x03, 0xB9, 0x03, 0xD2, 0x03, 0xEB, 0x03, 0x04, 0x04, 0x1D, 0x04, 0x35, 0x04, 0x4E, 0x04, 0x67, 0x04, 0x80, 0x04, 0x99, 0x04, 0xB2, 0x04, 0xCB, 0x04, 0xE4, 0x04, 0xFC, 0x04, 0x15, 0x05, 0x2E, 0x05, 0x47, 0x05, 0x60, 0x05, 0x78, 0x05, 0x91, 0x05, 0xAA, 0x05, 0xC3, 0x05, 0xDB, 0x05, 0xF4, 0x05, 0x0D, 0x06, 0x25, 0x06, 0x3E, 0x06, 0x57, 0x06, 0x6F, 0x06, 0x88, 0x06, 0xA0, 0x06, 0xB9, 0x06, 0xD2, 0x06, 0xEA, 0x06, 0x03, 0x07, 0x1B, 0x07, 0x34, 0x07, 0x4C, 0x07, 0x65, 0x07, 0x7D, 0x07, 0x95, 0x07, 0xAE, 0x07, 0xC6, 0x07, 0xDF, 0x07, 0xF7, 0x07, 0x0F, 0x08, 0x28, 0x08, 0x40, 0x08, 0x58, 0x08, 0x70, 0x08, 0x89, 0x08, 0xA1, 0x08, 0xB9, 0x08, 0xD1, 0x08, 0xE9, 0x08, 0x01, 0x09, 0x1A, 0x09, 0x32, 0x09, 0x4A, 0x09, 0x62, 0x09, 0x7A, 0x09, 0x92, 0x09, 0xAA, 0x09, 0xC2, 0x09, 0xDA, 0x09, 0xF1, 0x09, 0x09, 0x0A, 0x21, 0x0A, 0x39, 0x0A, 0x51, 0x0A, 0x69, 0x0A, 0x80, 0x0A, 0x98, 0x0A, 0xB0, 0x0A, 0xC7, 0x0A, 0xDF, 0x0A, 0xF7, 0x0A, 0x0E, 0x0B, 0x26, 0x0B, 0x3D, 0x0B, 0x55, 0x0B, 0x6C, 0x0B, 0x84, 0x0B, 0x9B, 0x0B, 0xB3, 0x0B, 0xCA, 0x0B, 0xE1, 0x0B, 0xF9, 0x0B, 0x10, 0x0C, 0x27, 0x0C, 0x3F, 0x0C, 0x56, 0x0C, 0x6D, 0x0C, 0x84, 0x0C, 0x9B, 0x0C, 0xB2, 0x0C, 0xC9, 0x0C, 0xE0, 0x0C, 0xF7, 0x0C, 0x0E, 0x0D, 0x25, 0x0D, 0x3C, 0x0D, 0x53, 0x0D, 0x6A, 0x0D, 0x81, 0x0D, 0x97, 0x0D, 0xAE, 0x0D, 0xC5, 0x0D, 0xDB, 0x0D, 0xF2, 0x0D, 0x09, 0x0E, 0x1F, 0x0E, 0x36, 0x0E, 0x4C, 0x0E, 0x63, 0x0E, 0x79, 0x0E, 0x90, 0x0E, 0xA6, 0x0E, 0xBC, 0x0E, 0xD3, 0x0E, 0xE9, 0x0E, 0xFF, 0x0E, 0x15, 0x0F, 0x2B, 0x0F, 0x41, 0x0F, 0x58, 0x0F, 0x6E, 0x0F, 0x84, 0x0F, 0x9A, 0x0F, 0xAF, 0x0F, 0xC5, 0x0F, 0xDB, 0x0F, 0xF1, 0x0F, 0x07, 0x10, 0x1C, 0x10, 0x32, 0x10, 0x48, 0x10, 0x5D, 0x10, 0x73, 0x10, 0x89, 0x10, 0x9E, 0x10, 0xB3, 0x10, 0xC9, 0x10, 0xDE, 0x10, 0xF4, 0x10, 0x09, 0x11, 0x1E, 0x11, 0x33, 0x11, 0x49, 0x11, 0x5E, 0x11, 0x73, 0x11, 0x88, 0x11, 0x9D, 0x11, 0xB2, 0x11, 0xC7, 0x11, 0xDC, 0x11, 0xF0, 0x11, 0x05, 0x12, 0x1A, 0x12, 0x2F, 0x12, 0x43, 0x12, 0x58, 0x12, 0x6C, 0x12, 0x81, 0x12, 0x95, 0x12, 0xAA, 0x12, 0xBE, 0x12, 0xD3, 0x12, 0xE7, 0x12, 0xFB, 0x12, 0x0F, 0x13, 0x24, 0x13, 0x38, 0x13, 0x4C, 0x13, 0x60, 0x13, 0x74, 0x13, 0x88, 0x13, 0x9C, 0x13, 0xAF, 0x13, 0xC3, 0x13, 0xD7, 0x13, 0xEB, 0x13, 0xFE, 0x13, 0x12, 0x14, 0x25, 0x14, 0x39, 0x14, 0x4C, 0x14, 0x60, 0x14, 0x73, 0x14, 0x86, 0x14, 0x9A, 0x14, 0xAD, 0x14, 0xC0, 0x14, 0xD3, 0x14, 0xE6, 0x14, 0xF9, 0x14, 0x0C, 0x15, 0x1F, 0x15, 0x32, 0x15, 0x45, 0x15, 0x57, 0x15, 0x6A, 0x15, 0x7D, 0x15, 0x8F, 0x15, 0xA2, 0x15, 0xB4, 0x15, 0xC7, 0x15, 0xD9, 0x15, 0xEC, 0x15, 0xFE, 0x15, 0x10, 0x16, 0x22, 0x16, 0x34, 0x16, 0x46, 0x16, 0x58, 0x16, 0x6A, 0x16, 0x7C, 0x16, 0x8E, 0x16, 0xA0, 0x16, 0xB2, 0x16, 0xC3, 0x16, 0xD5, 0x16, 0xE7, 0x16, 0xF8, 0x16, 0x0A, 0x17, 0x1B, 0x17, 0x2C, 0x17, 0x3E, 0x17, 0x4F, 0x17, 0x60, 0x17, 0x71, 0x17, 0x82, 0x17, 0x93, 0x17, 0xA4, 0x17, 0xB5, 0x17, 0xC6, 0x17, 0xD7, 0x17, 0xE8, 0x17, 0xF8, 0x17, 0x09, 0x18, 0x19, 0x18, 0x2A, 0x18, 0x3A, 0x18, 0x4B, 0x18, 0x5B, 0x18, 0x6B, 0x18, 0x7B, 0x18, 0x8C, 0x18, 0x9C, 0x18, 0xAC, 0x18, 0xBC, 0x18, 0xCC, 0x18, 0xDB, 0x18, 0xEB, 0x18, 0xFB, 0x18, 0x0B, 0x19, 0x1A, 0x19, 0x2A, 0x19, 0x39, 0x19, 0x49, 0x19, 0x58, 0x19, 0x67, 0x19, 0x77, 0x19, 0x86, 0x19, 0x95, 0x19, 0xA4, 0x19, 0xB3, 0x19, 0xC2, 0x19, 0xD1, 0x19, 0xE0, 0x19, 0xEE, 0x19, 0xFD, 0x19, 0x0C, 0x1A, 0x1A, 0x1A, 0x29, 0x1A, 0x37, 0x1A, 0x46, 0x1A, 0x54, 0x1A, 0x62, 0x1A, 0x70, 0x1A, 0x7F, 0x1A, 0x8D, 0x1A, 0x9B, 0x1A, 0xA8, 0x1A, 0xB6, 0x1A, 0xC4, 0x1A, 0xD2, 0x1A, 0xE0, 0x1A, 0xED, 0x1A, 0xFB, 0x1A, 0x08, 0x1B, 0x16, 0x1B, 0x23, 0x1B, 0x30, 0x1B, 0x3D, 0x1B, 0x4B, 0x1B, 0x58, 0x1B, 0x65, 0x1B, 0x72, 0x1B, 0x7F, 0x1B, 0x8B, 0x1B, 0x98, 0x1B, 0xA5, 0x1B, 0xB1, 0x1B, 0xBE, 0x1B, 0xCA, 0x1B, 0xD7, 0x1B, 0xE3, 0x1B, 0xF0, 0x1B, 0xFC, 0x1B, 0x08, 0x1C, 0x14, 0x1C, 0x20, 0x1C, 0x2C, 0x1C, 0x38, 0x1C, 0x44, 0x1C, 0x4F, 0x1C, 0x5B, 0x1C, 0x67, 0x1C, 0x72, 0x1C, 0x7E, 0x1C, 0x89, 0x1C, 0x94, 0x1C, 0xA0, 0x1C, 0xAB, 0x1C, 0xB6, 0x1C, 0xC1, 0x1C, 0xCC, 0x1C, 0xD7, 0x1C, 0xE2, 0x1C, 0xED, 0x1C, 0xF7, 0x1C, 0x02, 0x1D, 0x0C, 0x1D, 0x17, 0x1D, 0x21, 0x1D, 0x2C, 0x1D, 0x36, 0x1D, 0x40, 0x1D, 0x4A, 0x1D, 0x55, 0x1D, 0x5F, 0x1D, 0x68, 0x1D, 0x72, 0x1D, 0x7C, 0x1D, 0x86, 0x1D, 0x8F, 0x1D, 0x99, 0x1D, 0xA3, 0x1D, 0xAC, 0x1D, 0xB5, 0x1D, 0xBF, 0x1D, 0xC8, 0x1D, 0xD1, 0x1D, 0xDA, 0x1D, 0xE3, 0x1D, 0xEC, 0x1D, 0xF5, 0x1D, 0xFE, 0x1D, 0x06, 0x1E, 0x0F, 0x1E, 0x18, 0x1E, 0x20, 0x1E, 0x29, 0x1E, 0x31, 0x1E, 0x39, 0x1E, 0x41, 0x1E, 0x4A, 0x1E, 0x52, 0x1E, 0x5A, 0x1E, 0x62, 0x1E, 0x69, 0x1E, 0x71, 0x1E, 0x79, 0x1E, 0x81, 0x1E, 0x88, 0x1E, 0x90, 0x1E, 0x97, 0x1E, 0x9E, 0x1E, 0xA6, 0x1E, 0xAD, 0x1E, 0xB4, 0x1E, 0xBB, 0x1E, 0xC2, 0x1E, 0xC9, 0x1E, 0xD0, 0x1E, 0xD6, 0x1E, 0xDD, 0x1E, 0xE4, 0x1E, 0xEA, 0x1E, 0xF1, 0x1E, 0xF7, 0x1E, 0xFD, 0x1E, 0x03, 0x1F, 0x0A, 0x1F, 0x10, 0x1F, 0x16, 0x1F, 0x1C, 0x1F, 0x21, 0x1F, 0x27, 0x1F, 0x2D, 0x1F, 0x32, 0x1F, 0x38, 0x1F, 0x3D, 0x1F, 0x43, 0x1F, 0x48, 0x1F, 0x4D, 0x1F, 0x53, 0x1F, 0x58, 0x1F, 0x5D, 0x1F, 0x62, 0x1F, 0x66, 0x1F, 0x6B, 0x1F, 0x70, 0x1F, 0x75, 0x1F, 0x79, 0x1F, 0x7E, 0x1F, 0x82, 0x1F, 0x86, 0x1F, 0x8B, 0x1F, 0x8F, 0x1F, 0x93, 0x1F, 0x97, 0x1F, 0x9B, 0x1F, 0x9F, 0x1F, 0xA3, 0x1F, 0xA6, 0x1F, 0xAA, 0x1F, 0xAE, 0x1F, 0xB1, 0x1F, 0xB4, 0x1F, 0xB8, 0x1F, 0xBB, 0x1F, 0xBE, 0x1F, 0xC1, 0x1F, 0xC4, 0x1F, 0xC7, 0x1F, 0xCA, 0x1F, 0xCD, 0x1F, 0xD0, 0x1F, 0xD2, 0x1F, 0xD5, 0x1F, 0xD8, 0x1F, 0xDA, 0x1F, 0xDC, 0x1F, 0xDF, 0x1F, 0xE1, 0x1F, 0xE3, 0x1F, 0xE5, 0x1F, 0xE7, 0x1F, 0xE9, 0x1F, 0xEB, 0x1F, 0xEC, 0x1F, 0xEE, 0x1F, 0xF0, 0x1F, 0xF1, 0x1F, 0xF3, 0x1F, 0xF4, 0x1F, 0xF5, 0x1F, 0xF6, 0x1F, 0xF7, 0x1F, 0xF8, 0x1F, 0xF9, 0x1F, 0xFA, 0x1F, 0xFB, 0x1F, 0xFC, 0x1F, 0xFD, 0x1F, 0xFD, 0x1F, 0xFE, 0x1F, 0xFE, 0x1F, 0xFE, 0x1F, 0xFF, 0x1F, 0xFF, 0x1F, 0xFF, 0x1F, 0xFF, 0x1F, 0xFF, 0x1F, 0xFF, 0x1F, 0xFF, 0x1F, 0xFE, 0x1F, 0xFE, 0x1F, 0xFE, 0x1F, 0xFD, 0x1F, 0xFD, 0x1F, 0xFC, 0x1F, 0xFB, 0x1F, 0xFA, 0x1F, 0xF9, 0x1F, 0xF8, 0x1F, 0xF7, 0x1F, 0xF6, 0x1F, 0xF5, 0x1F, 0xF4, 0x1F, 0xF3, 0x1F, 0xF1, 0x1F, 0xF0, 0x1F, 0xEE, 0x1F, 0xEC, 0x1F, 0xEB, 0x1F, 0xE9, 0x1F, 0xE7, 0x1F, 0xE5, 0x1F, 0xE3, 0x1F, 0xE1, 0x1F, 0xDF, 0x1F, 0xDC, 0x1F, 0xDA, 0x1F, 0xD8, 0x1F, 0xD5, 0x1F, 0xD2, 0x1F, 0xD0, 0x1F, 0xCD, 0x1F, 0xCA, 0x1F, 0xC7, 0x1F, 0xC4, 0x1F, 0xC1, 0x1F, 0xBE, 0x1F, 0xBB, 0x1F, 0xB8, 0x1F, 0xB4, 0x1F, 0xB1, 0x1F, 0xAE, 0x1F, 0xAA, 0x1F, 0xA6, 0x1F, 0xA3, 0x1F, 0x9F, 0x1F, 0x9B, 0x1F, 0x97, 0x1F, 0x93, 0x1F, 0x8F, 0x1F, 0x8B, 0x1F, 0x86, 0x1F, 0x82, 0x1F, 0x7E, 0x1F, 0x79, 0x1F, 0x75, 0x1F, 0x70, 0x1F, 0x6B, 0x1F, 0x66, 0x1F, 0x62, 0x1F, 0x5D, 0x1F, 0x58, 0x1F, 0x53, 0x1F, 0x4D, 0x1F, 0x48, 0x1F, 0x43, 0x1F, 0x3D, 0x1F, 0x38, 0x1F, 0x32, 0x1F, 0x2D, 0x1F, 0x27, 0x1F, 0x21, 0x1F, 0x1C, 0x1F, 0x16, 0x1F, 0x10, 0x1F, 0x0A, 0x1F, 0x03, 0x1F, 0xFD, 0x1E, 0xF7, 0x1E, 0xF1, 0x1E, 0xEA, 0x1E, 0xE4, 0x1E, 0xDD, 0x1E, 0xD6, 0x1E, 0xD0, 0x1E, 0xC9, 0x1E, 0xC2, 0x1E, 0xBB, 0x1E, 0xB4, 0x1E, 0xAD, 0x1E, 0xA6, 0x1E, 0x9E, 0x1E, 0x97, 0x1E, 0x90, 0x1E, 0x88, 0x1E, 0x81, 0x1E, 0x79, 0x1E, 0x71, 0x1E, 0x69, 0x1E, 0x62, 0x1E, 0x5A, 0x1E, 0x52, 0x1E, 0x4A, 0x1E, 0x41, 0x1E, 0x39, 0x1E, 0x31, 0x1E, 0x29, 0x1E, 0x20, 0x1E, 0x18, 0x1E, 0x0F, 0x1E, 0x06, 0x1E, 0xFE, 0x1D, 0xF5, 0x1D, 0xEC, 0x1D, 0xE3, 0x1D, 0xDA, 0x1D, 0xD1, 0x1D, 0xC8, 0x1D, 0xBF, 0x1D, 0xB5, 0x1D, 0xAC, 0x1D, 0xA3, 0x1D, 0x99, 0x1D, 0x8F, 0x1D, 0x86, 0x1D, 0x7C, 0x1D, 0x72, 0x1D, 0x68, 0x1D, 0x5F, 0x1D, 0x55, 0x1D, 0x4A, 0x1D, 0x40, 0x1D, 0x36, 0x1D, 0x2C, 0x1D, 0x21, 0x1D, 0x17, 0x1D, 0x0C, 0x1D, 0x02, 0x1D, 0xF7, 0x1C, 0xED, 0x1C, 0xE2, 0x1C, 0xD7, 0x1C, 0xCC, 0x1C, 0xC1, 0x1C, 0xB6, 0x1C, 0xAB, 0x1C, 0xA0, 0x1C, 0x94, 0x1C, 0x89, 0x1C, 0x7E, 0x1C, 0x72, 0x1C, 0x67, 0x1C, 0x5B, 0x1C, 0x4F, 0x1C, 0x44, 0x1C, 0x38, 0x1C, 0x2C, 0x1C, 0x20, 0x1C, 0x14, 0x1C, 0x08, 0x1C, 0xFC, 0x1B, 0xF0, 0x1B, 0xE3, 0x1B, 0xD7, 0x1B, 0xCA, 0x1B, 0xBE, 0x1B, 0xB1, 0x1B, 0xA5, 0x1B, 0x98, 0x1B, 0x8B, 0x1B, 0x7F, 0x1B, 0x72, 0x1B, 0x65, 0x1B, 0x58, 0x1B, 0x4B, 0x1B, 0x3D, 0x1B, 0x30, 0x1B, 0x23, 0x1B, 0x16, 0x1B, 0x08, 0x1B, 0xFB, 0x1A, 0xED, 0x1A, 0xE0, 0x1A, 0xD2, 0x1A, 0xC4, 0x1A, 0xB6, 0x1A, 0xA8, 0x1A, 0x9B, 0x1A, 0x8D, 0x1A, 0x7F, 0x1A, 0x70, 0x1A, 0x62, 0x1A, 0x54, 0x1A, 0x46, 0x1A, 0x37, 0x1A, 0x29, 0x1A, 0x1A, 0x1A, 0x0C, 0x1A, 0xFD, 0x19, 0xEE, 0x19, 0xE0, 0x19, 0xD1, 0x19, 0xC2, 0x19, 0xB3, 0x19, 0xA4, 0x19, 0x95, 0x19, 0x86, 0x19, 0x77, 0x19, 0x67, 0x19, 0x58, 0x19, 0x49, 0x19, 0x39, 0x19, 0x2A, 0x19, 0x1A, 0x19, 0x0B, 0x19, 0xFB, 0x18, 0xEB, 0x18, 0xDB, 0x18, 0xCC, 0x18, 0xBC, 0x18, 0xAC, 0x18, 0x9C, 0x18, 0x8C, 0x18, 0x7B, 0x18, 0x6B, 0x18, 0x5B, 0x18, 0x4B, 0x18, 0x3A, 0x18, 0x2A, 0x18, 0x19, 0x18, 0x09, 0x18, 0xF8, 0x17, 0xE8, 0x17, 0xD7, 0x17, 0xC6, 0x17, 0xB5, 0x17, 0xA4, 0x17, 0x93, 0x17, 0x82, 0x17, 0x71, 0x17, 0x60, 0x17, 0x4F, 0x17, 0x3E, 0x17, 0x2C, 0x17, 0x1B, 0x17, 0x0A, 0x17, 0xF8, 0x16, 0xE7, 0x16, 0xD5, 0x16, 0xC3, 0x16, 0xB2, 0x16, 0xA0, 0x16, 0x8E, 0x16, 0x7C, 0x16, 0x6A, 0x16, 0x58, 0x16, 0x46, 0x16, 0x34, 0x16, 0x22, 0x16, 0x10, 0x16, 0xFE, 0x15, 0xEC, 0x15, 0xD9, 0x15, 0xC7, 0x15, 0xB4, 0x15, 0xA2, 0x15, 0x8F, 0x15, 0x7D, 0x15, 0x6A, 0x15, 0x57, 0x15, 0x45, 0x15, 0x32, 0x15, 0x1F, 0x15, 0x0C, 0x15, 0xF9, 0x14, 0xE6, 0x14, 0xD3, 0x14, 0xC0, 0x14, 0xAD, 0x14, 0x9A, 0x14, 0x86, 0x14, 0x73, 0x14, 0x60, 0x14, 0x4C, 0x14, 0x39, 0x14, 0x25, 0x14, 0x12, 0x14, 0xFE, 0x13, 0xEB, 0x13, 0xD7, 0x13, 0xC3, 0x13, 0xAF, 0x13, 0x9C, 0x13, 0x88, 0x13, 0x74, 0x13, 0x60, 0x13, 0x4C, 0x13, 0x38, 0x13, 0x24, 0x13, 0x0F, 0x13, 0xFB, 0x12, 0xE7, 0x12, 0xD3, 0x12, 0xBE, 0x12, 0xAA, 0x12, 0x95, 0x12, 0x81, 0x12, 0x6C, 0x12, 0x58, 0x12, 0x43, 0x12, 0x2F, 0x12, 0x1A, 0x12, 0x05, 0x12, 0xF0, 0x11, 0xDC, 0x11, 0xC7, 0x11, 0xB2, 0x11, 0x9D, 0x11, 0x88, 0x11, 0x73, 0x11, 0x5E, 0x11, 0x49, 0x11, 0x33, 0x11, 0x1E, 0x11, 0x09, 0x11, 0xF4, 0x10, 0xDE, 0x10, 0xC9, 0x10, 0xB3, 0x10, 0x9E, 0x10, 0x89, 0x10, 0x73, 0x10, 0x5D, 0x10, 0x48, 0x10, 0x32, 0x10, 0x1C, 0x10, 0x07, 0x10, 0xF1, 0x0F, 0xDB, 0x0F, 0xC5, 0x0F, 0xAF, 0x0F, 0x9A, 0x0F, 0x84, 0x0F, 0x6E, 0x0F, 0x58, 0x0F, 0x41, 0x0F, 0x2B, 0x0F, 0x15, 0x0F, 0xFF, 0x0E, 0xE9, 0x0E, 0xD3, 0x0E, 0xBC, 0x0E, 0xA6, 0x0E, 0x90, 0x0E, 0x79, 0x0E, 0x63, 0x0E, 0x4C, 0x0E, 0x36, 0x0E, 0x1F, 0x0E, 0x09, 0x0E, 0xF2, 0x0D, 0xDB, 0x0D, 0xC5, 0x0D, 0xAE, 0x0D, 0x97, 0x0D, 0x81, 0x0D, 0x6A, 0x0D, 0x53, 0x0D, 0x3C, 0x0D, 0x25, 0x0D, 0x0E, 0x0D, 0xF7, 0x0C, 0xE0, 0x0C, 0xC9, 0x0C, 0xB2, 0x0C, 0x9B, 0x0C, 0x84, 0x0C, 0x6D, 0x0C, 0x56, 0x0C, 0x3F, 0x0C, 0x27, 0x0C, 0x10, 0x0C, 0xF9, 0x0B, 0xE1, 0x0B, 0xCA, 0x0B, 0xB3, 0x0B, 0x9B, 0x0B, 0x84, 0x0B, 0x6C, 0x0B, 0x55, 0x0B, 0x3D, 0x0B, 0x26, 0x0B, 0x0E, 0x0B, 0xF7, 0x0A, 0xDF, 0x0A, 0xC7, 0x0A, 0xB0, 0x0A, 0x98, 0x0A, 0x80, 0x0A, 0x69, 0x0A, 0x51, 0x0A, 0x39, 0x0A, 0x21, 0x0A, 0x09, 0x0A, 0xF1, 0x09, 0xDA, 0x09, 0xC2, 0x09, 0xAA, 0x09, 0x92, 0x09, 0x7A, 0x09, 0x62, 0x09, 0x4A, 0x09, 0x32, 0x09, 0x1A, 0x09, 0x01, 0x09, 0xE9, 0x08, 0xD1, 0x08, 0xB9, 0x08, 0xA1, 0x08, 0x89, 0x08, 0x70, 0x08, 0x58, 0x08, 0x40, 0x08, 0x28, 0x08, 0x0F, 0x08, 0xF7, 0x07, 0xDF, 0x07, 0xC6, 0x07, 0xAE, 0x07, 0x95, 0x07, 0x7D, 0x07, 0x65, 0x07, 0x4C, 0x07, 0x34, 0x07, 0x1B, 0x07, 0x03, 0x07, 0xEA, 0x06, 0xD2, 0x06, 0xB9, 0x06, 0xA0, 0x06, 0x88, 0x06, 0x6F, 0x06, 0x57, 0x06, 0x3E, 0x06, 0x25, 0x06, 0x0D, 0x06, 0xF4, 0x05, 0xDB, 0x05, 0xC3, 0x05, 0xAA, 0x05, 0x91, 0x05, 0x78, 0x05, 0x60, 0x05, 0x47, 0x05, 0x2E, 0x05, 0x15, 0x05, 0xFC, 0x04, 0xE4, 0x04, 0xCB, 0x04, 0xB2, 0x04, 0x99, 0x04, 0x80, 0x04, 0x67, 0x04, 0x4E, 0x04, 0x35, 0x04, 0x1D, 0x04, 0x04, 0x04, 0xEB, 0x03, 0xD2, 0x03, 0xB9, 0x03, 0xA0, 0x03, 0x87, 0x03, 0x6E, 0x03, 0x55, 0x03, 0x3C, 0x03, 0x23, 0x03, 0x0A, 0x03, 0xF1, 0x02, 0xD8, 0x02, 0xBF, 0x02, 0xA6, 0x02, 0x8D, 0x02, 0x74, 0x02, 0x5B, 0x02, 0x42, 0x02, 0x28, 0x02, 0x0F, 0x02, 0xF6, 0x01, 0xDD, 0x01, 0xC4, 0x01, 0xAB, 0x01, 0x92, 0x01, 0x79, 0x01, 0x60, 0x01, 0x47, 0x01, 0x2D, 0x01, 0x14, 0x01, 0xFB, 0x00, 0xE2, 0x00, 0xC9, 0x00, 0xB0, 0x00, 0x97, 0x00, 0x7E, 0x00, 0x65, 0x00, 0x4B, 0x00, 0x32, 0x00, 0x19, 0x00, 0x00, 0x00, 0xE7, 0xFF, 0xCE, 0xFF, 0xB5, 0xFF, 0x9B, 0xFF, 0x82, 0xFF, 0x69, 0xFF, 0x50, 0xFF, 0x37, 0xFF, 0x1E, 0xFF, 0x05, 0xFF, 0xEC, 0xFE, 0xD3, 0xFE, 0xB9, 0xFE, 0xA0, 0xFE, 0x87, 0xFE, 0x6E, 0xFE, 0x55, 0xFE, 0x3C, 0xFE, 0x23, 0xFE, 0x0A, 0xFE, 0xF1, 0xFD, 0xD8, 0xFD, 0xBE, 0xFD, 0xA5, 0xFD, 0x8C, 0xFD, 0x73, 0xFD, 0x5A, 0xFD, 0x41, 0xFD, 0x28, 0xFD, 0x0F, 0xFD, 0xF6, 0xFC, 0xDD, 0xFC, 0xC4, 0xFC, 0xAB, 0xFC, 0x92, 0xFC, 0x79, 0xFC, 0x60, 0xFC, 0x47, 0xFC, 0x2E, 0xFC, 0x15, 0xFC, 0xFC, 0xFB, 0xE3, 0xFB, 0xCB, 0xFB, 0xB2, 0xFB, 0x99, 0xFB, 0x80, 0xFB, 0x67, 0xFB, 0x4E, 0xFB, 0x35, 0xFB, 0x1C, 0xFB, 0x04, 0xFB, 0xEB, 0xFA, 0xD2, 0xFA, 0xB9, 0xFA, 0xA0, 0xFA, 0x88, 0xFA, 0x6F, 0xFA, 0x56, 0xFA, 0x3D, 0xFA, 0x25, 0xFA, 0x0C, 0xFA, 0xF3, 0xF9, 0xDB, 0xF9, 0xC2, 0xF9, 0xA9, 0xF9, 0x91, 0xF9, 0x78, 0xF9, 0x60, 0xF9, 0x47, 0xF9, 0x2E, 0xF9, 0x16, 0xF9, 0xFD, 0xF8, 0xE5, 0xF8, 0xCC, 0xF8, 0xB4, 0xF8, 0x9B, 0xF8, 0x83, 0xF8, 0x6B, 0xF8, 0x52, 0xF8, 0x3A, 0xF8, 0x21, 0xF8, 0x09, 0xF8, 0xF1, 0xF7, 0xD8, 0xF7, 0xC0, 0xF7, 0xA8, 0xF7, 0x90, 0xF7, 0x77, 0xF7, 0x5F, 0xF7, 0x47, 0xF7, 0x2F, 0xF7, 0x17, 0xF7, 0xFF, 0xF6, 0xE6, 0xF6, 0xCE, 0xF6, 0xB6, 0xF6, 0x9E, 0xF6, 0x86, 0xF6, 0x6E, 0xF6, 0x56, 0xF6, 0x3E, 0xF6, 0x26, 0xF6, 0x0F, 0xF6, 0xF7, 0xF5, 0xDF, 0xF5, 0xC7, 0xF5, 0xAF, 0xF5, 0x97, 0xF5, 0x80, 0xF5, 0x68, 0xF5, 0x50, 0xF5, 0x39, 0xF5, 0x21, 0xF5, 0x09, 0xF5, 0xF2, 0xF4, 0xDA, 0xF4, 0xC3, 0xF4, 0xAB, 0xF4, 0x94, 0xF4, 0x7C, 0xF4, 0x65, 0xF4, 0x4D, 0xF4, 0x36, 0xF4, 0x1F, 0xF4, 0x07, 0xF4, 0xF0, 0xF3, 0xD9, 0xF3, 0xC1, 0xF3, 0xAA, 0xF3, 0x93, 0xF3, 0x7C, 0xF3, 0x65, 0xF3, 0x4E, 0xF3, 0x37, 0xF3, 0x20, 0xF3, 0x09, 0xF3, 0xF2, 0xF2, 0xDB, 0xF2, 0xC4, 0xF2, 0xAD, 0xF2, 0x96, 0xF2, 0x7F, 0xF2, 0x69, 0xF2, 0x52, 0xF2, 0x3B, 0xF2, 0x25, 0xF2, 0x0E, 0xF2, 0xF7, 0xF1, 0xE1, 0xF1, 0xCA, 0xF1, 0xB4, 0xF1, 0x9D, 0xF1, 0x87, 0xF1, 0x70, 0xF1, 0x5A, 0xF1, 0x44, 0xF1, 0x2D, 0xF1, 0x17, 0xF1, 0x01, 0xF1, 0xEB, 0xF0, 0xD5, 0xF0, 0xBF, 0xF0, 0xA8, 0xF0, 0x92, 0xF0, 0x7C, 0xF0, 0x66, 0xF0, 0x51, 0xF0, 0x3B, 0xF0, 0x25, 0xF0, 0x0F, 0xF0, 0xF9, 0xEF, 0xE4, 0xEF, 0xCE, 0xEF, 0xB8, 0xEF, 0xA3, 0xEF, 0x8D, 0xEF, 0x77, 0xEF, 0x62, 0xEF, 0x4D, 0xEF, 0x37, 0xEF, 0x22, 0xEF, 0x0C, 0xEF, 0xF7, 0xEE, 0xE2, 0xEE, 0xCD, 0xEE, 0xB7, 0xEE, 0xA2, 0xEE, 0x8D, 0xEE, 0x78, 0xEE, 0x63, 0xEE, 0x4E, 0xEE, 0x39, 0xEE, 0x24, 0xEE, 0x10, 0xEE, 0xFB, 0xED, 0xE6, 0xED, 0xD1, 0xED, 0xBD, 0xED, 0xA8, 0xED, 0x94, 0xED, 0x7F, 0xED, 0x6B, 0xED, 0x56, 0xED, 0x42, 0xED, 0x2D, 0xED, 0x19, 0xED, 0x05, 0xED, 0xF1, 0xEC, 0xDC, 0xEC, 0xC8, 0xEC, 0xB4, 0xEC, 0xA0, 0xEC, 0x8C, 0xEC, 0x78, 0xEC, 0x64, 0xEC, 0x51, 0xEC, 0x3D, 0xEC, 0x29, 0xEC, 0x15, 0xEC, 0x02, 0xEC, 0xEE, 0xEB, 0xDB, 0xEB, 0xC7, 0xEB, 0xB4, 0xEB, 0xA0, 0xEB, 0x8D, 0xEB, 0x7A, 0xEB, 0x66, 0xEB, 0x53, 0xEB, 0x40, 0xEB, 0x2D, 0xEB, 0x1A, 0xEB, 0x07, 0xEB, 0xF4, 0xEA, 0xE1, 0xEA, 0xCE, 0xEA, 0xBB, 0xEA, 0xA9, 0xEA, 0x96, 0xEA, 0x83, 0xEA, 0x71, 0xEA, 0x5E, 0xEA, 0x4C, 0xEA, 0x39, 0xEA, 0x27, 0xEA, 0x14, 0xEA, 0x02, 0xEA, 0xF0, 0xE9, 0xDE, 0xE9, 0xCC, 0xE9, 0xBA, 0xE9, 0xA8, 0xE9, 0x96, 0xE9, 0x84, 0xE9, 0x72, 0xE9, 0x60, 0xE9, 0x4E, 0xE9, 0x3D, 0xE9, 0x2B, 0xE9, 0x19, 0xE9, 0x08, 0xE9, 0xF6, 0xE8, 0xE5, 0xE8, 0xD4, 0xE8, 0xC2, 0xE8, 0xB1, 0xE8, 0xA0, 0xE8, 0x8F, 0xE8, 0x7E, 0xE8, 0x6D, 0xE8, 0x5C, 0xE8, 0x4B, 0xE8, 0x3A, 0xE8, 0x29, 0xE8, 0x18, 0xE8, 0x08, 0xE8, 0xF7, 0xE7, 0xE7, 0xE7, 0xD6, 0xE7, 0xC6, 0xE7, 0xB5, 0xE7, 0xA5, 0xE7, 0x95, 0xE7, 0x85, 0xE7, 0x74, 0xE7, 0x64, 0xE7, 0x54, 0xE7, 0x44, 0xE7, 0x34, 0xE7, 0x25, 0xE7, 0x15, 0xE7, 0x05, 0xE7, 0xF5, 0xE6, 0xE6, 0xE6, 0xD6, 0xE6, 0xC7, 0xE6, 0xB7, 0xE6, 0xA8, 0xE6, 0x99, 0xE6, 0x89, 0xE6, 0x7A, 0xE6, 0x6B, 0xE6, 0x5C, 0xE6, 0x4D, 0xE6, 0x3E, 0xE6, 0x2F, 0xE6, 0x20, 0xE6, 0x12, 0xE6, 0x03, 0xE6, 0xF4, 0xE5, 0xE6, 0xE5, 0xD7, 0xE5, 0xC9, 0xE5, 0xBA, 0xE5, 0xAC, 0xE5, 0x9E, 0xE5, 0x90, 0xE5, 0x81, 0xE5, 0x73, 0xE5, 0x65, 0xE5, 0x58, 0xE5, 0x4A, 0xE5, 0x3C, 0xE5, 0x2E, 0xE5, 0x20, 0xE5, 0x13, 0xE5, 0x05, 0xE5, 0xF8, 0xE4, 0xEA, 0xE4, 0xDD, 0xE4, 0xD0, 0xE4, 0xC3, 0xE4, 0xB5, 0xE4, 0xA8, 0xE4, 0x9B, 0xE4, 0x8E, 0xE4, 0x81, 0xE4, 0x75, 0xE4, 0x68, 0xE4, 0x5B, 0xE4, 0x4F, 0xE4, 0x42, 0xE4, 0x36, 0xE4, 0x29, 0xE4, 0x1D, 0xE4, 0x10, 0xE4, 0x04, 0xE4, 0xF8, 0xE3, 0xEC, 0xE3, 0xE0, 0xE3, 0xD4, 0xE3, 0xC8, 0xE3, 0xBC, 0xE3, 0xB1, 0xE3, 0xA5, 0xE3, 0x99, 0xE3, 0x8E, 0xE3, 0x82, 0xE3, 0x77, 0xE3, 0x6C, 0xE3, 0x60, 0xE3, 0x55, 0xE3, 0x4A, 0xE3, 0x3F, 0xE3, 0x34, 0xE3, 0x29, 0xE3, 0x1E, 0xE3, 0x13, 0xE3, 0x09, 0xE3, 0xFE, 0xE2, 0xF4, 0xE2, 0xE9, 0xE2, 0xDF, 0xE2, 0xD4, 0xE2, 0xCA, 0xE2, 0xC0, 0xE2, 0xB6, 0xE2, 0xAB, 0xE2, 0xA1, 0xE2, 0x98, 0xE2, 0x8E, 0xE2, 0x84, 0xE2, 0x7A, 0xE2, 0x71, 0xE2, 0x67, 0xE2, 0x5D, 0xE2, 0x54, 0xE2, 0x4B, 0xE2, 0x41, 0xE2, 0x38, 0xE2, 0x2F, 0xE2, 0x26, 0xE2, 0x1D, 0xE2, 0x14, 0xE2, 0x0B, 0xE2, 0x02, 0xE2, 0xFA, 0xE1, 0xF1, 0xE1, 0xE8, 0xE1, 0xE0, 0xE1, 0xD7, 0xE1, 0xCF, 0xE1, 0xC7, 0xE1, 0xBF, 0xE1, 0xB6, 0xE1, 0xAE, 0xE1, 0xA6, 0xE1, 0x9E, 0xE1, 0x97, 0xE1, 0x8F, 0xE1, 0x87, 0xE1, 0x7F, 0xE1, 0x78, 0xE1, 0x70, 0xE1, 0x69, 0xE1, 0x62, 0xE1, 0x5A, 0xE1, 0x53, 0xE1, 0x4C, 0xE1, 0x45, 0xE1, 0x3E, 0xE1, 0x37, 0xE1, 0x30, 0xE1, 0x2A, 0xE1, 0x23, 0xE1, 0x1C, 0xE1, 0x16, 0xE1, 0x0F, 0xE1, 0x09, 0xE1, 0x03, 0xE1, 0xFD, 0xE0, 0xF6, 0xE0, 0xF0, 0xE0, 0xEA, 0xE0, 0xE4, 0xE0, 0xDF, 0xE0, 0xD9, 0xE0, 0xD3, 0xE0, 0xCE, 0xE0, 0xC8, 0xE0, 0xC3, 0xE0, 0xBD, 0xE0, 0xB8, 0xE0, 0xB3, 0xE0, 0xAD, 0xE0, 0xA8, 0xE0, 0xA3, 0xE0, 0x9E, 0xE0, 0x9A, 0xE0, 0x95, 0xE0, 0x90, 0xE0, 0x8B, 0xE0, 0x87, 0xE0, 0x82, 0xE0, 0x7E, 0xE0, 0x7A, 0xE0, 0x75, 0xE0, 0x71, 0xE0, 0x6D, 0xE0, 0x69, 0xE0, 0x65, 0xE0, 0x61, 0xE0, 0x5D, 0xE0, 0x5A, 0xE0, 0x56, 0xE0, 0x52, 0xE0, 0x4F, 0xE0, 0x4C, 0xE0, 0x48, 0xE0, 0x45, 0xE0, 0x42, 0xE0, 0x3F, 0xE0, 0x3C, 0xE0, 0x39, 0xE0, 0x36, 0xE0, 0x33, 0xE0, 0x30, 0xE0, 0x2E, 0xE0, 0x2B, 0xE0, 0x28, 0xE0, 0x26, 0xE0, 0x24, 0xE0, 0x21, 0xE0, 0x1F, 0xE0, 0x1D, 0xE0, 0x1B, 0xE0, 0x19, 0xE0, 0x17, 0xE0, 0x15, 0xE0, 0x14, 0xE0, 0x12, 0xE0, 0x10, 0xE0, 0x0F, 0xE0, 0x0D, 0xE0, 0x0C, 0xE0, 0x0B, 0xE0, 0x0A, 0xE0, 0x09, 0xE0, 0x08, 0xE0, 0x07, 0xE0, 0x06, 0xE0, 0x05, 0xE0, 0x04, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x02, 0xE0, 0x02, 0xE0, 0x02, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xE0, 0x02, 0xE0, 0x02, 0xE0, 0x02, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x04, 0xE0, 0x05, 0xE0, 0x06, 0xE0, 0x07, 0xE0, 0x08, 0xE0, 0x09, 0xE0, 0x0A, 0xE0, 0x0B, 0xE0, 0x0C, 0xE0, 0x0D, 0xE0, 0x0F, 0xE0, 0x10, 0xE0, 0x12, 0xE0, 0x14, 0xE0, 0x15, 0xE0, 0x17, 0xE0, 0x19, 0xE0, 0x1B, 0xE0, 0x1D, 0xE0, 0x1F, 0xE0, 0x21, 0xE0, 0x24, 0xE0, 0x26, 0xE0, 0x28, 0xE0, 0x2B, 0xE0, 0x2E, 0xE0, 0x30, 0xE0, 0x33, 0xE0, 0x36, 0xE0, 0x39, 0xE0, 0x3C, 0xE0, 0x3F, 0xE0, 0x42, 0xE0, 0x45, 0xE0, 0x48, 0xE0, 0x4C, 0xE0, 0x4F, 0xE0, 0x52, 0xE0, 0x56, 0xE0, 0x5A, 0xE0, 0x5D, 0xE0, 0x61, 0xE0, 0x65, 0xE0, 0x69, 0xE0, 0x6D, 0xE0, 0x71, 0xE0, 0x75, 0xE0, 0x7A, 0xE0, 0x7E, 0xE0, 0x82, 0xE0, 0x87, 0xE0, 0x8B, 0xE0, 0x90, 0xE0, 0x95, 0xE0, 0x9A, 0xE0, 0x9E, 0xE0, 0xA3, 0xE0, 0xA8, 0xE0, 0xAD, 0xE0, 0xB3, 0xE0, 0xB8, 0xE0, 0xBD, 0xE0, 0xC3, 0xE0, 0xC8, 0xE0, 0xCE, 0xE0, 0xD3, 0xE0, 0xD9, 0xE0, 0xDF, 0xE0, 0xE4, 0xE0, 0xEA, 0xE0, 0xF0, 0xE0, 0xF6, 0xE0, 0xFD, 0xE0, 0x03, 0xE1, 0x09, 0xE1, 0x0F, 0xE1, 0x16, 0xE1, 0x1C, 0xE1, 0x23, 0xE1, 0x2A, 0xE1, 0x30, 0xE1, 0x37, 0xE1, 0x3E, 0xE1, 0x45, 0xE1, 0x4C, 0xE1, 0x53, 0xE1, 0x5A, 0xE1, 0x62, 0xE1, 0x69, 0xE1, 0x70, 0xE1, 0x78, 0xE1, 0x7F, 0xE1, 0x87, 0xE1, 0x8F, 0xE1, 0x97, 0xE1, 0x9E, 0xE1, 0xA6, 0xE1, 0xAE, 0xE1, 0xB6, 0xE1, 0xBF, 0xE1, 0xC7, 0xE1, 0xCF, 0xE1, 0xD7, 0xE1, 0xE0, 0xE1, 0xE8, 0xE1, 0xF1, 0xE1, 0xFA, 0xE1, 0x02, 0xE2, 0x0B, 0xE2, 0x14, 0xE2, 0x1D, 0xE2, 0x26, 0xE2, 0x2F, 0xE2, 0x38, 0xE2, 0x41, 0xE2, 0x4B, 0xE2, 0x54, 0xE2, 0x5D, 0xE2, 0x67, 0xE2, 0x71, 0xE2, 0x7A, 0xE2, 0x84, 0xE2, 0x8E, 0xE2, 0x98, 0xE2, 0xA1, 0xE2, 0xAB, 0xE2, 0xB6, 0xE2, 0xC0, 0xE2, 0xCA, 0xE2, 0xD4, 0xE2, 0xDF, 0xE2, 0xE9, 0xE2, 0xF4, 0xE2, 0xFE, 0xE2, 0x09, 0xE3, 0x13, 0xE3, 0x1E, 0xE3, 0x29, 0xE3, 0x34, 0xE3, 0x3F, 0xE3, 0x4A, 0xE3, 0x55, 0xE3, 0x60, 0xE3, 0x6C, 0xE3, 0x77, 0xE3, 0x82, 0xE3, 0x8E, 0xE3, 0x99, 0xE3, 0xA5, 0xE3, 0xB1, 0xE3, 0xBC, 0xE3, 0xC8, 0xE3, 0xD4, 0xE3, 0xE0, 0xE3, 0xEC, 0xE3, 0xF8, 0xE3, 0x04, 0xE4, 0x10, 0xE4, 0x1D, 0xE4, 0x29, 0xE4, 0x36, 0xE4, 0x42, 0xE4, 0x4F, 0xE4, 0x5B, 0xE4, 0x68, 0xE4, 0x75, 0xE4, 0x81, 0xE4, 0x8E, 0xE4, 0x9B, 0xE4, 0xA8, 0xE4, 0xB5, 0xE4, 0xC3, 0xE4, 0xD0, 0xE4, 0xDD, 0xE4, 0xEA, 0xE4, 0xF8, 0xE4, 0x05, 0xE5, 0x13, 0xE5, 0x20, 0xE5, 0x2E, 0xE5, 0x3C, 0xE5, 0x4A, 0xE5, 0x58, 0xE5, 0x65, 0xE5, 0x73, 0xE5, 0x81, 0xE5, 0x90, 0xE5, 0x9E, 0xE5, 0xAC, 0xE5, 0xBA, 0xE5, 0xC9, 0xE5, 0xD7, 0xE5, 0xE6, 0xE5, 0xF4, 0xE5, 0x03, 0xE6, 0x12, 0xE6, 0x20, 0xE6, 0x2F, 0xE6, 0x3E, 0xE6, 0x4D, 0xE6, 0x5C, 0xE6, 0x6B, 0xE6, 0x7A, 0xE6, 0x89, 0xE6, 0x99, 0xE6, 0xA8, 0xE6, 0xB7, 0xE6, 0xC7, 0xE6, 0xD6, 0xE6, 0xE6, 0xE6, 0xF5, 0xE6, 0x05, 0xE7, 0x15, 0xE7, 0x25, 0xE7, 0x34, 0xE7, 0x44, 0xE7, 0x54, 0xE7, 0x64, 0xE7, 0x74, 0xE7, 0x85, 0xE7, 0x95, 0xE7, 0xA5, 0xE7, 0xB5, 0xE7, 0xC6, 0xE7, 0xD6, 0xE7, 0xE7, 0xE7, 0xF7, 0xE7, 0x08, 0xE8, 0x18, 0xE8, 0x29, 0xE8, 0x3A, 0xE8, 0x4B, 0xE8, 0x5C, 0xE8, 0x6D, 0xE8, 0x7E, 0xE8, 0x8F, 0xE8, 0xA0, 0xE8, 0xB1, 0xE8, 0xC2, 0xE8, 0xD4, 0xE8, 0xE5, 0xE8, 0xF6, 0xE8, 0x08, 0xE9, 0x19, 0xE9, 0x2B, 0xE9, 0x3D, 0xE9, 0x4E, 0xE9, 0x60, 0xE9, 0x72, 0xE9, 0x84, 0xE9, 0x96, 0xE9, 0xA8, 0xE9, 0xBA, 0xE9, 0xCC, 0xE9, 0xDE, 0xE9, 0xF0, 0xE9, 0x02, 0xEA, 0x14, 0xEA, 0x27, 0xEA, 0x39, 0xEA, 0x4C, 0xEA, 0x5E, 0xEA, 0x71, 0xEA, 0x83, 0xEA, 0x96, 0xEA, 0xA9, 0xEA, 0xBB, 0xEA, 0xCE, 0xEA, 0xE1, 0xEA, 0xF4, 0xEA, 0x07, 0xEB, 0x1A, 0xEB, 0x2D, 0xEB, 0x40, 0xEB, 0x53, 0xEB, 0x66, 0xEB, 0x7A, 0xEB, 0x8D, 0xEB, 0xA0, 0xEB, 0xB4, 0xEB, 0xC7, 0xEB, 0xDB, 0xEB, 0xEE, 0xEB, 0x02, 0xEC, 0x15, 0xEC, 0x29, 0xEC, 0x3D, 0xEC, 0x51, 0xEC, 0x64, 0xEC, 0x78, 0xEC, 0x8C, 0xEC, 0xA0, 0xEC, 0xB4, 0xEC, 0xC8, 0xEC, 0xDC, 0xEC, 0xF1, 0xEC, 0x05, 0xED, 0x19, 0xED, 0x2D, 0xED, 0x42, 0xED, 0x56, 0xED, 0x6B, 0xED, 0x7F, 0xED, 0x94, 0xED, 0xA8, 0xED, 0xBD, 0xED, 0xD1, 0xED, 0xE6, 0xED, 0xFB, 0xED, 0x10, 0xEE, 0x24, 0xEE, 0x39, 0xEE, 0x4E, 0xEE, 0x63, 0xEE, 0x78, 0xEE, 0x8D, 0xEE, 0xA2, 0xEE, 0xB7, 0xEE, 0xCD, 0xEE, 0xE2, 0xEE, 0xF7, 0xEE, 0x0C, 0xEF, 0x22, 0xEF, 0x37, 0xEF, 0x4D, 0xEF, 0x62, 0xEF, 0x77, 0xEF, 0x8D, 0xEF, 0xA3, 0xEF, 0xB8, 0xEF, 0xCE, 0xEF, 0xE4, 0xEF, 0xF9, 0xEF, 0x0F, 0xF0, 0x25, 0xF0, 0x3B, 0xF0, 0x51, 0xF0, 0x66, 0xF0, 0x7C, 0xF0, 0x92, 0xF0, 0xA8, 0xF0, 0xBF, 0xF0, 0xD5, 0xF0, 0xEB, 0xF0, 0x01, 0xF1, 0x17, 0xF1, 0x2D, 0xF1, 0x44, 0xF1, 0x5A, 0xF1, 0x70, 0xF1, 0x87, 0xF1, 0x9D, 0xF1, 0xB4, 0xF1, 0xCA, 0xF1, 0xE1, 0xF1, 0xF7, 0xF1, 0x0E, 0xF2, 0x25, 0xF2, 0x3B, 0xF2, 0x52, 0xF2, 0x69, 0xF2, 0x7F, 0xF2, 0x96, 0xF2, 0xAD, 0xF2, 0xC4, 0xF2, 0xDB, 0xF2, 0xF2, 0xF2, 0x09, 0xF3, 0x20, 0xF3, 0x37, 0xF3, 0x4E, 0xF3, 0x65, 0xF3, 0x7C, 0xF3, 0x93, 0xF3, 0xAA, 0xF3, 0xC1, 0xF3, 0xD9, 0xF3, 0xF0, 0xF3, 0x07, 0xF4, 0x1F, 0xF4, 0x36, 0xF4, 0x4D, 0xF4, 0x65, 0xF4, 0x7C, 0xF4, 0x94, 0xF4, 0xAB, 0xF4, 0xC3, 0xF4, 0xDA, 0xF4, 0xF2, 0xF4, 0x09, 0xF5, 0x21, 0xF5, 0x39, 0xF5, 0x50, 0xF5, 0x68, 0xF5, 0x80, 0xF5, 0x97, 0xF5, 0xAF, 0xF5, 0xC7, 0xF5, 0xDF, 0xF5, 0xF7, 0xF5, 0x0F, 0xF6, 0x26, 0xF6, 0x3E, 0xF6, 0x56, 0xF6, 0x6E, 0xF6, 0x86, 0xF6, 0x9E, 0xF6, 0xB6, 0xF6, 0xCE, 0xF6, 0xE6, 0xF6, 0xFF, 0xF6, 0x17, 0xF7, 0x2F, 0xF7, 0x47, 0xF7, 0x5F, 0xF7, 0x77, 0xF7, 0x90, 0xF7, 0xA8, 0xF7, 0xC0, 0xF7, 0xD8, 0xF7, 0xF1, 0xF7, 0x09, 0xF8, 0x21, 0xF8, 0x3A, 0xF8, 0x52, 0xF8, 0x6B, 0xF8, 0x83, 0xF8, 0x9B, 0xF8, 0xB4, 0xF8, 0xCC, 0xF8, 0xE5, 0xF8, 0xFD, 0xF8, 0x16, 0xF9, 0x2E, 0xF9, 0x47, 0xF9, 0x60, 0xF9, 0x78, 0xF9, 0x91, 0xF9, 0xA9, 0xF9, 0xC2, 0xF9, 0xDB, 0xF9, 0xF3, 0xF9, 0x0C, 0xFA, 0x25, 0xFA, 0x3D, 0xFA, 0x56, 0xFA, 0x6F, 0xFA, 0x88, 0xFA, 0xA0, 0xFA, 0xB9, 0xFA, 0xD2, 0xFA, 0xEB, 0xFA, 0x04, 0xFB, 0x1C, 0xFB, 0x35, 0xFB, 0x4E, 0xFB, 0x67, 0xFB, 0x80, 0xFB, 0x99, 0xFB, 0xB2, 0xFB, 0xCB, 0xFB, 0xE3, 0xFB, 0xFC, 0xFB, 0x15, 0xFC, 0x2E, 0xFC, 0x47, 0xFC, 0x60, 0xFC, 0x79, 0xFC, 0x92, 0xFC, 0xAB, 0xFC, 0xC4, 0xFC, 0xDD, 0xFC, 0xF6, 0xFC, 0x0F, 0xFD, 0x28, 0xFD, 0x41, 0xFD, 0x5A, 0xFD, 0x73, 0xFD, 0x8C, 0xFD, 0xA5, 0xFD, 0xBE, 0xFD, 0xD8, 0xFD, 0xF1, 0xFD, 0x0A, 0xFE, 0x23, 0xFE, 0x3C, 0xFE, 0x55, 0xFE, 0x6E, 0xFE, 0x87, 0xFE, 0xA0, 0xFE, 0xB9, 0xFE, 0xD3, 0xFE, 0xEC, 0xFE, 0x05, 0xFF, 0x1E, 0xFF, 0x37, 0xFF, 0x50, 0xFF, 0x69, 0xFF, 0x82, 0xFF, 0x9B, 0xFF, 0xB5, 0xFF, 0xCE, 0xFF, 0xE7, 0xFF };
-volatile int sine_beep_freq;
+TaskHandle_t fwBeepTaskHandle = NULL;
+
+// First quarter of a 2048 point sine wave, inclusive of the peak, amplitude 8191
+static const int16_t sine_beep_quarter[513] = { 0, 25, 50, 75, 101, 126, 151, 176, 201, 226, 251, 276, 301, 327, 352, 377, 402, 427, 452, 477, 502, 527, 552, 578, 603, 628, 653, 678, 703, 728, 753, 778, 803, 828, 853, 878, 903, 928, 953, 978, 1003, 1028, 1053, 1077, 1102, 1127, 1152, 1177, 1202, 1227, 1252, 1276, 1301, 1326, 1351, 1376, 1400, 1425, 1450, 1475, 1499, 1524, 1549, 1573, 1598, 1623, 1647, 1672, 1696, 1721, 1746, 1770, 1795, 1819, 1844, 1868, 1893, 1917, 1941, 1966, 1990, 2015, 2039, 2063, 2088, 2112, 2136, 2160, 2185, 2209, 2233, 2257, 2281, 2305, 2330, 2354, 2378, 2402, 2426, 2450, 2474, 2498, 2522, 2545, 2569, 2593, 2617, 2641, 2665, 2688, 2712, 2736, 2759, 2783, 2807, 2830, 2854, 2877, 2901, 2924, 2948, 2971, 2995, 3018, 3041, 3065, 3088, 3111, 3135, 3158, 3181, 3204, 3227, 3250, 3273, 3296, 3319, 3342, 3365, 3388, 3411, 3434, 3457, 3479, 3502, 3525, 3547, 3570, 3593, 3615, 3638, 3660, 3683, 3705, 3728, 3750, 3772, 3795, 3817, 3839, 3861, 3883, 3905, 3928, 3950, 3972, 3994, 4015, 4037, 4059, 4081, 4103, 4124, 4146, 4168, 4189, 4211, 4233, 4254, 4275, 4297, 4318, 4340, 4361, 4382, 4403, 4425, 4446, 4467, 4488, 4509, 4530, 4551, 4572, 4592, 4613, 4634, 4655, 4675, 4696, 4716, 4737, 4757, 4778, 4798, 4819, 4839, 4859, 4879, 4900, 4920, 4940, 4960, 4980, 5000, 5020, 5039, 5059, 5079, 5099, 5118, 5138, 5157, 5177, 5196, 5216, 5235, 5254, 5274, 5293, 5312, 5331, 5350, 5369, 5388, 5407, 5426, 5445, 5463, 5482, 5501, 5519, 5538, 5556, 5575, 5593, 5612, 5630, 5648, 5666, 5684, 5702, 5720, 5738, 5756, 5774, 5792, 5810, 5827, 5845, 5863, 5880, 5898, 5915, 5932, 5950, 5967, 5984, 6001, 6018, 6035, 6052, 6069, 6086, 6103, 6120, 6136, 6153, 6169, 6186, 6202, 6219, 6235, 6251, 6267, 6284, 6300, 6316, 6332, 6348, 6363, 6379, 6395, 6411, 6426, 6442, 6457, 6473, 6488, 6503, 6519, 6534, 6549, 6564, 6579, 6594, 6609, 6624, 6638, 6653, 6668, 6682, 6697, 6711, 6726, 6740, 6754, 6768, 6783, 6797, 6811, 6824, 6838, 6852, 6866, 6880, 6893, 6907, 6920, 6934, 6947, 6960, 6973, 6987, 7000, 7013, 7026, 7039, 7051, 7064, 7077, 7089, 7102, 7114, 7127, 7139, 7152, 7164, 7176, 7188, 7200, 7212, 7224, 7236, 7247, 7259, 7271, 7282, 7294, 7305, 7316, 7328, 7339, 7350, 7361, 7372, 7383, 7394, 7405, 7415, 7426, 7436, 7447, 7457, 7468, 7478, 7488, 7498, 7509, 7519, 7528, 7538, 7548, 7558, 7567, 7577, 7587, 7596, 7605, 7615, 7624, 7633, 7642, 7651, 7660, 7669, 7678, 7686, 7695, 7704, 7712, 7721, 7729, 7737, 7745, 7754, 7762, 7770, 7778, 7785, 7793, 7801, 7809, 7816, 7824, 7831, 7838, 7846, 7853, 7860, 7867, 7874, 7881, 7888, 7894, 7901, 7908, 7914, 7921, 7927, 7933, 7939, 7946, 7952, 7958, 7964, 7969, 7975, 7981, 7986, 7992, 7997, 8003, 8008, 8013, 8019, 8024, 8029, 8034, 8038, 8043, 8048, 8053, 8057, 8062, 8066, 8070, 8075, 8079, 8083, 8087, 8091, 8095, 8099, 8102, 8106, 8110, 8113, 8116, 8120, 8123, 8126, 8129, 8132, 8135, 8138, 8141, 8144, 8146, 8149, 8152, 8154, 8156, 8159, 8161, 8163, 8165, 8167, 8169, 8171, 8172, 8174, 8176, 8177, 8179, 8180, 8181, 8182, 8183, 8184, 8185, 8186, 8187, 8188, 8189, 8189, 8190, 8190, 8190, 8191, 8191, 8191, 8191 };
+
+// The HR-C6000 takes beep samples at 8018 Hz, a note's phase step is its frequency times this
+#define BEEP_DDS_STEP_PER_HZ 535666 // 2^32 / 8018, rounded
+
+// Set by the UI task once per note, the beep task generates the samples
+static volatile uint32_t sine_beep_step;
+static volatile uint32_t sine_beep_step2;
 volatile int sine_beep_duration;
 
-int melody_generic[512];
 #define DIT_LENGTH  60
 #define DAH_LENGTH  3 * DIT_LENGTH
-//const int melody_poweron[] = { 440, 300, 466, 300, 494, 300, -1, -1 };
-const int melody_poweron[] = { 880, DAH_LENGTH,
-								0, DIT_LENGTH,
-								880, DIT_LENGTH,
-								0, DIT_LENGTH,
-								880, DAH_LENGTH,
-								0, DIT_LENGTH,
-								880, DIT_LENGTH,
-								0, DIT_LENGTH,
-								880, DAH_LENGTH,
-								-1, -1 };
-const int melody_key_beep[] = { 880, 60, -1, -1 };
-const int melody_sk1_beep[] = { 466, 60, 0, 60, 466, 60, -1, -1 };
-const int melody_sk2_beep[] = { 494, 60, 0, 60, 494, 60, -1, -1 };
-const int melody_orange_beep[] = { 440, 60, 494, 60, 440, 60, 494, 60, -1, -1 };
-const int melody_ACK_beep[] = { 440, 120, 660, 120, 880, 120, -1, -1 };
-const int melody_NACK_beep[] = { 494, 120, 466, 120, -1, -1 };
-const int melody_ERROR_beep[] = { 440, 30, 0, 30, 440, 30, 0, 30, 440, 30, -1, -1 };
-volatile int *melody_play = NULL;
-volatile int melody_idx = 0;
+const melodyNote_t melody_poweron[] = { { 880, 0, DAH_LENGTH },
+								{ 0, 0, DIT_LENGTH },
+								{ 880, 0, DIT_LENGTH },
+								{ 0, 0, DIT_LENGTH },
+								{ 880, 0, DAH_LENGTH },
+								{ 0, 0, DIT_LENGTH },
+								{ 880, 0, DIT_LENGTH },
+								{ 0, 0, DIT_LENGTH },
+								{ 880, 0, DAH_LENGTH },
+								{ 0, 0, 0 } };
+const melodyNote_t melody_key_beep[] = { { 880, 0, 60 }, { 0, 0, 0 } };
+const melodyNote_t melody_sk1_beep[] = { { 466, 0, 60 }, { 0, 0, 60 }, { 466, 0, 60 }, { 0, 0, 0 } };
+const melodyNote_t melody_sk2_beep[] = { { 494, 0, 60 }, { 0, 0, 60 }, { 494, 0, 60 }, { 0, 0, 0 } };
+const melodyNote_t melody_orange_beep[] = { { 440, 0, 60 }, { 494, 0, 60 }, { 440, 0, 60 }, { 494, 0, 60 }, { 0, 0, 0 } };
+const melodyNote_t melody_ACK_beep[] = { { 440, 0, 120 }, { 660, 0, 120 }, { 880, 0, 120 }, { 0, 0, 0 } };
+const melodyNote_t melody_NACK_beep[] = { { 494, 0, 120 }, { 466, 0, 120 }, { 0, 0, 0 } };
+const melodyNote_t melody_ERROR_beep[] = { { 440, 0, 30 }, { 0, 0, 30 }, { 440, 0, 30 }, { 0, 0, 30 }, { 440, 0, 30 }, { 0, 0, 0 } };
+
+// Either a note list or a song of { tone, length } byte pairs is played, both straight from flash
+static const melodyNote_t * volatile melody_play = NULL;
+static const uint8_t * volatile song_play = NULL;
+static int melody_idx = 0;
+static melodyNote_t dtmf_note[2];
+
+static const uint16_t dtmf_row_freq[4] = { 697, 770, 852, 941 };
+static const uint16_t dtmf_col_freq[4] = { 1209, 1336, 1477, 1633 };
+static const char dtmf_keys[] = "123A456B789C*0#D";
+
 /*
 const uint8_t melody1[] = { 21, 4, 21, 2, 26, 10, 26, 2, 26, 4, 26, 2, 26, 6, 21, 6, 18, 4, 19, 2, 21, 10, 18, 2, 16, 4, 19, 2, 18, 6, 0, 6, 18, 4, 18, 2, 26, 10, 26, 2, 26, 4, 25, 2, 25, 6, 23, 6, 25, 4, 26, 2, 28, 10, 25, 2, 25, 4, 23, 2, 21, 6, 0, 6, 21, 4, 21, 2, 26, 10, 26, 2, 26, 4, 26, 2, 26, 6, 23, 6, 23, 4, 23, 2, 28, 10, 28, 2, 28, 4, 23, 2, 25, 6, 0, 6, 21, 4, 21, 2, 30, 10, 30, 2, 30, 4, 30, 2, 30, 6, 28, 6, 26, 4, 23, 2, 21, 10, 22, 2, 23, 4, 19, 2, 18, 6, 0, 6, 21, 4, 21, 2, 30, 10, 30, 2, 30, 4, 30, 2, 33, 6, 31, 6, 23, 4, 22, 2, 21, 10, 26, 2, 28, 4, 26, 2, 26, 12, 0, 0 };
 const uint8_t melody2[] = { 21, 4, 26, 6, 18, 2, 21, 4, 26, 4, 28, 4, 30, 4, 26, 4, 26, 4, 25, 6, 23, 2, 21, 4, 20, 4, 23, 4, 21, 3, 0, 5, 21, 4, 26, 6, 18, 2, 21, 4, 26, 4, 28, 4, 30, 4, 26, 4, 26, 4, 25, 6, 23, 2, 21, 4, 20, 4, 23, 4, 21, 3, 0, 5, 21, 4, 28, 6, 25, 2, 26, 4, 23, 4, 21, 6, 19, 2, 18, 4, 21, 4, 28, 6, 25, 2, 26, 4, 23, 4, 21, 6, 19, 2, 18, 4, 21, 2, 26, 2, 30, 6, 26, 2, 21, 4, 18, 4, 16, 4, 16, 4, 23, 4, 23, 4, 21, 6, 26, 2, 30, 6, 28, 2, 28, 8, 26, 4, 25, 3, 23, 1, 21, 4, 28, 3, 30, 1, 26, 4, 25, 3, 23, 1, 21, 4, 28, 3, 30, 1, 26, 4, 23, 4, 21, 4, 26, 4, 30, 6, 28, 2, 28, 8, 26, 3, 0, 0 };
 const uint8_t melody3[] = { 21, 4, 30, 4, 26, 4, 23, 3, 25, 1, 26, 3, 23, 1, 21, 3, 18, 1, 21, 4, 0, 2, 21, 2, 23, 2, 25, 2, 26, 6, 26, 2, 30, 6, 28, 2, 28, 8, 0, 4, 28, 4, 31, 6, 28, 2, 25, 2, 25, 2, 23, 2, 25, 2, 28, 4, 26, 4, 0, 2, 26, 2, 25, 2, 23, 2, 28, 6, 25, 2, 25, 4, 23, 4, 21, 8, 0, 4, 21, 4, 28, 4, 25, 4, 21, 2, 21, 2, 26, 2, 28, 2, 30, 4, 26, 4, 0, 2, 26, 2, 28, 2, 30, 2, 31, 6, 28, 2, 30, 6, 26, 2, 30, 4, 28, 4, 0, 4, 21, 4, 30, 6, 28, 2, 26, 2, 25, 2, 28, 3, 26, 1, 25, 4, 23, 4, 0, 2, 31, 2, 30, 2, 28, 2, 26, 6, 26, 2, 28, 6, 28, 2, 30, 12, 21, 4, 30, 6, 28, 2, 26, 2, 25, 2, 28, 3, 26, 1, 25, 4, 23, 4, 0, 2, 31, 2, 30, 2, 28, 2, 33, 6, 26, 2, 30, 4, 28, 4, 26, 12, 0, 0 };
 const uint8_t melody4[] = { 18, 2, 22, 2, 25, 4, 25, 4, 25, 2, 27, 2, 23, 2, 20, 2, 18, 4, 22, 4, 22, 4, 0, 2, 22, 2, 20, 6, 22, 2, 23, 4, 25, 4, 23, 4, 22, 4, 0, 4, 25, 4, 25, 6, 22, 2, 30, 6, 29, 2, 29, 6, 27, 2, 27, 4, 27, 4, 25, 6, 27, 2, 25, 2, 22, 2, 23, 2, 20, 2, 20, 4, 18, 4, 0, 2, 22, 4, 20, 4, 25, 4, 25, 4, 29, 4, 29, 2, 27, 2, 30, 2, 29, 2, 27, 4, 20, 4, 20, 4, 27, 4, 27, 4, 30, 4, 30, 2, 29, 2, 32, 2, 30, 2, 29, 2, 27, 2, 25, 2, 23, 2, 25, 6, 22, 2, 30, 6, 29, 2, 29, 2, 27, 2, 27, 4, 0, 4, 27, 4, 25, 6, 27, 2, 25, 2, 22, 2, 23, 2, 20, 2, 20, 4, 18, 4, 0, 4, 23, 2, 25, 6, 22, 2, 30, 6, 29, 2, 29, 2, 27, 2, 27, 4, 0, 2, 27, 4, 25, 6, 27, 2, 25, 2, 22, 2, 23, 2, 20, 2, 20, 4, 18, 4, 0, 0 };
 */
-void set_melody(const int *melody)
+static void start_melody(const melodyNote_t *melody, const uint8_t *song)
 {
 	taskENTER_CRITICAL();
-	sine_beep_freq=0;
+	sine_beep_step=0;
+	sine_beep_step2=0;
 	sine_beep_duration=0;
-	melody_play=(int *)melody;
+	melody_play=melody;
+	song_play=song;
 	melody_idx=0;
 	taskEXIT_CRITICAL();
+
+	if (((melody!=NULL) || (song!=NULL)) && (fwBeepTaskHandle!=NULL))
+	{
+		xTaskNotifyGive(fwBeepTaskHandle);
+	}
+}
+
+void set_melody(const melodyNote_t *melody)
+{
+	start_melody(melody, NULL);
+}
+
+// Plays a song of { tone, length } pairs as written for create_song() before, each note is followed by a short gap
+void set_song(const uint8_t *song)
+{
+	start_melody(NULL, song);
+}
+
+// Plays the row and column tones of a DTMF key together, unknown keys are ignored
+void set_dtmf_tone(char key, int duration)
+{
+	for (int i=0; i<16; i++)
+	{
+		if (dtmf_keys[i]==key)
+		{
+			taskENTER_CRITICAL();
+			dtmf_note[0].freq=dtmf_row_freq[i/4];
+			dtmf_note[0].freq2=dtmf_col_freq[i%4];
+			dtmf_note[0].duration=duration;
+			dtmf_note[1].freq=0;
+			dtmf_note[1].freq2=0;
+			dtmf_note[1].duration=0;
+			taskEXIT_CRITICAL();
+			set_melody(dtmf_note);
+			return;
+		}
+	}
+}
+
+bool melody_is_playing()
+{
+	return ((melody_play!=NULL) || (song_play!=NULL));
 }
 
 int get_freq(int tone)
@@ -142,33 +202,41 @@ int get_freq(int tone)
     return freq;
 }
 
-void create_song(const uint8_t *melody)
+// Fetches the next note of the melody or song, returns false at its end
+static bool get_next_note(melodyNote_t *note)
 {
-	int song_idx = 0;
-	for (int i=0;i<256;i++)
+	if (melody_play!=NULL)
+	{
+		*note=melody_play[melody_idx];
+	}
+	else if ((song_play!=NULL) && (melody_idx < 512))
 	{
-		if (melody[2*i+1]!=0)
+		int length = song_play[melody_idx/2*2+1];
+
+		note->freq2=0;
+		if (melody_idx & 1)
 		{
-			melody_generic[song_idx]=get_freq(melody[2*i]);
-			melody_generic[song_idx+1]=melody[2*i+1]*108;
-			melody_generic[song_idx+2]=0;
-			melody_generic[song_idx+3]=melody[2*i+1]*12;
-			song_idx=song_idx+4;
+			note->freq=0;
+			note->duration=length*12;
 		}
 		else
 		{
-			melody_generic[song_idx]=-1;
-			melody_generic[song_idx+1]=-1;
-			song_idx=song_idx+2;
-			break;
+			note->freq=get_freq(song_play[melody_idx]);
+			note->duration=length*108;
 		}
 	}
+	else
+	{
+		return false;
+	}
+	return (note->duration!=0);
 }
 
 void fw_init_beep_task()
 {
 	taskENTER_CRITICAL();
-	sine_beep_freq = 0;
+	sine_beep_step = 0;
+	sine_beep_step2 = 0;
 	sine_beep_duration = 0;
 	taskEXIT_CRITICAL();
 
@@ -176,21 +244,61 @@ void fw_init_beep_task()
 				"fw beep task",                      /* task name for kernel awareness debugging */
 				1000L / sizeof(portSTACK_TYPE),      /* task stack size */
 				NULL,                      			 /* optional task startup argument */
-				5U,                                  /* initial priority */
-				fwBeepTaskHandle					 /* optional task handle to create */
+				TASK_PRIORITY_AUDIO,                 /* initial priority */
+				&fwBeepTaskHandle					 /* optional task handle to create */
 				);
 }
 
-volatile uint8_t wavbuffer[WAV_BUFFER_COUNT][WAV_BUFFER_SIZE];
-int wavbuffer_read_idx;
-int wavbuffer_write_idx;
-volatile int wavbuffer_count;
-uint8_t tmp_wavbuffer[WAV_BUFFER_SIZE];
-
-uint8_t spi_sound1[WAV_BUFFER_SIZE*2];
-uint8_t spi_sound2[WAV_BUFFER_SIZE*2];
-uint8_t spi_sound3[WAV_BUFFER_SIZE*2];
-uint8_t spi_sound4[WAV_BUFFER_SIZE*2];
+// Single producer, single consumer ring between the codec and the SAI DMA callbacks.
+// Each index runs free and is only advanced by its own side, the fill level is their difference,
+// so neither side has to mask interrupts. Received audio flows codec -> SAI TX, transmitted audio SAI RX -> codec.
+// The vocoder reads and writes the ring frames in place, the only copy left is the conversion to the SAI word format.
+uint8_t wavbuffer[WAV_BUFFER_COUNT][WAV_BUFFER_SIZE] __attribute__((aligned(4)));
+volatile uint32_t wavbuffer_read_idx;
+volatile uint32_t wavbuffer_write_idx;
+
+volatile uint32_t wavbufferOverruns = 0;
+volatile uint32_t wavbufferUnderruns = 0;
+volatile uint32_t wavbufferHighWater = 0;
+
+#define SOUND_RX_BURST_MS            60
+#define SOUND_RX_BURST_FRAMES        6  // 10 ms frames decoded from one voice burst
+#define SOUND_RX_CONCEAL_FRAMES      6  // bridges one lost burst, after that playback stops
+#define SOUND_RX_BOOST_DECAY_BURSTS  50 // 3 s without a late burst gives back one frame
+#define SOUND_RX_SHRINK_BURSTS       16
+
+// RX playback (re)starts once rxStartFrames are buffered. The target adapts to the burst arrival
+// jitter and to late bursts, but never drops below the configured minimum.
+static volatile int rxMinFrames = SOUND_RX_START_FRAMES_DEFAULT;
+static volatile int rxStartFrames = SOUND_RX_START_FRAMES_DEFAULT;
+static int rxLateBoost = 0;
+static int rxBurstsSinceLate = 0;
+static int rxDeepBursts = 0;
+static uint32_t rxLastBurstTimestamp;
+static bool rxLastBurstValid = false;
+static volatile bool rxUnderrunSinceBurst = false;
+static volatile bool rxDropFrame = false;
+static volatile bool rxConcealing = false;
+static volatile int rxConcealedRun = 0;
+
+volatile uint32_t rxJitterCycles = 0;
+volatile uint32_t rxAudioBursts;
+volatile uint32_t rxAudioLateBursts;
+volatile uint32_t rxAudioConcealedFrames;
+volatile uint32_t rxAudioDroppedFrames;
+volatile uint32_t rxAudioDepthMin = 0xFFFFFFFF;
+volatile uint32_t rxAudioDepthMax;
+
+static volatile uint32_t rxAudioStartTimestamp;
+static volatile bool rxAudioStartPending = false;
+volatile uint32_t rxAudioLatencyCount;
+volatile uint32_t rxAudioLatencyLast;
+volatile uint32_t rxAudioLatencyMax;
+volatile uint64_t rxAudioLatencySum;
+
+// Each direction only ever has one SAI transfer in flight, so two DMA buffers are enough
+uint8_t spi_sound1[WAV_BUFFER_SIZE*2] __attribute__((aligned(4)));
+uint8_t spi_sound2[WAV_BUFFER_SIZE*2] __attribute__((aligned(4)));
 
 volatile bool g_TX_SAI_in_use = false;
 volatile bool g_RX_SAI_in_use = false;
@@ -198,22 +306,26 @@ volatile bool g_RX_SAI_in_use = false;
 uint8_t *spi_soundBuf;
 sai_transfer_t xfer;
 
+static bool txSAIPlaying = false;
+
 void init_sound()
 {
-	taskENTER_CRITICAL();
     g_TX_SAI_in_use = false;
     g_RX_SAI_in_use = false;
-	taskEXIT_CRITICAL();
     SAI_TxSoftwareReset(I2S0, kSAI_ResetAll);
 	SAI_TxEnable(I2S0, true);
     SAI_RxSoftwareReset(I2S0, kSAI_ResetAll);
 	SAI_RxEnable(I2S0, true);
 	spi_soundBuf=NULL;
+	txSAIPlaying = false;
 	wavbuffer_read_idx = 0;
 	wavbuffer_write_idx = 0;
-	taskENTER_CRITICAL();
-	wavbuffer_count = 0;
-	taskEXIT_CRITICAL();
+	rxAudioStartPending = false;
+	rxLastBurstValid = false;
+	rxUnderrunSinceBurst = false;
+	rxDropFrame = false;
+	rxConcealing = false;
+	rxConcealedRun = 0;
 }
 
 void terminate_sound()
@@ -222,276 +334,559 @@ void terminate_sound()
     SAI_TransferTerminateSendEDMA(I2S0, &g_SAI_RX_Handle);
 }
 
-void store_soundbuffer()
+int get_wavbuffer_count()
 {
-	taskENTER_CRITICAL();
-	int tmp_wavbuffer_count = wavbuffer_count;
-	taskEXIT_CRITICAL();
+	return (int)(wavbuffer_write_idx - wavbuffer_read_idx);
+}
+
+// Producer side, returns the frame to fill or NULL when the ring is full.
+// The frame belongs to the caller until commit_soundbuffer_write().
+uint8_t *get_soundbuffer_write_frame()
+{
+	if ((wavbuffer_write_idx - wavbuffer_read_idx) >= WAV_BUFFER_COUNT)
+	{
+		wavbufferOverruns++;
+		return NULL;
+	}
+	return wavbuffer[wavbuffer_write_idx & (WAV_BUFFER_COUNT - 1)];
+}
+
+void commit_soundbuffer_write()
+{
+	uint32_t count;
+
+	__DMB();// the frame has to be complete before the consumer can see it
+	wavbuffer_write_idx++;
+
+	count = wavbuffer_write_idx - wavbuffer_read_idx;
+	if (count > wavbufferHighWater)
+	{
+		wavbufferHighWater = count;
+	}
+}
+
+// Consumer side, returns the oldest frame or NULL when the ring is empty.
+// The frame belongs to the caller until commit_soundbuffer_read().
+uint8_t *get_soundbuffer_read_frame()
+{
+	if (wavbuffer_write_idx == wavbuffer_read_idx)
+	{
+		return NULL;
+	}
+	__DMB();// read the frame only after seeing the producer's index
+	return wavbuffer[wavbuffer_read_idx & (WAV_BUFFER_COUNT - 1)];
+}
+
+void commit_soundbuffer_read()
+{
+	__DMB();// done with the frame before the producer may reuse it
+	wavbuffer_read_idx++;
+}
+
+void set_rx_audio_start_frames(int frames)
+{
+	if (frames < 1)
+	{
+		frames = 1;
+	}
+	else if (frames > SOUND_RX_START_FRAMES_MAX)
+	{
+		frames = SOUND_RX_START_FRAMES_MAX;
+	}
+	rxMinFrames = frames;
+	rxStartFrames = frames;
+	rxLateBoost = 0;
+}
 
-	if (tmp_wavbuffer_count<WAV_BUFFER_COUNT)
+// Called from the HR-C6000 task for every voice burst, before it is decoded.
+// irqTimestamp is the DWT count of the interrupt that delivered it.
+void rx_audio_burst_arrived(uint32_t irqTimestamp)
+{
+	uint32_t burstCycles = (SystemCoreClock / 1000) * SOUND_RX_BURST_MS;
+	uint32_t frameCycles = SystemCoreClock / 100;
+	uint32_t depth = get_wavbuffer_count();
+	int extraFrames;
+	int target;
+	int slack;
+	bool underrun;
+
+	rxAudioBursts++;
+	if (depth < rxAudioDepthMin)
+	{
+		rxAudioDepthMin = depth;
+	}
+	if (depth > rxAudioDepthMax)
 	{
-		taskENTER_CRITICAL();
-		for (int wav_idx=0;wav_idx<WAV_BUFFER_SIZE;wav_idx++)
+		rxAudioDepthMax = depth;
+	}
+
+	// Smoothed deviation from the 60 ms burst period, a gap from a lost burst is not jitter
+	if (rxLastBurstValid)
+	{
+		uint32_t interval = irqTimestamp - rxLastBurstTimestamp;
+		if (interval < (burstCycles + burstCycles / 2))
 		{
-			wavbuffer[wavbuffer_write_idx][wav_idx]=tmp_wavbuffer[wav_idx];
+			int32_t deviation = (int32_t)interval - (int32_t)burstCycles;
+			if (deviation < 0)
+			{
+				deviation = -deviation;
+			}
+			rxJitterCycles = (int32_t)rxJitterCycles + (deviation - (int32_t)rxJitterCycles) / 16;
 		}
-		taskEXIT_CRITICAL();
-		wavbuffer_write_idx++;
-		if (wavbuffer_write_idx>=WAV_BUFFER_COUNT)
+	}
+	rxLastBurstTimestamp = irqTimestamp;
+	rxLastBurstValid = true;
+
+	// Playback ran dry before this burst arrived, the SAI interrupt may set the flag again at any time
+	taskENTER_CRITICAL();
+	underrun = rxUnderrunSinceBurst;
+	rxUnderrunSinceBurst = false;
+	taskEXIT_CRITICAL();
+	if (underrun)
+	{
+		rxAudioLateBursts++;
+		rxBurstsSinceLate = 0;
+		if (rxLateBoost < SOUND_RX_START_FRAMES_MAX)
 		{
-			wavbuffer_write_idx=0;
+			rxLateBoost++;
 		}
+	}
+	else if ((rxLateBoost > 0) && (++rxBurstsSinceLate >= SOUND_RX_BOOST_DECAY_BURSTS))
+	{
+		rxBurstsSinceLate = 0;
+		rxLateBoost--;
+	}
 
-		taskENTER_CRITICAL();
-		wavbuffer_count++;
-		taskEXIT_CRITICAL();
+	// A whole burst is decoded at once, so the margin against late bursts is what is buffered beyond it
+	extraFrames = (2 * rxJitterCycles) / frameCycles + rxLateBoost;
+	target = rxMinFrames;
+	if ((extraFrames > 0) && (target < (SOUND_RX_BURST_FRAMES + extraFrames)))
+	{
+		target = SOUND_RX_BURST_FRAMES + extraFrames;
+	}
+	if (target > SOUND_RX_START_FRAMES_MAX)
+	{
+		target = SOUND_RX_START_FRAMES_MAX;
+	}
+	rxStartFrames = target;
+
+	// Shed latency the target no longer asks for, one frame at a time
+	slack = (target > SOUND_RX_BURST_FRAMES) ? (target - SOUND_RX_BURST_FRAMES) : 0;
+	if (depth > (slack + 1))
+	{
+		if (++rxDeepBursts >= SOUND_RX_SHRINK_BURSTS)
+		{
+			rxDeepBursts = 0;
+			rxDropFrame = true;
+		}
+	}
+	else
+	{
+		rxDeepBursts = 0;
 	}
 }
 
-void retrieve_soundbuffer()
+void reset_rx_jitter_stats()
 {
 	taskENTER_CRITICAL();
-	int tmp_wavbuffer_count = wavbuffer_count;
+	rxAudioBursts = 0;
+	rxAudioLateBursts = 0;
+	rxAudioConcealedFrames = 0;
+	rxAudioDroppedFrames = 0;
+	rxAudioDepthMin = 0xFFFFFFFF;
+	rxAudioDepthMax = 0;
 	taskEXIT_CRITICAL();
+}
+
+int get_rx_audio_start_frames()
+{
+	return rxStartFrames;
+}
+
+// irqTimestamp is the DWT count of the interrupt that delivered the first voice burst of an over
+void mark_rx_audio_start(uint32_t irqTimestamp)
+{
+	rxAudioStartTimestamp = irqTimestamp;
+	rxAudioStartPending = true;
+}
 
-	if (tmp_wavbuffer_count>0)
+// Called from the SAI TX DMA callback
+void update_rx_audio_latency()
+{
+	if (rxAudioStartPending)
 	{
-		taskENTER_CRITICAL();
-		for (int wav_idx=0;wav_idx<WAV_BUFFER_SIZE;wav_idx++)
-		{
-			tmp_wavbuffer[wav_idx]=wavbuffer[wavbuffer_read_idx][wav_idx];
-		}
-		taskEXIT_CRITICAL();
-		wavbuffer_read_idx++;
-		if (wavbuffer_read_idx>=WAV_BUFFER_COUNT)
+		uint32_t latency = DWT->CYCCNT - rxAudioStartTimestamp;
+		rxAudioStartPending = false;
+		rxAudioLatencyCount++;
+		rxAudioLatencyLast = latency;
+		rxAudioLatencySum += latency;
+		if (latency > rxAudioLatencyMax)
 		{
-			wavbuffer_read_idx=0;
+			rxAudioLatencyMax = latency;
 		}
+	}
+}
+
+void reset_rx_audio_latency()
+{
+	taskENTER_CRITICAL();
+	rxAudioLatencyCount = 0;
+	rxAudioLatencyLast = 0;
+	rxAudioLatencyMax = 0;
+	rxAudioLatencySum = 0;
+	taskEXIT_CRITICAL();
+}
+
+void reset_wavbuffer_stats()
+{
+	wavbufferOverruns = 0;
+	wavbufferUnderruns = 0;
+	wavbufferHighWater = 0;
+}
+
+// The SAI moves one 32 bit word per sample with the sample in the upper halfword, the ring holds packed
+// 16 bit samples. Both sides are little endian, so no byte swap is needed, only two samples per word access.
+static inline void sound_frame_to_sai(const uint8_t *frame, uint8_t *sai)
+{
+	const uint32_t *in = (const uint32_t *)frame;
+	uint32_t *out = (uint32_t *)sai;
+
+	for (int i=0; i<(WAV_BUFFER_SIZE/4); i++)
+	{
+		uint32_t pair = in[i];
+
+		out[2*i] = pair << 16;
+		out[2*i+1] = pair & 0xFFFF0000;
+	}
+}
+
+static inline void sound_frame_from_sai(const uint8_t *sai, uint8_t *frame)
+{
+	const uint32_t *in = (const uint32_t *)sai;
+	uint32_t *out = (uint32_t *)frame;
 
-		taskENTER_CRITICAL();
-		wavbuffer_count--;
-		taskEXIT_CRITICAL();
+	for (int i=0; i<(WAV_BUFFER_SIZE/4); i++)
+	{
+		out[i] = __PKHTB(in[2*i+1], in[2*i], 16);
 	}
 }
 
+static uint8_t *sai_buffer(int queueUser)
+{
+	return (queueUser & 1) ? spi_sound2 : spi_sound1;
+}
+
+// Repeats the previous SAI buffer at half the level, so successive repeats fade out
+static void sound_conceal_frame(const uint8_t *previous, uint8_t *sai)
+{
+	const int32_t *in = (const int32_t *)previous;
+	uint32_t *out = (uint32_t *)sai;
+
+	for (int i=0; i<(WAV_BUFFER_SIZE/2); i++)
+	{
+		out[i] = ((uint32_t)(in[i] >> 1)) & 0xFFFF0000;
+	}
+}
+
+// Called from the SAI TX DMA callback, or from the HR-C6000 task while the SAI TX is idle
 void send_sound_data()
 {
-	if (wavbuffer_count>0)
+	uint8_t *frame;
+
+	if (rxDropFrame)
 	{
-		switch(g_SAI_TX_Handle.queueUser)
+		rxDropFrame = false;
+		if ((get_wavbuffer_count() > 1) && (get_soundbuffer_read_frame() != NULL))
 		{
-		case 0:
-			spi_soundBuf = spi_sound1;
-			break;
-		case 1:
-			spi_soundBuf = spi_sound2;
-			break;
-		case 2:
-			spi_soundBuf = spi_sound3;
-			break;
-		case 3:
-			spi_soundBuf = spi_sound4;
-			break;
-		default:
-			spi_soundBuf=spi_sound1;// just put in to please the compiler
-			break;
+			commit_soundbuffer_read();
+			rxAudioDroppedFrames++;
 		}
+	}
 
-		for (int i=0; i<(WAV_BUFFER_SIZE/2); i++)
+	// Once concealing, keep at it until the ring is back at the jitter target
+	if (rxConcealing && (get_wavbuffer_count() < rxStartFrames))
+	{
+		frame = NULL;
+	}
+	else
+	{
+		frame = get_soundbuffer_read_frame();
+	}
+
+	spi_soundBuf = sai_buffer(g_SAI_TX_Handle.queueUser);
+	if (frame != NULL)
+	{
+		rxConcealing = false;
+		rxConcealedRun = 0;
+		sound_frame_to_sai(frame, spi_soundBuf);
+		commit_soundbuffer_read();
+	}
+	else
+	{
+		if (!txSAIPlaying)
 		{
-			*(spi_soundBuf +4*i +3) = wavbuffer[wavbuffer_read_idx][2*i+1];
-			*(spi_soundBuf +4*i +2) = wavbuffer[wavbuffer_read_idx][2*i];
+			return;
 		}
-
-		xfer.data = spi_soundBuf;
-		xfer.dataSize = WAV_BUFFER_SIZE*2;
-
-		SAI_TransferSendEDMA(I2S0, &g_SAI_TX_Handle, &xfer);
-
-		g_TX_SAI_in_use = true;
-
-		wavbuffer_read_idx++;
-		if (wavbuffer_read_idx>=WAV_BUFFER_COUNT)
+		if (!rxConcealing)
 		{
-			wavbuffer_read_idx=0;
+			wavbufferUnderruns++;// playback ran dry
+			rxUnderrunSinceBurst = true;
+			rxConcealing = true;
 		}
-		wavbuffer_count--;
+		if (rxConcealedRun >= SOUND_RX_CONCEAL_FRAMES)
+		{
+			txSAIPlaying = false;
+			rxConcealing = false;
+			rxConcealedRun = 0;
+			return;
+		}
+		sound_conceal_frame(sai_buffer(g_SAI_TX_Handle.queueUser + 1), spi_soundBuf);
+		rxConcealedRun++;
+		rxAudioConcealedFrames++;
 	}
+
+	xfer.data = spi_soundBuf;
+	xfer.dataSize = WAV_BUFFER_SIZE*2;
+
+	g_TX_SAI_in_use = true;
+	txSAIPlaying = true;
+	SAI_TransferSendEDMA(I2S0, &g_SAI_TX_Handle, &xfer);
 }
 
+// Called from the SAI RX DMA callback, or from the HR-C6000 task while the SAI RX is idle
 void receive_sound_data()
 {
+	uint8_t *frame;
+
 	if (trxIsTransmitting==false)
 	{
 		return;
 	}
 
-	if (wavbuffer_count<WAV_BUFFER_COUNT)
+	frame = get_soundbuffer_write_frame();
+	if (frame != NULL)
 	{
 		if (spi_soundBuf!=NULL)
 		{
-			for (int i=0; i<(WAV_BUFFER_SIZE/2); i++)
-			{
-				wavbuffer[wavbuffer_write_idx][2*i+1] = *(spi_soundBuf +4*i +3);
-				wavbuffer[wavbuffer_write_idx][2*i] = *(spi_soundBuf +4*i +2);
-			}
-
-			wavbuffer_write_idx++;
-			if (wavbuffer_write_idx>=WAV_BUFFER_COUNT)
-			{
-				wavbuffer_write_idx=0;
-			}
-			wavbuffer_count++;
+			sound_frame_from_sai(spi_soundBuf, frame);
+			commit_soundbuffer_write();
 		}
 
-		switch(g_SAI_RX_Handle.queueUser)
-		{
-		case 0:
-			spi_soundBuf = spi_sound1;
-			break;
-		case 1:
-			spi_soundBuf = spi_sound2;
-			break;
-		case 2:
-			spi_soundBuf = spi_sound3;
-			break;
-		case 3:
-			spi_soundBuf = spi_sound4;
-			break;
-		default:
-			spi_soundBuf=spi_sound1;// just put in to please the compiler
-			break;
-		}
+		spi_soundBuf = sai_buffer(g_SAI_RX_Handle.queueUser);
 
 		xfer.data = spi_soundBuf;
 		xfer.dataSize = WAV_BUFFER_SIZE*2;
 
-		SAI_TransferReceiveEDMA(I2S0, &g_SAI_RX_Handle, &xfer);
-
 		g_RX_SAI_in_use = true;
+		SAI_TransferReceiveEDMA(I2S0, &g_SAI_RX_Handle, &xfer);
 	}
 }
 
+// No transfer is in flight while the flag is clear, so the DMA callback cannot run concurrently.
+// Called after every decoded frame, playback (re)starts as soon as the jitter target is buffered.
 void tick_RXsoundbuffer()
 {
-	taskENTER_CRITICAL();
-	bool tmp_g_TX_SAI_in_use = g_TX_SAI_in_use;
-	taskEXIT_CRITICAL();
-    if (!tmp_g_TX_SAI_in_use)
+    if (!g_TX_SAI_in_use && (get_wavbuffer_count() >= rxStartFrames))
     {
-    	taskENTER_CRITICAL();
     	send_sound_data();
-    	taskEXIT_CRITICAL();
     }
 }
 
 void tick_TXsoundbuffer()
 {
-	taskENTER_CRITICAL();
-	bool tmp_g_RX_SAI_in_use = g_RX_SAI_in_use;
-	taskEXIT_CRITICAL();
-    if (!tmp_g_RX_SAI_in_use)
+    if (!g_RX_SAI_in_use)
     {
-    	taskENTER_CRITICAL();
     	receive_sound_data();
-    	taskEXIT_CRITICAL();
     }
 }
 
+// CPU cycles to move one 60 ms superframe (6 frames) between the vocoder and the SAI buffers,
+// through the old staging buffer byte by byte against the direct word conversion
+void soundPipelineBenchmark(soundPipelineBenchmark_t *result)
+{
+	uint8_t frame[WAV_BUFFER_SIZE] __attribute__((aligned(4)));
+	uint8_t staging[WAV_BUFFER_SIZE] __attribute__((aligned(4)));
+	uint8_t sai[WAV_BUFFER_SIZE*2] __attribute__((aligned(4)));
+	uint32_t startCycles;
+
+	memset(sai, 0, sizeof(sai));
+	for (int i=0; i<WAV_BUFFER_SIZE; i++)
+	{
+		frame[i] = i;
+	}
+
+	startCycles = DWT->CYCCNT;
+	for (int n=0; n<6; n++)
+	{
+		memcpy(staging, frame, WAV_BUFFER_SIZE);
+		for (int i=0; i<(WAV_BUFFER_SIZE/2); i++)
+		{
+			sai[4*i+3] = staging[2*i+1];
+			sai[4*i+2] = staging[2*i];
+		}
+	}
+	result->legacyRx = DWT->CYCCNT - startCycles;
+
+	startCycles = DWT->CYCCNT;
+	for (int n=0; n<6; n++)
+	{
+		sound_frame_to_sai(frame, sai);
+	}
+	result->rx = DWT->CYCCNT - startCycles;
+
+	startCycles = DWT->CYCCNT;
+	for (int n=0; n<6; n++)
+	{
+		for (int i=0; i<(WAV_BUFFER_SIZE/2); i++)
+		{
+			staging[2*i+1] = sai[4*i+3];
+			staging[2*i] = sai[4*i+2];
+		}
+		memcpy(frame, staging, WAV_BUFFER_SIZE);
+	}
+	result->legacyTx = DWT->CYCCNT - startCycles;
+
+	startCycles = DWT->CYCCNT;
+	for (int n=0; n<6; n++)
+	{
+		sound_frame_from_sai(sai, frame);
+	}
+	result->tx = DWT->CYCCNT - startCycles;
+}
+
+// Called by the UI task, hands the next note to the beep task once the current one has finished
 void tick_melody()
 {
-	taskENTER_CRITICAL();
-	if (melody_play!=NULL)
+	melodyNote_t note;
+
+	if (!melody_is_playing() || (sine_beep_duration!=0))
+	{
+		return;
+	}
+
+	if (!get_next_note(&note))
 	{
-		if (sine_beep_duration==0)
+		GPIO_PinWrite(GPIO_speaker_mute, Pin_speaker_mute, 0);
+		if (trxGetMode() == RADIO_MODE_ANALOG)
 		{
-			if (melody_play[melody_idx]==-1)
-			{
-				GPIO_PinWrite(GPIO_speaker_mute, Pin_speaker_mute, 0);
-				if (trxGetMode() == RADIO_MODE_ANALOG)
-				{
-				    GPIO_PinWrite(GPIO_RX_audio_mux, Pin_RX_audio_mux, 1);
-				}
-			    set_melody(NULL);
-			}
-			else
-			{
-				if (melody_idx==0)
-				{
-				    GPIO_PinWrite(GPIO_speaker_mute, Pin_speaker_mute, 1);
-					if (trxGetMode() == RADIO_MODE_ANALOG)
-					{
-					    GPIO_PinWrite(GPIO_RX_audio_mux, Pin_RX_audio_mux, 0);
-					}
-				}
-				sine_beep_freq=melody_play[melody_idx];
-				sine_beep_duration=melody_play[melody_idx+1];
-				melody_idx=melody_idx+2;
-			}
+		    GPIO_PinWrite(GPIO_RX_audio_mux, Pin_RX_audio_mux, 1);
+		}
+	    set_melody(NULL);
+	    return;
+	}
+
+	if (melody_idx==0)
+	{
+	    GPIO_PinWrite(GPIO_speaker_mute, Pin_speaker_mute, 1);
+		if (trxGetMode() == RADIO_MODE_ANALOG)
+		{
+		    GPIO_PinWrite(GPIO_RX_audio_mux, Pin_RX_audio_mux, 0);
 		}
 	}
+	melody_idx++;
+
+	taskENTER_CRITICAL();
+	sine_beep_step=(uint32_t)note.freq*BEEP_DDS_STEP_PER_HZ;
+	sine_beep_step2=(uint32_t)note.freq2*BEEP_DDS_STEP_PER_HZ;
+	sine_beep_duration=note.duration;
 	taskEXIT_CRITICAL();
 }
 
+// Sine of the top 11 bits of the phase, from the quarter wave table
+static inline int beep_sine(uint32_t phase)
+{
+	int idx = (phase >> 21) & 0x1ff;
+
+	switch (phase >> 30)
+	{
+	case 0:
+		return sine_beep_quarter[idx];
+	case 1:
+		return sine_beep_quarter[512 - idx];
+	case 2:
+		return -sine_beep_quarter[idx];
+	default:
+		return -sine_beep_quarter[512 - idx];
+	}
+}
+
 void fw_beep_task()
 {
 	// beep mode stuff
 	uint8_t tmp_val;
-	int beep_idx = 0;
+	uint32_t phase = 0;
+	uint32_t phase2 = 0;
 	bool beep = false;
 	uint8_t spi_sound[32];
+	TickType_t lastWakeTime = xTaskGetTickCount();
 
     while (1U)
     {
+    	if (!melody_is_playing() && (sine_beep_duration==0) && (!beep))
+    	{
+    		// Nothing to play, sleep until set_melody() wakes the task up
+    		ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(BEEP_TASK_IDLE_WAIT_MS));
+    		lastWakeTime = xTaskGetTickCount();
+    	}
+    	else
+    	{
+    		vTaskDelayUntil(&lastWakeTime, pdMS_TO_TICKS(1));
+    	}
+
+    	// No critical section around the SPI transfers, they would hold off the HR-C6000 task.
+    	// The transfers block on the bus, so the UI task can start or stop a melody while they run.
+    	// The note is read once here and the duration is only decremented if it is still running.
+    	alive_beeptask=true;
+
     	taskENTER_CRITICAL();
-    	uint32_t tmp_timer_beeptask=timer_beeptask;
+    	bool playing = (sine_beep_duration>0);
+    	uint32_t step = sine_beep_step;
+    	uint32_t step2 = sine_beep_step2;
     	taskEXIT_CRITICAL();
-    	if (tmp_timer_beeptask==0)
+
+    	if (playing)
     	{
-        	taskENTER_CRITICAL();
-        	timer_beeptask=10;
-        	alive_beeptask=true;
+    		if (!beep)
+    		{
+    			set_clear_SPI_page_reg_byte_with_mask_SPI0(0x04, 0x06, 0xFD, 0x02); // SET
+    			beep = true;
+    		}
 
-    		if (sine_beep_duration>0)
+    		read_SPI_page_reg_byte_SPI0(0x04, 0x88, &tmp_val);
+    		if ( !(tmp_val & 1) )
     		{
-    			if (!beep)
+    			// A rest holds the phase, as the table walk did before
+    			for (int i=0; i<16 ;i++)
     			{
-    				set_clear_SPI_page_reg_byte_with_mask_SPI0(0x04, 0x06, 0xFD, 0x02); // SET
-    				beep = true;
-    			}
+    				int sample = beep_sine(phase);
 
-    			read_SPI_page_reg_byte_SPI0(0x04, 0x88, &tmp_val);
-    			if ( !(tmp_val & 1) )
-    			{
-    				for (int i=0; i<16 ;i++)
+    				if (step2!=0)
     				{
-    					spi_sound[2*i+1]=sine_beep[2*beep_idx];
-    					spi_sound[2*i]=sine_beep[2*beep_idx+1];
-    					if (sine_beep_freq!=0)
-    					{
-							beep_idx = beep_idx + (int)(sine_beep_freq/3.915f);
-    						if (beep_idx>=0x0800)
-    						{
-    							beep_idx=beep_idx-0x0800;
-    						}
-    					}
+    					// Halved so that two full scale tones still fit the 16 bit sample
+    					sample = (sample + beep_sine(phase2)) / 2;
+    					phase2 += step2;
     				}
-    				write_SPI_page_reg_bytearray_SPI0(0x03, 0x00, spi_sound, 0x20);
+    				spi_sound[2*i]=(sample >> 8) & 0xFF;
+    				spi_sound[2*i+1]=sample & 0xFF;
+    				phase += step;
     			}
+    			write_SPI_page_reg_bytearray_SPI0(0x03, 0x00, spi_sound, 0x20);
+    		}
 
+    		taskENTER_CRITICAL();
+    		if (sine_beep_duration>0)
+    		{
     			sine_beep_duration--;
     		}
-    		else
+    		taskEXIT_CRITICAL();
+    	}
+    	else
+    	{
+    		if (beep)
     		{
-    			if (beep)
-    			{
-    				set_clear_SPI_page_reg_byte_with_mask_SPI0(0x04, 0x06, 0xFD, 0x00); // CLEAR
-    				beep = false;
-    			}
+    			set_clear_SPI_page_reg_byte_with_mask_SPI0(0x04, 0x06, 0xFD, 0x00); // CLEAR
+    			beep = false;
     		}
-    		taskEXIT_CRITICAL();
     	}
-
-		vTaskDelay(0);
     }
 }
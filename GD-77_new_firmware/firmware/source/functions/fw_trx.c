@@ -26,12 +26,18 @@
 bool open_squelch=false;
 bool HR_C6000_datalogging=false;
 
-int trx_measure_count = 0;
-bool trxIsTransmitting = false;
+volatile bool trxIsTransmitting = false;
 uint32_t trxTalkGroup=9;// Set to local TG just in case there is some problem with it not being loaded
 uint32_t trxDMRID = 0;// Set ID to 0. Not sure if its valid. This value needs to be loaded from the codeplug.
 int txstopdelay = 0;
 
+volatile uint32_t trxRetuneCount = 0;
+volatile uint32_t trxRetuneCyclesLast = 0;
+volatile uint32_t trxRetuneCyclesMax = 0;
+volatile uint32_t trxChannelSwitchCount = 0;
+volatile uint32_t trxChannelSwitchCyclesLast = 0;
+volatile uint32_t trxChannelSwitchCyclesMax = 0;
+
 const int RADIO_VHF_MIN			=	1340000;
 const int RADIO_VHF_MAX			=	1740000;
 const int RADIO_UHF_MIN			=	4000000;
@@ -41,10 +47,58 @@ static int currentMode = RADIO_MODE_NONE;
 static bool currentBandWidth = BANDWIDTH_12P5KHZ;
 static int currentFrequency =1440000;
 static int currentCC =1;
-static uint8_t squelch = 0x00;
+static int currentTxTone = 0xFFFF;
+static int currentRxTone = 0xFFFF;
 static const uint8_t SQUELCH_SETTINGS[] = {45,45,45};
 static bool rxCTCSSactive = false;
 
+// The noise level in register 0x1b is polled, once open the squelch closes at the threshold plus the hysteresis
+// and the speaker is kept on for the hang time after the last open reading
+static int squelchHangMs = TRX_SQUELCH_HANG_MS_DEFAULT;
+static int squelchHysteresis = TRX_SQUELCH_HYSTERESIS_DEFAULT;
+static bool squelchCarrier = false;
+static bool squelchOpen = false;
+static TickType_t squelchOpenTick = 0;
+
+volatile uint32_t trxSquelchReads = 0;
+
+// AT1846S registers (or the bits outside keepMask of them) set by a tuning plan, in the order they are written
+static const trxTuningReg_t AT1846TuningRegs[TRX_TUNING_AT1846_REGS] = {
+		{0x29, 0x0000}, // TRX_TUNING_FREQ_HIGH
+		{0x2a, 0x0000}, // TRX_TUNING_FREQ_LOW
+		{0x0A, 0xF83F}, // pga gain
+		{0x41, 0xFF80}, // voice gain tx
+		{0x44, 0xF0FF}, // gain tx
+		{0x59, 0x003F}, // xmitter dev narrowband
+		{0x44, 0xFF0F}, // dac vgain analog
+		{0x44, 0xFFF0}, // volume analog
+		{0x48, 0x0000}, // noise1 th narrowband
+		{0x60, 0x0000}, // noise2 th narrowband
+		{0x3f, 0x0000}, // rssi3 th narrowband
+		{0x0A, 0x87FF}, // padrv ibit
+		{0x49, 0x0000}, // squelch open and shut threshold
+		{0x4a, 0x0000}, // tx CTCSS frequency
+		{0x4e, 0xF9FF}, // tx CTCSS enable
+		{0x4d, 0x0000}, // rx CTCSS frequency
+		{0x5b, 0x0000}, // rx CTCSS detection thresholds
+		{0x3a, 0xFFE0}, // rx CTCSS detection select
+};
+
+static const uint8_t C6000TuningRegs[TRX_TUNING_C6000_REGS] = {
+		0x37, // DACDATA shift (LIN_VOL)
+		0x04, // MOD2 offset
+		0x46, // phase reduce
+		0x48, // bit 0 to 1 = upper 2 bits of 10-bit twopoint mod
+		0x47, // bit 0 to 7 = lower 8 bits of 10-bit twopoint mod
+		0x1F, // DMR Colour code in upper 4 bits
+};
+
+// The AT1846S register values of the last plan applied. Sending a settings table invalidates them.
+static uint16_t appliedAT1846Values[TRX_TUNING_AT1846_REGS];
+static uint32_t appliedAT1846Valid = 0;
+
+static void trx_calc_band_and_frequency_offset(int frequency, int *band_offset, int *freq_offset);
+
 int	trxGetMode()
 {
 	return currentMode;
@@ -54,24 +108,10 @@ void trxSetMode(int theMode)
 {
 	if (theMode != currentMode)
 	{
-		currentMode=theMode;
+		trxTuningPlan_t plan;
 
-		I2C_AT1846_SetMode(currentMode);
-		trxUpdateAT1846SCalibration();
-		trxUpdateAT1846SCalibration();
-		if (currentMode == RADIO_MODE_ANALOG)
-		{
-			GPIO_PinWrite(GPIO_RX_audio_mux, Pin_RX_audio_mux, 1); // connect AT1846S audio to speaker
-			terminate_sound();
-			terminate_digital();
-		}
-		else
-		{
-			trxSetBandWidth(0);// DMR is always 12.5kHz
-			GPIO_PinWrite(GPIO_RX_audio_mux, Pin_RX_audio_mux, 0); // connect AT1846S audio to HR_C6000
-			init_sound();
-			init_digital();
-		}
+		trxTuningPlanCompute(&plan, currentFrequency, theMode, currentBandWidth, currentCC, currentTxTone, currentRxTone);
+		trxApplyTuningPlan(&plan);
 	}
 }
 
@@ -91,76 +131,103 @@ bool trxCheckFrequency(int tmp_frequency)
 }
 
 
-void trx_check_analog_squelch()
+bool trx_check_analog_squelch()
 {
-	trx_measure_count++;
-	if (trx_measure_count==50)
+	uint8_t RX_signal;
+	uint8_t RX_noise;
+	int threshold = SQUELCH_SETTINGS[0];
+	TickType_t now = xTaskGetTickCount();
+	bool speaker;
+
+	trxSquelchReads++;
+	read_I2C_reg_2byte(I2C_MASTER_SLAVE_ADDR_7BIT, 0x1b,&RX_signal,&RX_noise);
+	if (squelchCarrier)
 	{
-		uint8_t RX_signal;
-		uint8_t RX_noise;
-		read_I2C_reg_2byte(I2C_MASTER_SLAVE_ADDR_7BIT, 0x1b,&RX_signal,&RX_noise);
+		threshold += squelchHysteresis;
+	}
+	squelchCarrier = (RX_noise < threshold) || open_squelch;
 
-		if ((RX_noise < SQUELCH_SETTINGS[0]) || (open_squelch))
-		{
-			GPIO_PinWrite(GPIO_LEDgreen, Pin_LEDgreen, 1);
-			if(!rxCTCSSactive || (rxCTCSSactive & trxCheckCTCSSFlag())|| open_squelch)
-			{
-				GPIO_PinWrite(GPIO_speaker_mute, Pin_speaker_mute, 1); // speaker on
-				displayLightTrigger();
-			}
-		}
-		else
-		{
-			GPIO_PinWrite(GPIO_speaker_mute, Pin_speaker_mute, 0); // speaker off
-			GPIO_PinWrite(GPIO_LEDgreen, Pin_LEDgreen, 0);
-		}
+	// The CTCSS flag in 0x1c is only read when a tone is set and there is a carrier
+	speaker = squelchCarrier;
+	if (squelchCarrier && rxCTCSSactive && !open_squelch)
+	{
+		trxSquelchReads++;
+		speaker = trxCheckCTCSSFlag();
+	}
+
+	if (speaker)
+	{
+		squelchOpenTick = now;
+	}
+	else if (squelchOpen && ((now - squelchOpenTick) < pdMS_TO_TICKS(squelchHangMs)))
+	{
+		return true;// hang time, short dropouts keep the speaker on
+	}
+	squelchOpen = speaker;
 
-    	trx_measure_count=0;
+	GPIO_PinWrite(GPIO_LEDgreen, Pin_LEDgreen, squelchCarrier ? 1 : 0);
+	GPIO_PinWrite(GPIO_speaker_mute, Pin_speaker_mute, speaker ? 1 : 0);
+	if (speaker)
+	{
+		displayLightTrigger();
 	}
+	return speaker;
+}
+
+void trxSetSquelchHangTime(int hangTimeMs)
+{
+	squelchHangMs = hangTimeMs;
+}
+
+void trxSetSquelchHysteresis(int hysteresis)
+{
+	squelchHysteresis = hysteresis;
+}
+
+void trxResetSquelchStats()
+{
+	trxSquelchReads = 0;
 }
 
 void trxSetFrequency(int frequency)
 {
 	if (currentFrequency!=frequency)
 	{
-		currentFrequency=frequency;
+		uint32_t startCycles = DWT->CYCCNT;
+		trxTuningPlan_t plan;
 
-		if ((currentMode == RADIO_MODE_ANALOG) && (!open_squelch))
-		{
-			squelch = 0x08;
-		}
-		else
+		trxTuningPlanCompute(&plan, frequency, currentMode, currentBandWidth, currentCC, currentTxTone, currentRxTone);
+		trxApplyTuningPlan(&plan);
+
+		trxRetuneCyclesLast = DWT->CYCCNT - startCycles;
+		if (trxRetuneCyclesLast > trxRetuneCyclesMax)
 		{
-			squelch = 0x00;
+			trxRetuneCyclesMax = trxRetuneCyclesLast;
 		}
+		trxRetuneCount++;
+	}
+}
 
-		uint32_t f = currentFrequency * 1.6f;
-		uint8_t fl_l = (f & 0x000000ff) >> 0;
-		uint8_t fl_h = (f & 0x0000ff00) >> 8;
-		uint8_t fh_l = (f & 0x00ff0000) >> 16;
-		uint8_t fh_h = (f & 0xff000000) >> 24;
-
-		write_I2C_reg_2byte(I2C_MASTER_SLAVE_ADDR_7BIT, 0x30, 0x40, 0x06 | squelch); // RX off
-		write_I2C_reg_2byte(I2C_MASTER_SLAVE_ADDR_7BIT, 0x05, 0x87, 0x63); // select 'normal' frequency mode
-		write_I2C_reg_2byte(I2C_MASTER_SLAVE_ADDR_7BIT, 0x29, fh_h, fh_l);
-		write_I2C_reg_2byte(I2C_MASTER_SLAVE_ADDR_7BIT, 0x2a, fl_h, fl_l);
-		write_I2C_reg_2byte(I2C_MASTER_SLAVE_ADDR_7BIT, 0x49, 0x0C, 0x15); // setting SQ open and shut threshold
-		write_I2C_reg_2byte(I2C_MASTER_SLAVE_ADDR_7BIT, 0x30, 0x40, 0x26 | squelch); // RX on
-
-		trxUpdateC6000Calibration();
-		trxUpdateAT1846SCalibration();
+void trxResetRetuneStats()
+{
+	taskENTER_CRITICAL();
+	trxRetuneCount = 0;
+	trxRetuneCyclesLast = 0;
+	trxRetuneCyclesMax = 0;
+	trxChannelSwitchCount = 0;
+	trxChannelSwitchCyclesLast = 0;
+	trxChannelSwitchCyclesMax = 0;
+	taskEXIT_CRITICAL();
+}
 
-		if (trxCheckFrequencyIsVHF(currentFrequency))
-		{
-			GPIO_PinWrite(GPIO_VHF_RX_amp_power, Pin_VHF_RX_amp_power, 1);
-			GPIO_PinWrite(GPIO_UHF_RX_amp_power, Pin_UHF_RX_amp_power, 0);
-		}
-		else if (trxCheckFrequencyIsUHF(currentFrequency))
-		{
-			GPIO_PinWrite(GPIO_VHF_RX_amp_power, Pin_VHF_RX_amp_power, 0);
-			GPIO_PinWrite(GPIO_UHF_RX_amp_power, Pin_UHF_RX_amp_power, 1);
-		}
+void trxChannelSwitchDone(uint32_t startCycles)
+{
+	trxChannelSwitchCyclesLast = DWT->CYCCNT - startCycles;
+	if (trxChannelSwitchCyclesLast > trxChannelSwitchCyclesMax)
+	{
+		trxChannelSwitchCyclesMax = trxChannelSwitchCyclesLast;
 	}
+	trxChannelSwitchCount++;
 }
 
 int trxGetFrequency()
@@ -276,38 +343,39 @@ void trxSetBandWidth(bool bandWidthis25kHz)
 	currentBandWidth = bandWidthis25kHz;
 
 	I2C_AT1846_SetBandwidth(bandWidthis25kHz);
+	appliedAT1846Valid &= (1U << TRX_TUNING_FREQ_HIGH) | (1U << TRX_TUNING_FREQ_LOW);
 }
 
-void trxCalcBandAndFrequencyOffset(int *band_offset, int *freq_offset)
+static void trx_calc_band_and_frequency_offset(int frequency, int *band_offset, int *freq_offset)
 {
-	if (trxCheckFrequencyIsVHF(currentFrequency))
+	if (trxCheckFrequencyIsVHF(frequency))
 	{
 		*band_offset=0x00000070;
-		if (currentFrequency<1380000)
+		if (frequency<1380000)
 		{
 			*freq_offset=0x00000000;
 		}
-		else if (currentFrequency<1425000)
+		else if (frequency<1425000)
 		{
 			*freq_offset=0x00000001;
 		}
-		else if (currentFrequency<1475000)
+		else if (frequency<1475000)
 		{
 			*freq_offset=0x00000002;
 		}
-		else if (currentFrequency<1525000)
+		else if (frequency<1525000)
 		{
 			*freq_offset=0x00000003;
 		}
-		else if (currentFrequency<1575000)
+		else if (frequency<1575000)
 		{
 			*freq_offset=0x00000004;
 		}
-		else if (currentFrequency<1625000)
+		else if (frequency<1625000)
 		{
 			*freq_offset=0x00000005;
 		}
-		else if (currentFrequency<1685000)
+		else if (frequency<1685000)
 		{
 			*freq_offset=0x00000006;
 		}
@@ -316,34 +384,34 @@ void trxCalcBandAndFrequencyOffset(int *band_offset, int *freq_offset)
 			*freq_offset=0x00000007;
 		}
 	}
-	else if (trxCheckFrequencyIsUHF(currentFrequency))
+	else if (trxCheckFrequencyIsUHF(frequency))
 	{
 		*band_offset=0x00000000;
-		if (currentFrequency<4100000)
+		if (frequency<4100000)
 		{
 			*freq_offset=0x00000000;
 		}
-		else if (currentFrequency<4200000)
+		else if (frequency<4200000)
 		{
 			*freq_offset=0x00000001;
 		}
-		else if (currentFrequency<4300000)
+		else if (frequency<4300000)
 		{
 			*freq_offset=0x00000002;
 		}
-		else if (currentFrequency<4400000)
+		else if (frequency<4400000)
 		{
 			*freq_offset=0x00000003;
 		}
-		else if (currentFrequency<4500000)
+		else if (frequency<4500000)
 		{
 			*freq_offset=0x00000004;
 		}
-		else if (currentFrequency<4600000)
+		else if (frequency<4600000)
 		{
 			*freq_offset=0x00000005;
 		}
-		else if (currentFrequency<4700000)
+		else if (frequency<4700000)
 		{
 			*freq_offset=0x00000006;
 		}
@@ -354,104 +422,202 @@ void trxCalcBandAndFrequencyOffset(int *band_offset, int *freq_offset)
 	}
 }
 
-void trxUpdateC6000Calibration()
+void I2C_AT1846_set_register_with_mask(uint8_t reg, uint16_t mask, uint16_t value, uint8_t shift)
+{
+	set_clear_I2C_reg_2byte_with_mask(reg, (mask & 0xff00) >> 8, (mask & 0x00ff) >> 0, ((value << shift) & 0xff00) >> 8, ((value << shift) & 0x00ff) >> 0);
+}
+
+// Computes every register value needed to receive with the given settings, without touching the hardware
+void trxTuningPlanCompute(trxTuningPlan_t *plan, int frequency, int mode, bool bandWidthIs25kHz, int colourCode, int txTone, int rxTone)
 {
 	int band_offset=0x00000000;
 	int freq_offset=0x00000000;
-
-	if (nonVolatileSettings.useCalibration==0)
+	uint32_t f = (frequency * 8) / 5; // frequency * 1.6
+
+	plan->frequency = frequency;
+	plan->mode = mode;
+	plan->bandWidthIs25kHz = (mode == RADIO_MODE_DIGITAL) ? BANDWIDTH_12P5KHZ : bandWidthIs25kHz;// DMR is always 12.5kHz
+	plan->colourCode = colourCode;
+	plan->txTone = txTone;
+	plan->rxTone = rxTone;
+	plan->at1846Used = 0;
+	plan->c6000Used = 0;
+
+	plan->at1846Values[TRX_TUNING_FREQ_HIGH] = (f >> 16) & 0xFFFF;
+	plan->at1846Values[TRX_TUNING_FREQ_LOW] = f & 0xFFFF;
+	plan->at1846Values[TRX_TUNING_SQUELCH_TH] = 0x0C15; // setting SQ open and shut threshold
+	plan->at1846Used |= (1U << TRX_TUNING_FREQ_HIGH) | (1U << TRX_TUNING_FREQ_LOW) | (1U << TRX_TUNING_SQUELCH_TH);
+
+	if (nonVolatileSettings.useCalibration!=0)
 	{
-		return;
+		trx_calc_band_and_frequency_offset(frequency, &band_offset, &freq_offset);
+		calibrationStruct_t *cal = calibrationGetBand(band_offset);
+
+		plan->at1846Values[TRX_TUNING_PGA_GAIN] = cal->pga_gain << 6;
+		plan->at1846Values[TRX_TUNING_VOICE_GAIN_TX] = cal->voice_gain_tx;
+		plan->at1846Values[TRX_TUNING_GAIN_TX] = cal->gain_tx << 8;
+		plan->at1846Values[TRX_TUNING_XMITTER_DEV] = cal->xmitter_dev_narrowband << 6;
+		plan->at1846Values[TRX_TUNING_DAC_VGAIN] = 0x0C << 4;
+		plan->at1846Values[TRX_TUNING_VOLUME] = 0x0C;
+		plan->at1846Values[TRX_TUNING_NOISE1_TH] = cal->noise1_th_narrowband;
+		plan->at1846Values[TRX_TUNING_NOISE2_TH] = cal->noise2_th_narrowband;
+		plan->at1846Values[TRX_TUNING_RSSI3_TH] = cal->rssi3_th_narrowband;
+		plan->at1846Values[TRX_TUNING_PADRV_IBIT] = cal->padrv_ibit << 11;
+		plan->at1846Values[TRX_TUNING_SQUELCH_TH] = cal->squelch_th[freq_offset];
+		plan->at1846Used |= ((1U << (TRX_TUNING_PADRV_IBIT + 1)) - 1) & ~((1U << TRX_TUNING_PGA_GAIN) - 1);
+
+		plan->c6000Values[0] = cal->DACDATA_shift;
+		plan->c6000Values[1] = cal->Q_MOD2_offset;
+		plan->c6000Values[2] = cal->phase_reduce[freq_offset];
+		plan->c6000Values[3] = cal->twopoint_mod_0x48;
+		plan->c6000Values[4] = cal->twopoint_mod_0x47;
+		plan->c6000Used |= 0x1F;
 	}
+	plan->c6000Values[5] = colourCode << 4;
+	plan->c6000Used |= 0x20;
 
-	trxCalcBandAndFrequencyOffset(&band_offset, &freq_offset);
-
-	uint8_t val_shift;
-	read_val_DACDATA_shift(band_offset,&val_shift);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x37, val_shift); // DACDATA shift (LIN_VOL)
-
-	uint8_t val_0x04;
-	read_val_Q_MOD2_offset(band_offset,&val_0x04);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x04, val_0x04); // MOD2 offset
-
-	uint8_t val_0x46;
-	read_val_phase_reduce(band_offset+freq_offset,&val_0x46);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x46, val_0x46); // phase reduce
+	if (txTone == 0xFFFF)
+	{
+		// tone value of 0xffff in the codeplug seem to be a flag that no tone has been selected
+		plan->at1846Values[TRX_TUNING_TX_CTCSS_FREQ] = 0x0000; //Zero the CTCSS1 Register
+		plan->at1846Values[TRX_TUNING_TX_CTCSS_ENABLE] = 0x0000; //disable the transmit CTCSS
+	}
+	else
+	{
+		plan->at1846Values[TRX_TUNING_TX_CTCSS_FREQ] = txTone*10;// value that is stored is 100 time the tone freq but its stored in the codeplug as freq times 10
+		plan->at1846Values[TRX_TUNING_TX_CTCSS_ENABLE] = 0x0600; //enable the transmit CTCSS
+	}
+	plan->at1846Used |= (1U << TRX_TUNING_TX_CTCSS_FREQ) | (1U << TRX_TUNING_TX_CTCSS_ENABLE);
 
-	uint8_t val_0x47;
-	uint8_t val_0x48;
-	read_val_twopoint_mod(band_offset,&val_0x47, &val_0x48);
-	write_SPI_page_reg_byte_SPI0(0x04, 0x48, val_0x48); // bit 0 to 1 = upper 2 bits of 10-bit twopoint mod
-	write_SPI_page_reg_byte_SPI0(0x04, 0x47, val_0x47); // bit 0 to 7 = lower 8 bits of 10-bit twopoint mod
+	if (rxTone == 0xFFFF)
+	{
+		plan->at1846Values[TRX_TUNING_RX_CTCSS_FREQ] = 0x0000; //Zero the CTCSS2 Register
+		plan->at1846Used |= (1U << TRX_TUNING_RX_CTCSS_FREQ);
+	}
+	else
+	{
+		int threshold=(2500-rxTone)/100;   //adjust threshold value to match tone frequency.
+		plan->at1846Values[TRX_TUNING_RX_CTCSS_FREQ] = rxTone*10;
+		plan->at1846Values[TRX_TUNING_RX_CTCSS_THRESHOLD] = ((threshold & 0xFF) << 8) | (threshold & 0xFF); //set the detection thresholds
+		plan->at1846Values[TRX_TUNING_RX_CTCSS_SELECT] = 0x0008; //set detection to CTCSS2
+		plan->at1846Used |= (1U << TRX_TUNING_RX_CTCSS_FREQ) | (1U << TRX_TUNING_RX_CTCSS_THRESHOLD) | (1U << TRX_TUNING_RX_CTCSS_SELECT);
+	}
 }
 
-void I2C_AT1846_set_register_with_mask(uint8_t reg, uint16_t mask, uint16_t value, uint8_t shift)
+static bool trx_tuning_reg_changed(const trxTuningPlan_t *plan, int index)
 {
-	set_clear_I2C_reg_2byte_with_mask(reg, (mask & 0xff00) >> 8, (mask & 0x00ff) >> 0, ((value << shift) & 0xff00) >> 8, ((value << shift) & 0x00ff) >> 0);
+	return (plan->at1846Used & (1U << index)) &&
+			(!(appliedAT1846Valid & (1U << index)) || (appliedAT1846Values[index] != plan->at1846Values[index]));
 }
 
-void trxUpdateAT1846SCalibration()
+static void trx_tuning_reg_write(const trxTuningPlan_t *plan, int index)
 {
-	int band_offset=0x00000000;
-	int freq_offset=0x00000000;
+	const trxTuningReg_t *def = &AT1846TuningRegs[index];
+	uint16_t value = plan->at1846Values[index];
 
-	if (nonVolatileSettings.useCalibration==0)
+	if (def->keepMask == 0x0000)
 	{
-		return;
+		write_I2C_reg_2byte(I2C_MASTER_SLAVE_ADDR_7BIT, def->reg, (value >> 8) & 0xff, value & 0xff);
 	}
+	else
+	{
+		I2C_AT1846_set_register_with_mask(def->reg, def->keepMask, value, 0);
+	}
+	appliedAT1846Values[index] = value;
+	appliedAT1846Valid |= (1U << index);
+}
 
-	trxCalcBandAndFrequencyOffset(&band_offset, &freq_offset);
-
-	uint8_t val_pga_gain;
-	uint8_t voice_gain_tx;
-	uint8_t gain_tx;
-	uint8_t padrv_ibit;
-
-	uint16_t xmitter_dev_narrowband;
-
-	uint8_t dac_vgain_analog = 0x0C;
-	uint8_t volume_analog = 0x0C;
-
-	uint16_t noise1_th_narrowband;
-	uint16_t noise2_th_narrowband;
-	uint16_t rssi3_th_narrowband;
-
-	uint16_t squelch_th;
+// Switches to the plan, only the registers whose value differs from the one last written are sent
+void trxApplyTuningPlan(const trxTuningPlan_t *plan)
+{
+	bool modeChanged = (plan->mode != currentMode);
 
-	read_val_pga_gain(band_offset, &val_pga_gain);
-	read_val_voice_gain_tx(band_offset, &voice_gain_tx);
-	read_val_gain_tx(band_offset, &gain_tx);
-	read_val_padrv_ibit(band_offset, &padrv_ibit);
+	if (modeChanged)
+	{
+		currentMode = plan->mode;
+		I2C_AT1846_SetMode(currentMode);
+		appliedAT1846Valid &= (1U << TRX_TUNING_FREQ_HIGH) | (1U << TRX_TUNING_FREQ_LOW);
+	}
+	trxSetBandWidth(plan->bandWidthIs25kHz);
 
-	read_val_xmitter_dev_narrowband(band_offset, &xmitter_dev_narrowband);
+	if (trx_tuning_reg_changed(plan, TRX_TUNING_FREQ_HIGH) || trx_tuning_reg_changed(plan, TRX_TUNING_FREQ_LOW) || (plan->frequency != currentFrequency))
+	{
+		uint8_t squelch;
+		uint8_t bandMode = currentBandWidth ? 0x70 : 0x40;// keep the filter band selected by the bandwidth settings
 
-	read_val_noise1_th_narrowband(band_offset, &noise1_th_narrowband);
-	read_val_noise2_th_narrowband(band_offset, &noise2_th_narrowband);
-	read_val_rssi3_th_narrowband(band_offset, &rssi3_th_narrowband);
+		currentFrequency = plan->frequency;
+		if ((currentMode == RADIO_MODE_ANALOG) && (!open_squelch))
+		{
+			squelch = 0x08;
+		}
+		else
+		{
+			squelch = 0x00;
+		}
 
-	read_val_squelch_th(band_offset+freq_offset, &squelch_th);
+		write_I2C_reg_2byte(I2C_MASTER_SLAVE_ADDR_7BIT, 0x30, bandMode, 0x06 | squelch); // RX off
+		write_I2C_reg_2byte(I2C_MASTER_SLAVE_ADDR_7BIT, 0x05, 0x87, 0x63); // select 'normal' frequency mode
+		trx_tuning_reg_write(plan, TRX_TUNING_FREQ_HIGH);
+		trx_tuning_reg_write(plan, TRX_TUNING_FREQ_LOW);
+		write_I2C_reg_2byte(I2C_MASTER_SLAVE_ADDR_7BIT, 0x30, bandMode, 0x26 | squelch); // RX on
 
-	I2C_AT1846_set_register_with_mask(0x0A, 0xF83F, val_pga_gain, 6);
-	I2C_AT1846_set_register_with_mask(0x41, 0xFF80, voice_gain_tx, 0);
-	I2C_AT1846_set_register_with_mask(0x44, 0xF0FF, gain_tx, 8);
+		if (trxCheckFrequencyIsVHF(currentFrequency))
+		{
+			GPIO_PinWrite(GPIO_VHF_RX_amp_power, Pin_VHF_RX_amp_power, 1);
+			GPIO_PinWrite(GPIO_UHF_RX_amp_power, Pin_UHF_RX_amp_power, 0);
+		}
+		else if (trxCheckFrequencyIsUHF(currentFrequency))
+		{
+			GPIO_PinWrite(GPIO_VHF_RX_amp_power, Pin_VHF_RX_amp_power, 0);
+			GPIO_PinWrite(GPIO_UHF_RX_amp_power, Pin_UHF_RX_amp_power, 1);
+		}
+	}
 
-	I2C_AT1846_set_register_with_mask(0x59, 0x003f, xmitter_dev_narrowband, 6);
-	I2C_AT1846_set_register_with_mask(0x44, 0xFF0F, dac_vgain_analog, 4);
-	I2C_AT1846_set_register_with_mask(0x44, 0xFFF0, volume_analog, 0);
+	for (int i=TRX_TUNING_FREQ_LOW+1; i<TRX_TUNING_AT1846_REGS; i++)
+	{
+		if (trx_tuning_reg_changed(plan, i))
+		{
+			trx_tuning_reg_write(plan, i);
+		}
+	}
 
-	I2C_AT1846_set_register_with_mask(0x48, 0x0000, noise1_th_narrowband, 0);
-	I2C_AT1846_set_register_with_mask(0x60, 0x0000, noise2_th_narrowband, 0);
-	I2C_AT1846_set_register_with_mask(0x3f, 0x0000, rssi3_th_narrowband, 0);
+	// The HR-C6000 register shadow already skips the values that did not change
+	for (int i=0; i<TRX_TUNING_C6000_REGS; i++)
+	{
+		if (plan->c6000Used & (1U << i))
+		{
+			write_SPI_page_reg_byte_SPI0(0x04, C6000TuningRegs[i], plan->c6000Values[i]);
+		}
+	}
 
-	I2C_AT1846_set_register_with_mask(0x0A, 0x87FF, padrv_ibit, 11);
+	currentCC = plan->colourCode;
+	currentTxTone = plan->txTone;
+	currentRxTone = plan->rxTone;
+	rxCTCSSactive = (plan->rxTone != 0xFFFF);
 
-	I2C_AT1846_set_register_with_mask(0x49, 0x0000, squelch_th, 0);
+	if (modeChanged)
+	{
+		if (currentMode == RADIO_MODE_ANALOG)
+		{
+			GPIO_PinWrite(GPIO_RX_audio_mux, Pin_RX_audio_mux, 1); // connect AT1846S audio to speaker
+			terminate_sound();
+			terminate_digital();
+		}
+		else
+		{
+			GPIO_PinWrite(GPIO_RX_audio_mux, Pin_RX_audio_mux, 0); // connect AT1846S audio to HR_C6000
+			init_sound();
+			init_digital();
+		}
+	}
 }
 
 void trxSetDMRColourCode(int colourCode)
 {
-	write_SPI_page_reg_byte_SPI0(0x04, 0x1F, (colourCode << 4)); // DMR Colour code in upper 4 bits.
-	currentCC = colourCode;
+	trxTuningPlan_t plan;
+
+	trxTuningPlanCompute(&plan, currentFrequency, currentMode, currentBandWidth, colourCode, currentTxTone, currentRxTone);
+	trxApplyTuningPlan(&plan);
 }
 
 int trxGetDMRColourCode()
@@ -461,37 +627,18 @@ int trxGetDMRColourCode()
 
 void trxSetTxCTCSS(int toneFreqX10)
 {
-	if (toneFreqX10 == 0xFFFF)
-	{
-		// tone value of 0xffff in the codeplug seem to be a flag that no tone has been selected
-        write_I2C_reg_2byte(I2C_MASTER_SLAVE_ADDR_7BIT, 0x4a, 0x00,0x00); //Zero the CTCSS1 Register
-		set_clear_I2C_reg_2byte_with_mask(0x4e,0xF9,0xFF,0x00,0x00);    //disable the transmit CTCSS
-	}
-	else
-	{
-		toneFreqX10 = toneFreqX10*10;// value that is stored is 100 time the tone freq but its stored in the codeplug as freq times 10
-		write_I2C_reg_2byte(I2C_MASTER_SLAVE_ADDR_7BIT,	0x4a, (toneFreqX10 >> 8) & 0xff,	(toneFreqX10 & 0xff));
-		set_clear_I2C_reg_2byte_with_mask(0x4e,0xF9,0xFF,0x06,0x00);    //enable the transmit CTCSS
-	}
+	trxTuningPlan_t plan;
+
+	trxTuningPlanCompute(&plan, currentFrequency, currentMode, currentBandWidth, currentCC, toneFreqX10, currentRxTone);
+	trxApplyTuningPlan(&plan);
 }
 
 void trxSetRxCTCSS(int toneFreqX10)
 {
-	if (toneFreqX10 == 0xFFFF)
-	{
-		// tone value of 0xffff in the codeplug seem to be a flag that no tone has been selected
-        write_I2C_reg_2byte(I2C_MASTER_SLAVE_ADDR_7BIT, 0x4d, 0x00,0x00); //Zero the CTCSS2 Register
-        rxCTCSSactive=false;
-	}
-	else
-	{
-		int threshold=(2500-toneFreqX10)/100;   //adjust threshold value to match tone frequency.
-		toneFreqX10 = toneFreqX10*10;// value that is stored is 100 time the tone freq but its stored in the codeplug as freq times 10
-		write_I2C_reg_2byte(I2C_MASTER_SLAVE_ADDR_7BIT,	0x4d, (toneFreqX10 >> 8) & 0xff,	(toneFreqX10 & 0xff));
-		write_I2C_reg_2byte(I2C_MASTER_SLAVE_ADDR_7BIT, 0x5b,(threshold & 0xFF),(threshold & 0xFF)); //set the detection thresholds
-		set_clear_I2C_reg_2byte_with_mask(0x3a,0xFF,0xE0,0x00,0x08);    //set detection to CTCSS2
-		rxCTCSSactive=true;
-	}
+	trxTuningPlan_t plan;
+
+	trxTuningPlanCompute(&plan, currentFrequency, currentMode, currentBandWidth, currentCC, currentTxTone, toneFreqX10);
+	trxApplyTuningPlan(&plan);
 }
 
 bool trxCheckCTCSSFlag()
@@ -25,10 +25,14 @@
 #include <SeggerRTT/RTT/SEGGER_RTT.h>
 #endif
 
+#define MAIN_TASK_PERIOD_MS       1
+#define MAIN_TASK_IDLE_PERIOD_MS  20
+
 void fw_main_task();
+static bool fw_main_task_is_idle(uint32_t buttons, uint32_t keys);
 
 const char *FIRMWARE_VERSION_STRING = "V0.2.4";
-TaskHandle_t fwMainTaskHandle;
+TaskHandle_t fwMainTaskHandle = NULL;
 
 void fw_init()
 {
@@ -36,8 +40,8 @@ void fw_init()
 				"fw main task",                      /* task name for kernel awareness debugging */
 				5000L / sizeof(portSTACK_TYPE),      /* task stack size */
 				NULL,                      			 /* optional task startup argument */
-				5U,                                  /* initial priority */
-				fwMainTaskHandle					 /* optional task handle to create */
+				TASK_PRIORITY_UI,                    /* initial priority */
+				&fwMainTaskHandle					 /* optional task handle to create */
 				);
 
     vTaskStartScheduler();
@@ -57,11 +61,15 @@ void fw_main_task()
 	uint32_t buttons;
 	int button_event;
 	
+	// Started first, the cycle counter also times the init code
+	init_pit();
+
     USB_DeviceApplicationInit();
 
     // Init I2C
     init_I2C0a();
     setup_I2C0();
+    init_EEPROM_task();
     settingsLoadSettings();
 
 	fw_init_common();
@@ -86,6 +94,13 @@ void fw_main_task()
     dac_init();
 
     SPI_Flash_init();
+    if (!calibrationInit())
+    {
+#if defined(USE_SEGGER_RTT)
+    	SEGGER_RTT_printf(0,"Calibration read failed, retrying on the next retune\n");
+#endif
+    }
+    codeplugIndexInit();
 
     // Init AT1846S
     I2C_AT1846S_init();
@@ -103,13 +118,9 @@ void fw_main_task()
     // Small startup delay after initialization to stabilize system
     vTaskDelay(portTICK_PERIOD_MS * 500);
 
-	init_pit();
-
 	open_squelch=false;
 	HR_C6000_datalogging=false;
 
-	trx_measure_count = 0;
-
 	if (get_battery_voltage()<CUTOFF_VOLTAGE_UPPER_HYST)
 	{
 		show_lowbattery();
@@ -119,6 +130,10 @@ void fw_main_task()
 
 	init_hrc6000_task();
 
+	init_usb_task();
+
+	UC1701_initFlushTask();
+
 	init_watchdog();
 
     fw_init_beep_task();
@@ -133,92 +148,122 @@ void fw_main_task()
     lastheardInitList();
     menuInitMenuSystem();
 
-    while (1U)
-    {
-    	taskENTER_CRITICAL();
-    	uint32_t tmp_timer_maintask=timer_maintask;
-    	taskEXIT_CRITICAL();
-    	if (tmp_timer_maintask==0)
-    	{
-        	taskENTER_CRITICAL();
-    		timer_maintask=10;
-    	    alive_maintask=true;
-        	taskEXIT_CRITICAL();
-
-        	tick_com_request();
-
-        	fw_check_button_event(&buttons, &button_event);// Read button state and event
-        	fw_check_key_event(&keys, &key_event);// Read keyboard state and event
-
-        	if (key_event==EVENT_KEY_CHANGE)
-        	{
-        		if (keys!=0)
-        		{
-            	    set_melody(melody_key_beep);
-        		}
-        	}
-
-        	if (button_event==EVENT_BUTTON_CHANGE)
-        	{
-        		/*
-        		if ((buttons & BUTTON_SK1)!=0)
-        		{
-            	    set_melody(melody_sk1_beep);
-        		}
-        		else if ((buttons & BUTTON_SK2)!=0)
-        		{
-            	    set_melody(melody_sk2_beep);
-        		}
-        		else if ((buttons & BUTTON_ORANGE)!=0)
-        		{
-            	    set_melody(melody_orange_beep);
-        		}
-        		*/
-
-        		if (((buttons & BUTTON_PTT)!=0) && (slot_state==DMR_STATE_IDLE))
-        		{
-        			menuSystemPushNewMenu(MENU_TX_SCREEN);
-        		}
-        	}
-
-        	menuSystemCallCurrentMenuTick(buttons,keys,(button_event<<1) | key_event);
-
-        	if (((GPIO_PinRead(GPIO_Power_Switch, Pin_Power_Switch)!=0)
-        			|| (battery_voltage<CUTOFF_VOLTAGE_LOWER_HYST))
-        			&& (menuSystemGetCurrentMenuNumber() != MENU_POWER_OFF))
-        	{
-				settingsSaveSettings();
-
-        		if (battery_voltage<CUTOFF_VOLTAGE_LOWER_HYST)
-        		{
-        			show_lowbattery();
-
-                	if (GPIO_PinRead(GPIO_Power_Switch, Pin_Power_Switch)!=0)
-					{
-        				// This turns the power off to the CPU.
-        				GPIO_PinWrite(GPIO_Keep_Power_On, Pin_Keep_Power_On, 0);
-        			}
-        		}
-        		else
-        		{
-					menuSystemPushNewMenu(MENU_POWER_OFF);
-        		}
-    		    GPIO_PinWrite(GPIO_speaker_mute, Pin_speaker_mute, 0);
-    		    set_melody(NULL);
-        	}
-
-    		if (menuDisplayLightTimer > 0)
-    		{
-    			menuDisplayLightTimer--;
-    			if (menuDisplayLightTimer==0)
-    			{
-    				fw_displayEnableBacklight(false);
-    			}
-    		}
-
-    		tick_melody();
-    	}
-
-		vTaskDelay(0);
-    }
+	TickType_t lastWakeTime = xTaskGetTickCount();
+
+	while (1U)
+	{
+		taskENTER_CRITICAL();
+		alive_maintask=true;
+		taskEXIT_CRITICAL();
+
+		fw_check_button_event(&buttons, &button_event);// Read button state and event
+		fw_check_key_event(&keys, &key_event);// Read keyboard state and event
+
+		if (key_event==EVENT_KEY_CHANGE)
+		{
+			if (keys!=0)
+			{
+				set_melody(melody_key_beep);
+			}
+		}
+
+		if (button_event==EVENT_BUTTON_CHANGE)
+		{
+			/*
+			if ((buttons & BUTTON_SK1)!=0)
+			{
+				set_melody(melody_sk1_beep);
+			}
+			else if ((buttons & BUTTON_SK2)!=0)
+			{
+				set_melody(melody_sk2_beep);
+			}
+			else if ((buttons & BUTTON_ORANGE)!=0)
+			{
+				set_melody(melody_orange_beep);
+			}
+			*/
+
+			if (((buttons & BUTTON_PTT)!=0) && (slot_state==DMR_STATE_IDLE))
+			{
+				menuSystemPushNewMenu(MENU_TX_SCREEN);
+			}
+		}
+
+#if defined(UI_STRESS_TEST)
+		// Stress scenario for the task priorities, not part of a normal build.
+		// Build with UI_STRESS_TEST defined (-DUI_STRESS_TEST in the compiler settings), then:
+		// 1. Reset the counters with USB 'S' type 1, com_requestbuffer[2]=1.
+		// 2. Receive DMR voice for a few minutes, the screen redraws on every pass of this loop,
+		//    alternating with the caller data screen which also does a DMR ID lookup.
+		// 3. Read 'S' type 1 again. The timeslot interrupt count (7th value) has to have grown
+		//    and the overrun count (8th value) has to be 0, or a slot was missed while the UI drew.
+		if (menuDisplayQSODataState == QSO_DISPLAY_IDLE)
+		{
+			static bool stressCallerData = false;
+			stressCallerData = !stressCallerData;
+			menuDisplayQSODataState = stressCallerData ? QSO_DISPLAY_CALLER_DATA : QSO_DISPLAY_DEFAULT_SCREEN;
+		}
+#endif
+
+		menuSystemCallCurrentMenuTick(buttons,keys,(button_event<<1) | key_event);
+
+		if (((GPIO_PinRead(GPIO_Power_Switch, Pin_Power_Switch)!=0)
+				|| (battery_voltage<CUTOFF_VOLTAGE_LOWER_HYST))
+				&& (menuSystemGetCurrentMenuNumber() != MENU_POWER_OFF))
+		{
+			settingsSaveSettings();
+
+			if (battery_voltage<CUTOFF_VOLTAGE_LOWER_HYST)
+			{
+				show_lowbattery();
+
+				if (GPIO_PinRead(GPIO_Power_Switch, Pin_Power_Switch)!=0)
+				{
+					EEPROM_Flush();
+					// This turns the power off to the CPU.
+					GPIO_PinWrite(GPIO_Keep_Power_On, Pin_Keep_Power_On, 0);
+				}
+			}
+			else
+			{
+				menuSystemPushNewMenu(MENU_POWER_OFF);
+			}
+			GPIO_PinWrite(GPIO_speaker_mute, Pin_speaker_mute, 0);
+			set_melody(NULL);
+		}
+
+		if (menuDisplayLightTimer > 0)
+		{
+			menuDisplayLightTimer--;
+			if (menuDisplayLightTimer==0)
+			{
+				fw_displayEnableBacklight(false);
+			}
+		}
+
+		tick_melody();
+
+		if (fw_main_task_is_idle(buttons, keys))
+		{
+			// Poll slowly so that the tickless idle can sleep
+			vTaskDelay(pdMS_TO_TICKS(MAIN_TASK_IDLE_PERIOD_MS));
+			lastWakeTime = xTaskGetTickCount();
+		}
+		else
+		{
+			if ((xTaskGetTickCount() - lastWakeTime) > pdMS_TO_TICKS(MAIN_TASK_PERIOD_MS))
+			{
+				lastWakeTime = xTaskGetTickCount();// don't try to catch up after a long operation
+			}
+			vTaskDelayUntil(&lastWakeTime, pdMS_TO_TICKS(MAIN_TASK_PERIOD_MS));
+		}
+	}
+}
+
+static bool fw_main_task_is_idle(uint32_t buttons, uint32_t keys)
+{
+	return ((buttons==0) && (keys==0) && (!melody_is_playing()) &&
+			(trxIsTransmitting==false) && (slot_state==DMR_STATE_IDLE) &&
+			(menuDisplayQSODataState==QSO_DISPLAY_IDLE) && (fw_displayIsBacklightLit()==false));
 }
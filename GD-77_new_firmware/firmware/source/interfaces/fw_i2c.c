@@ -20,6 +20,44 @@
 
 uint8_t i2c_master_buff[I2C_DATA_LENGTH];
 
+volatile uint32_t i2cTransfers = 0;
+volatile uint32_t i2cBusCycles = 0;
+volatile uint32_t i2cShadowWriteHits = 0;
+volatile uint32_t i2cShadowReadHits = 0;
+volatile TickType_t i2cStatsStartTick = 0;
+
+#define I2C_TRANSFER_TIMEOUT_MS  20 // a full EEPROM page at 400 kHz takes about 3.3 ms
+#define I2C_STREAM_LENGTH        32
+
+static SemaphoreHandle_t i2cMutex = NULL;
+static SemaphoreHandle_t i2cComplete = NULL;
+static i2c_master_handle_t i2cHandle;
+static volatile status_t i2cStatus;
+static volatile uint32_t i2cTransferStartCycles;
+
+// Register writes queued by write_I2C_reg_2byte_list(), chained from the transfer complete interrupt
+static uint8_t i2cStreamList[I2C_STREAM_LENGTH][3];
+static i2c_master_transfer_t i2cStreamXfer;
+static volatile int i2cStreamNext;
+static volatile int i2cStreamCount;
+
+// Write-through copy of the AT1846S registers, only accessed with the bus held.
+// Registers enter the shadow when written, or when read for a masked update, so the status registers
+// that are only ever read are never cached. Registers that trigger an action are always written.
+// Register 0x7F selects the page the other addresses refer to. Only page 0 is shadowed, while another page
+// is selected, or the page is unknown after a failed transfer, the shadow is bypassed.
+#define AT1846_SHADOW_REGS  128
+#define AT1846_PAGE_REG     0x7F
+#define AT1846_PAGE_UNKNOWN 0xFFFF
+
+static uint16_t shadow_AT1846[AT1846_SHADOW_REGS];
+static uint32_t shadowValid_AT1846[AT1846_SHADOW_REGS/32];
+static uint16_t shadowPage_AT1846 = AT1846_PAGE_UNKNOWN;
+
+static const uint8_t shadowAlwaysWrittenRegs_AT1846[] = { 0x05, 0x30, AT1846_PAGE_REG };
+
+static void i2c_transfer_callback(I2C_Type *base, i2c_master_handle_t *handle, status_t status, void *userData);
+
 void init_I2C0a()
 {
     // I2C0a to AT24C512 EEPROM & AT1846S
@@ -110,6 +148,242 @@ void setup_I2C0()
 	masterConfig.baudRate_Bps = I2C_BAUDRATE;
 
 	I2C_MasterInit(I2C0, &masterConfig, CLOCK_GetFreq(I2C0_CLK_SRC));
+
+	if (i2cMutex == NULL)
+	{
+		i2cMutex = xSemaphoreCreateRecursiveMutex();
+		i2cComplete = xSemaphoreCreateBinary();
+	}
+	I2C_MasterTransferCreateHandle(I2C0, &i2cHandle, i2c_transfer_callback, NULL);
+
+	shadowPage_AT1846 = AT1846_PAGE_UNKNOWN;// the chip may not have been reset with the CPU
+	invalidate_I2C_shadow_AT1846();
+	i2cStatsStartTick = xTaskGetTickCount();
+}
+
+// The EEPROM and the AT1846S share I2C0. Tasks take the bus per transaction, so a long EEPROM
+// page write only delays the other bus users instead of masking the scheduler.
+// Before the scheduler runs, or with interrupts masked, transfers are polled, but only on a bus no other task holds.
+static bool i2c_can_block()
+{
+	return ((i2cMutex != NULL) && (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING) && (__get_BASEPRI() == 0) && (__get_IPSR() == 0));
+}
+
+i2cLock_t lock_I2C()
+{
+	TaskHandle_t holder;
+
+	if (i2c_can_block())
+	{
+		xSemaphoreTakeRecursive(i2cMutex, portMAX_DELAY);
+		return I2C_LOCK_MUTEX;
+	}
+	if (i2cMutex == NULL)
+	{
+		return I2C_LOCK_POLLED;
+	}
+
+	// Nothing here can block, so the holder can't change under us and the ISR variant needs no critical section
+	holder = xSemaphoreGetMutexHolderFromISR(i2cMutex);
+	if ((holder == NULL) || ((__get_IPSR() == 0) && (holder == xTaskGetCurrentTaskHandle())))
+	{
+		return I2C_LOCK_POLLED;
+	}
+	return I2C_LOCK_BUSY;
+}
+
+void unlock_I2C(i2cLock_t lock)
+{
+	if (lock == I2C_LOCK_MUTEX)
+	{
+		xSemaphoreGiveRecursive(i2cMutex);
+	}
+}
+
+static status_t i2c_stream_start_next()
+{
+	uint8_t *entry = i2cStreamList[i2cStreamNext++];
+
+	memset(&i2cStreamXfer, 0, sizeof(i2cStreamXfer));
+	i2cStreamXfer.slaveAddress = I2C_MASTER_SLAVE_ADDR_7BIT;
+	i2cStreamXfer.direction = kI2C_Write;
+	i2cStreamXfer.subaddress = entry[0];
+	i2cStreamXfer.subaddressSize = 1;
+	i2cStreamXfer.data = &entry[1];
+	i2cStreamXfer.dataSize = 2;
+	i2cStreamXfer.flags = kI2C_TransferDefaultFlag;
+
+	i2cTransfers++;
+	i2cTransferStartCycles = DWT->CYCCNT;
+	return I2C_MasterTransferNonBlocking(I2C0, &i2cHandle, &i2cStreamXfer);
+}
+
+static void i2c_transfer_callback(I2C_Type *base, i2c_master_handle_t *handle, status_t status, void *userData)
+{
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	i2cBusCycles += DWT->CYCCNT - i2cTransferStartCycles;
+
+	if ((status == kStatus_Success) && (i2cStreamNext < i2cStreamCount))
+	{
+		status = i2c_stream_start_next();
+		if (status == kStatus_Success)
+		{
+			return;
+		}
+	}
+	i2cStreamCount = 0;
+
+	i2cStatus = status;
+	xSemaphoreGiveFromISR(i2cComplete, &xHigherPriorityTaskWoken);
+	portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
+
+// Called with the bus held. The calling task sleeps while the interrupt handler runs the transfer.
+static status_t i2c_transfer(i2c_master_transfer_t *xfer, i2cLock_t lock)
+{
+    status_t status;
+
+    if (lock == I2C_LOCK_POLLED)
+    {
+    	uint32_t startCycles = DWT->CYCCNT;
+
+    	i2cTransfers++;
+    	status = I2C_MasterTransferBlocking(I2C0, xfer);
+    	i2cBusCycles += DWT->CYCCNT - startCycles;
+    	return status;
+    }
+
+    xSemaphoreTake(i2cComplete, 0);// discard a completion left over from an aborted transfer
+    if (xfer == NULL)
+    {
+    	status = i2c_stream_start_next();
+    }
+    else
+    {
+    	i2cTransfers++;
+    	i2cTransferStartCycles = DWT->CYCCNT;
+    	status = I2C_MasterTransferNonBlocking(I2C0, &i2cHandle, xfer);
+    }
+    if (status != kStatus_Success)
+    {
+    	i2cStreamCount = 0;
+    	return status;
+    }
+
+	if (xSemaphoreTake(i2cComplete, pdMS_TO_TICKS(I2C_TRANSFER_TIMEOUT_MS)) != pdTRUE)
+	{
+		I2C_MasterTransferAbort(I2C0, &i2cHandle);
+		i2cStreamCount = 0;
+		return kStatus_I2C_Timeout;
+	}
+	return i2cStatus;
+}
+
+int transfer_I2C(i2c_master_transfer_t *xfer)
+{
+	i2cLock_t lock;
+    status_t status;
+
+	lock = lock_I2C();
+	if (lock == I2C_LOCK_BUSY)
+	{
+		return kStatus_I2C_Busy;
+	}
+	status = i2c_transfer(xfer, lock);
+	unlock_I2C(lock);
+
+	return status;
+}
+
+static bool i2c_shadow_get_AT1846(uint8_t addr, uint8_t reg, uint16_t *val)
+{
+	if ((addr != I2C_MASTER_SLAVE_ADDR_7BIT) || (reg >= AT1846_SHADOW_REGS) || (shadowPage_AT1846 != 0) || !(shadowValid_AT1846[reg >> 5] & (1U << (reg & 0x1F))))
+	{
+		return false;
+	}
+	*val = shadow_AT1846[reg];
+	return true;
+}
+
+static void i2c_shadow_set_AT1846(uint8_t addr, uint8_t reg, uint16_t val)
+{
+	if ((addr != I2C_MASTER_SLAVE_ADDR_7BIT) || (reg >= AT1846_SHADOW_REGS))
+	{
+		return;
+	}
+	if (reg == AT1846_PAGE_REG)
+	{
+		shadowPage_AT1846 = val;
+		return;
+	}
+	if (shadowPage_AT1846 != 0)
+	{
+		return;
+	}
+	if ((reg == 0x30) && (val & 0x0001))
+	{
+		// Soft reset, every register returns to its default
+		invalidate_I2C_shadow_AT1846();
+		return;
+	}
+	shadow_AT1846[reg] = val;
+	shadowValid_AT1846[reg >> 5] |= (1U << (reg & 0x1F));
+}
+
+static void i2c_shadow_invalidate_AT1846(uint8_t addr, uint8_t reg)
+{
+	if ((addr != I2C_MASTER_SLAVE_ADDR_7BIT) || (reg >= AT1846_SHADOW_REGS))
+	{
+		return;
+	}
+	if (reg == AT1846_PAGE_REG)
+	{
+		// Page 0 writes are not shadowed until the page is known again, the copy could go stale meanwhile
+		shadowPage_AT1846 = AT1846_PAGE_UNKNOWN;
+		memset(shadowValid_AT1846, 0, sizeof(shadowValid_AT1846));
+	}
+	else if (shadowPage_AT1846 == 0)
+	{
+		shadowValid_AT1846[reg >> 5] &= ~(1U << (reg & 0x1F));
+	}
+}
+
+// True if the write can be skipped because the chip already holds the value
+static bool i2c_shadow_matches_AT1846(uint8_t addr, uint8_t reg, uint16_t val)
+{
+	uint16_t current;
+
+	if (!i2c_shadow_get_AT1846(addr, reg, &current) || (current != val))
+	{
+		return false;
+	}
+	for (int i = 0; i < sizeof(shadowAlwaysWrittenRegs_AT1846); i++)
+	{
+		if (shadowAlwaysWrittenRegs_AT1846[i] == reg)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void invalidate_I2C_shadow_AT1846()
+{
+	i2cLock_t lock = lock_I2C();
+	memset(shadowValid_AT1846, 0, sizeof(shadowValid_AT1846));
+	unlock_I2C(lock);
+}
+
+void reset_I2C_stats()
+{
+	taskENTER_CRITICAL();
+	i2cTransfers = 0;
+	i2cBusCycles = 0;
+	i2cShadowWriteHits = 0;
+	i2cShadowReadHits = 0;
+	i2cStatsStartTick = xTaskGetTickCount();
+	taskEXIT_CRITICAL();
 }
 
 void clear_I2C_buffer()
@@ -122,102 +396,172 @@ void clear_I2C_buffer()
 
 int write_I2C_reg_2byte(uint8_t addr, uint8_t reg, uint8_t val1, uint8_t val2)
 {
+	i2cLock_t lock;
     i2c_master_transfer_t masterXfer;
     status_t status;
 
-	taskENTER_CRITICAL();
-	clear_I2C_buffer();
-	i2c_master_buff[0] = reg;
-	i2c_master_buff[1] = val1;
-	i2c_master_buff[2] = val2;
+	lock = lock_I2C();
+	if (lock == I2C_LOCK_BUSY)
+	{
+		return kStatus_I2C_Busy;
+	}
+	if (i2c_shadow_matches_AT1846(addr, reg, (val1 << 8) | val2))
+	{
+		i2cShadowWriteHits++;
+		unlock_I2C(lock);
+		return kStatus_Success;
+	}
+
+	i2c_master_buff[0] = val1;
+	i2c_master_buff[1] = val2;
 
     memset(&masterXfer, 0, sizeof(masterXfer));
     masterXfer.slaveAddress = addr;
     masterXfer.direction = kI2C_Write;
-    masterXfer.subaddress = 0;
-    masterXfer.subaddressSize = 0;
+    masterXfer.subaddress = reg;
+    masterXfer.subaddressSize = 1;
     masterXfer.data = i2c_master_buff;
-    masterXfer.dataSize = 3;
+    masterXfer.dataSize = 2;
     masterXfer.flags = kI2C_TransferDefaultFlag;
 
-    status = I2C_MasterTransferBlocking(I2C0, &masterXfer);
+    status = i2c_transfer(&masterXfer, lock);
     if (status != kStatus_Success)
     {
-    	taskEXIT_CRITICAL();
+    	i2c_shadow_invalidate_AT1846(addr, reg);
+    	unlock_I2C(lock);
     	return status;
     }
+    i2c_shadow_set_AT1846(addr, reg, (val1 << 8) | val2);
 
-	taskEXIT_CRITICAL();
+	unlock_I2C(lock);
 	return kStatus_Success;
 }
 
+// Sends a table of { reg, high byte, low byte } entries. Entries the chip already holds are dropped,
+// the rest go out back to back from the transfer complete interrupt.
+int write_I2C_reg_2byte_list(uint8_t addr, const uint8_t settings[][3], int numSettings)
+{
+	i2cLock_t lock;
+    status_t status = kStatus_Success;
+	int i = 0;
+
+	if ((addr != I2C_MASTER_SLAVE_ADDR_7BIT) || !i2c_can_block())
+	{
+		for (i = 0; (i < numSettings) && (status == kStatus_Success); i++)
+		{
+			status = write_I2C_reg_2byte(addr, settings[i][0], settings[i][1], settings[i][2]);
+		}
+		return status;
+	}
+
+	lock = lock_I2C();
+	if (lock == I2C_LOCK_BUSY)
+	{
+		return kStatus_I2C_Busy;
+	}
+	while ((i < numSettings) && (status == kStatus_Success))
+	{
+		int count = 0;
+
+		for (; (i < numSettings) && (count < I2C_STREAM_LENGTH); i++)
+		{
+			uint16_t val = (settings[i][1] << 8) | settings[i][2];
+
+			if (i2c_shadow_matches_AT1846(addr, settings[i][0], val))
+			{
+				i2cShadowWriteHits++;
+				continue;
+			}
+			memcpy(i2cStreamList[count++], settings[i], 3);
+			i2c_shadow_set_AT1846(addr, settings[i][0], val);
+		}
+
+		if (count > 0)
+		{
+			i2cStreamNext = 0;
+			i2cStreamCount = count;
+			status = i2c_transfer(NULL, lock);
+		}
+	}
+	if (status != kStatus_Success)
+	{
+		// Unknown how far the table got, or which page it left selected
+		memset(shadowValid_AT1846, 0, sizeof(shadowValid_AT1846));
+		shadowPage_AT1846 = AT1846_PAGE_UNKNOWN;
+	}
+	unlock_I2C(lock);
+
+	return status;
+}
+
 int read_I2C_reg_2byte(uint8_t addr, uint8_t reg, uint8_t* val1, uint8_t* val2)
 {
+	i2cLock_t lock;
     i2c_master_transfer_t masterXfer;
     status_t status;
 
-	taskENTER_CRITICAL();
-	clear_I2C_buffer();
-	i2c_master_buff[0] = reg;
+	lock = lock_I2C();
+	if (lock == I2C_LOCK_BUSY)
+	{
+		return kStatus_I2C_Busy;
+	}
 
     memset(&masterXfer, 0, sizeof(masterXfer));
     masterXfer.slaveAddress = addr;
-    masterXfer.direction = kI2C_Write;
-    masterXfer.subaddress = 0;
-    masterXfer.subaddressSize = 0;
-    masterXfer.data = i2c_master_buff;
-    masterXfer.dataSize = 1;
-    masterXfer.flags = kI2C_TransferDefaultFlag;
-
-    status = I2C_MasterTransferBlocking(I2C0, &masterXfer);
-    if (status != kStatus_Success)
-    {
-    	taskEXIT_CRITICAL();
-    	return status;
-    }
-
-	clear_I2C_buffer();
-
-    masterXfer.slaveAddress = I2C_MASTER_SLAVE_ADDR_7BIT;
     masterXfer.direction = kI2C_Read;
-    masterXfer.subaddress = 0;
-    masterXfer.subaddressSize = 0;
+    masterXfer.subaddress = reg;
+    masterXfer.subaddressSize = 1;
     masterXfer.data = i2c_master_buff;
     masterXfer.dataSize = 2;
     masterXfer.flags = kI2C_TransferDefaultFlag;
 
-    status = I2C_MasterTransferBlocking(I2C0, &masterXfer);
+    status = i2c_transfer(&masterXfer, lock);
     if (status != kStatus_Success)
     {
-    	taskEXIT_CRITICAL();
+    	unlock_I2C(lock);
     	return status;
     }
 
     *val1 = i2c_master_buff[0];
     *val2 = i2c_master_buff[1];
 
-	taskEXIT_CRITICAL();
+	unlock_I2C(lock);
 	return kStatus_Success;
 }
 
 int set_clear_I2C_reg_2byte_with_mask(uint8_t reg, uint8_t mask1, uint8_t mask2, uint8_t val1, uint8_t val2)
 {
+	i2cLock_t lock;
     status_t status;
-
+	uint16_t current;
 	uint8_t tmp_val1;
 	uint8_t tmp_val2;
-	status = read_I2C_reg_2byte(I2C_MASTER_SLAVE_ADDR_7BIT, reg, &tmp_val1, &tmp_val2);
-    if (status != kStatus_Success)
-    {
-    	return status;
-    }
+
+	lock = lock_I2C();
+	if (lock == I2C_LOCK_BUSY)
+	{
+		return kStatus_I2C_Busy;
+	}
+	if (i2c_shadow_get_AT1846(I2C_MASTER_SLAVE_ADDR_7BIT, reg, &current))
+	{
+		i2cShadowReadHits++;
+		tmp_val1 = current >> 8;
+		tmp_val2 = current & 0xff;
+	}
+	else
+	{
+		status = read_I2C_reg_2byte(I2C_MASTER_SLAVE_ADDR_7BIT, reg, &tmp_val1, &tmp_val2);
+		if (status != kStatus_Success)
+		{
+			unlock_I2C(lock);
+			return status;
+		}
+		i2c_shadow_set_AT1846(I2C_MASTER_SLAVE_ADDR_7BIT, reg, (tmp_val1 << 8) | tmp_val2);
+	}
 	tmp_val1=val1 | (tmp_val1 & mask1);
 	tmp_val2=val2 | (tmp_val2 & mask2);
 	status = write_I2C_reg_2byte(I2C_MASTER_SLAVE_ADDR_7BIT, reg, tmp_val1, tmp_val2);
-    if (status != kStatus_Success)
-    {
-    	return status;
-    }
+	unlock_I2C(lock);
 
-	return kStatus_Success;
+	return status;
 }
@@ -48,6 +48,7 @@ void init_I2S()
 void SAI_TX_Callback(I2S_Type *base, sai_edma_handle_t *handle, status_t status, void *userData)
 {
 	g_TX_SAI_in_use = false;
+	update_rx_audio_latency();
 	send_sound_data();
 }
 
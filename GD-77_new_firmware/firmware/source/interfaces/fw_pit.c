@@ -18,55 +18,56 @@
 
 #include "fw_pit.h"
 
-volatile uint32_t timer_maintask;
-volatile uint32_t timer_beeptask;
-volatile uint32_t timer_hrc6000task;
-volatile uint32_t timer_watchdogtask;
-volatile uint32_t PITCounter;
+volatile uint32_t sleepCount;
+volatile uint64_t sleepTimeUs;
+volatile TickType_t sleepStatsStartTick;
+
+static uint32_t pitCountsPerUs = 0;// also marks the PIT as clocked and running
+static uint32_t sleepStartCount;
 
 void init_pit()
 {
-	taskENTER_CRITICAL();
-	timer_maintask=0;
-	timer_beeptask=0;
-	timer_hrc6000task=0;
-	timer_watchdogtask=0;
-	taskEXIT_CRITICAL();
+	// Free running core cycle counter, used for latency measurements
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
 
 	pit_config_t pitConfig;
 	PIT_GetDefaultConfig(&pitConfig);
 	PIT_Init(PIT, &pitConfig);
 
-	PIT_SetTimerPeriod(PIT, kPIT_Chnl_0, USEC_TO_COUNT(100U, CLOCK_GetFreq(kCLOCK_BusClk)));
-	PIT_EnableInterrupts(PIT, kPIT_Chnl_0, kPIT_TimerInterruptEnable);
-
-	EnableIRQ(PIT0_IRQn);
-
+	// Channel 0 free runs without interrupts and keeps counting while the core sleeps
+	PIT_SetTimerPeriod(PIT, kPIT_Chnl_0, 0xFFFFFFFF);
     PIT_StartTimer(PIT, kPIT_Chnl_0);
+
+    reset_sleep_stats();
+	pitCountsPerUs = USEC_TO_COUNT(1U, CLOCK_GetFreq(kCLOCK_BusClk));
 }
 
-void PIT0_IRQHandler(void)
+void reset_sleep_stats()
 {
-	PITCounter++;// is unsigned so will wrap around
+	taskENTER_CRITICAL();
+	sleepCount=0;
+	sleepTimeUs=0;
+	sleepStatsStartTick=xTaskGetTickCount();
+	taskEXIT_CRITICAL();
+}
 
-	if (timer_maintask>0)
-	{
-		timer_maintask--;
-	}
-	if (timer_beeptask>0)
-	{
-		timer_beeptask--;
-	}
-	if (timer_hrc6000task>0)
+// Called by the tickless idle with interrupts disabled, just before and after WFI
+void pit_pre_sleep()
+{
+	if (pitCountsPerUs>0)
 	{
-		timer_hrc6000task--;
+		sleepStartCount = PIT_GetCurrentTimerCount(PIT, kPIT_Chnl_0);
 	}
-	if (timer_watchdogtask>0)
+}
+
+void pit_post_sleep()
+{
+	if (pitCountsPerUs>0)
 	{
-		timer_watchdogtask--;
+		uint32_t counts = sleepStartCount - PIT_GetCurrentTimerCount(PIT, kPIT_Chnl_0);// counts down
+		sleepCount++;
+		sleepTimeUs += counts / pitCountsPerUs;
 	}
-
-    /* Clear interrupt flag.*/
-    PIT_ClearStatusFlags(PIT, kPIT_Chnl_0, kPIT_TimerFlag);
-    __DSB();
 }
@@ -23,6 +23,65 @@ uint8_t SPI_masterSendBuffer_SPI0[SPI_DATA_LENGTH] = {0};
 uint8_t spi_masterReceiveBuffer_SPI1[SPI_DATA_LENGTH] = {0};
 uint8_t SPI_masterSendBuffer_SPI1[SPI_DATA_LENGTH] = {0};
 
+volatile uint32_t spiScriptEntries = 0;
+volatile uint32_t spiScriptTransfers = 0;
+volatile uint32_t spiScriptBurstMismatches = 0;
+
+volatile uint32_t spiTransactions_SPI0 = 0;
+volatile uint32_t spiTransactions_SPI1 = 0;
+volatile uint32_t spiShadowHits_SPI0 = 0;
+volatile TickType_t spiStatsStartTick = 0;
+
+#define SPI_TRANSFER_TIMEOUT_MS  10 // 256 bytes at 500 kHz take about 4 ms
+
+// How spi_lock() got the bus. The transfer and spi_unlock() go by this instead of looking at the context again,
+// which may have changed in between (e.g. a critical section entered while the bus was held).
+typedef enum
+{
+	SPI_LOCK_BUSY = 0,// polling only, but another task holds the bus, nothing may be sent
+	SPI_LOCK_POLLED,// before the scheduler runs or with interrupts masked, the transfer is polled
+	SPI_LOCK_MUTEX
+} spi_lock_t;
+
+// One per DSPI instance. The recursive mutex serialises the transactions of the tasks sharing the bus,
+// the transfers themselves are interrupt driven and the calling task blocks on the completion semaphore.
+typedef struct
+{
+	SPI_Type *base;
+	uint8_t *sendBuffer;
+	uint8_t *receiveBuffer;
+	dspi_master_handle_t handle;
+	SemaphoreHandle_t mutex;
+	SemaphoreHandle_t complete;
+	volatile status_t status;
+	bool transferPending;
+	spi_lock_t startLock;// held from a _start() to its SPI_wait_SPIx()
+	volatile uint32_t *transactions;
+} spi_bus_t;
+
+static spi_bus_t spiBus_SPI0 = { .base = SPI0, .sendBuffer = SPI_masterSendBuffer_SPI0, .receiveBuffer = spi_masterReceiveBuffer_SPI0, .transactions = &spiTransactions_SPI0 };
+static spi_bus_t spiBus_SPI1 = { .base = SPI1, .sendBuffer = SPI_masterSendBuffer_SPI1, .receiveBuffer = spi_masterReceiveBuffer_SPI1, .transactions = &spiTransactions_SPI1 };
+
+// Write-through copy of the HR-C6000 page 4 registers, only accessed with the SPI0 bus held.
+// Status and command registers are excluded, they are always read from and written to the chip.
+#define SPI0_SHADOW_PAGE  0x04
+
+static uint8_t shadow_SPI0[256];
+static uint32_t shadowValid_SPI0[256/32];
+static uint32_t shadowUncached_SPI0[256/32];
+
+static const uint8_t shadowUncachedRegs_SPI0[] = { 0x00, 0x21, 0x22, 0x40, 0x41, 0x42, 0x50, 0x51, 0x52, 0x57, 0x5F, 0x82, 0x83, 0x86, 0x88 };
+
+static void spi_setup_bus(spi_bus_t *bus);
+static bool spi_bus_can_block(spi_bus_t *bus);
+static spi_lock_t spi_lock(spi_bus_t *bus);
+static void spi_unlock(spi_bus_t *bus, spi_lock_t lock);
+static status_t spi_start_transfer(spi_bus_t *bus, size_t size, spi_lock_t lock);
+static status_t spi_wait_transfer(spi_bus_t *bus);
+static status_t spi_transfer(spi_bus_t *bus, size_t size, spi_lock_t lock);
+static bool spi_shadow_get_SPI0(uint8_t page, uint8_t reg, uint8_t *val);
+static void spi_shadow_set_SPI0(uint8_t page, uint8_t reg, uint8_t val);
+
 void init_SPI()
 {
     /* PORTD0 is configured as SPI0_CS0 */
@@ -77,6 +136,13 @@ void setup_SPI0()
 	masterConfig_SPI0.samplePoint = kDSPI_SckToSin0Clock;
 
 	DSPI_MasterInit(SPI0, &masterConfig_SPI0, CLOCK_GetFreq(DSPI0_CLK_SRC));
+	spi_setup_bus(&spiBus_SPI0);
+
+	for (int i=0; i<sizeof(shadowUncachedRegs_SPI0); i++)
+	{
+		set_SPI_shadow_uncached_SPI0(shadowUncachedRegs_SPI0[i], true);
+	}
+	invalidate_all_SPI_shadow_SPI0();
 }
 
 void setup_SPI1()
@@ -103,6 +169,202 @@ void setup_SPI1()
     masterConfig_SPI1.samplePoint = kDSPI_SckToSin0Clock;
 
 	DSPI_MasterInit(SPI1, &masterConfig_SPI1, CLOCK_GetFreq(DSPI1_CLK_SRC));
+	spi_setup_bus(&spiBus_SPI1);
+}
+
+static void spi_transfer_callback(SPI_Type *base, dspi_master_handle_t *handle, status_t status, void *userData)
+{
+	spi_bus_t *bus = (spi_bus_t *)userData;
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	bus->status = status;
+	xSemaphoreGiveFromISR(bus->complete, &xHigherPriorityTaskWoken);
+	portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
+
+static void spi_setup_bus(spi_bus_t *bus)
+{
+	if (bus->mutex == NULL)
+	{
+		bus->mutex = xSemaphoreCreateRecursiveMutex();
+		bus->complete = xSemaphoreCreateBinary();
+	}
+	DSPI_MasterTransferCreateHandle(bus->base, &bus->handle, spi_transfer_callback, bus);
+}
+
+// Before the scheduler runs, or with interrupts masked, the transfer falls back to polling
+static bool spi_bus_can_block(spi_bus_t *bus)
+{
+	return ((bus->mutex != NULL) && (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING) && (__get_BASEPRI() == 0) && (__get_IPSR() == 0));
+}
+
+static spi_lock_t spi_lock(spi_bus_t *bus)
+{
+	TaskHandle_t holder;
+
+	if (spi_bus_can_block(bus))
+	{
+		xSemaphoreTakeRecursive(bus->mutex, portMAX_DELAY);
+		return SPI_LOCK_MUTEX;
+	}
+	if (bus->mutex == NULL)
+	{
+		return SPI_LOCK_POLLED;
+	}
+
+	// Nothing here can block, so the holder can't change under us and the ISR variant needs no critical section.
+	// Polling is only safe on a free bus, or on our own bus with no interrupt driven transfer in flight.
+	holder = xSemaphoreGetMutexHolderFromISR(bus->mutex);
+	if ((holder == NULL) || ((__get_IPSR() == 0) && (holder == xTaskGetCurrentTaskHandle()) && !bus->transferPending))
+	{
+		return SPI_LOCK_POLLED;
+	}
+	return SPI_LOCK_BUSY;
+}
+
+static void spi_unlock(spi_bus_t *bus, spi_lock_t lock)
+{
+	if (lock == SPI_LOCK_MUTEX)
+	{
+		xSemaphoreGiveRecursive(bus->mutex);
+	}
+}
+
+static status_t spi_start_transfer(spi_bus_t *bus, size_t size, spi_lock_t lock)
+{
+    dspi_transfer_t masterXfer;
+    status_t status;
+
+    (*bus->transactions)++;
+
+    /*Start master transfer*/
+    masterXfer.txData = bus->sendBuffer;
+    masterXfer.rxData = bus->receiveBuffer;
+    masterXfer.dataSize = size;
+    masterXfer.configFlags = kDSPI_MasterCtar0 | kDSPI_MasterPcs0 | kDSPI_MasterPcsContinuous;
+
+    if (lock == SPI_LOCK_POLLED)
+    {
+    	bus->transferPending = false;
+    	return DSPI_MasterTransferBlocking(bus->base, &masterXfer);
+    }
+
+    xSemaphoreTake(bus->complete, 0);// discard a completion left over from an aborted transfer
+    status = DSPI_MasterTransferNonBlocking(bus->base, &bus->handle, &masterXfer);
+    bus->transferPending = (status == kStatus_Success);
+    return status;
+}
+
+static status_t spi_wait_transfer(spi_bus_t *bus)
+{
+	if (!bus->transferPending)
+	{
+		return kStatus_Success;
+	}
+	bus->transferPending = false;
+
+	if (xSemaphoreTake(bus->complete, pdMS_TO_TICKS(SPI_TRANSFER_TIMEOUT_MS)) != pdTRUE)
+	{
+		DSPI_MasterTransferAbort(bus->base, &bus->handle);
+		return kStatus_Timeout;
+	}
+	return bus->status;
+}
+
+static status_t spi_transfer(spi_bus_t *bus, size_t size, spi_lock_t lock)
+{
+    status_t status;
+
+    status = spi_start_transfer(bus, size, lock);
+    if (status != kStatus_Success)
+    {
+    	return status;
+    }
+    return spi_wait_transfer(bus);
+}
+
+static bool spi_shadow_get_SPI0(uint8_t page, uint8_t reg, uint8_t *val)
+{
+	uint32_t bit = 1U << (reg & 0x1F);
+
+	if ((page != SPI0_SHADOW_PAGE) || !(shadowValid_SPI0[reg >> 5] & bit))
+	{
+		return false;
+	}
+	*val = shadow_SPI0[reg];
+	return true;
+}
+
+static void spi_shadow_set_SPI0(uint8_t page, uint8_t reg, uint8_t val)
+{
+	uint32_t bit = 1U << (reg & 0x1F);
+
+	if ((page != SPI0_SHADOW_PAGE) || (shadowUncached_SPI0[reg >> 5] & bit))
+	{
+		return;
+	}
+	shadow_SPI0[reg] = val;
+	shadowValid_SPI0[reg >> 5] |= bit;
+}
+
+void set_SPI_shadow_uncached_SPI0(uint8_t reg, bool uncached)
+{
+	spi_lock_t lock = spi_lock(&spiBus_SPI0);
+	if (uncached)
+	{
+		shadowUncached_SPI0[reg >> 5] |= 1U << (reg & 0x1F);
+		shadowValid_SPI0[reg >> 5] &= ~(1U << (reg & 0x1F));
+	}
+	else
+	{
+		shadowUncached_SPI0[reg >> 5] &= ~(1U << (reg & 0x1F));
+	}
+	spi_unlock(&spiBus_SPI0, lock);
+}
+
+void invalidate_SPI_shadow_SPI0(uint8_t reg)
+{
+	spi_lock_t lock = spi_lock(&spiBus_SPI0);
+	shadowValid_SPI0[reg >> 5] &= ~(1U << (reg & 0x1F));
+	spi_unlock(&spiBus_SPI0, lock);
+}
+
+// Needed whenever the chip loses its register contents, e.g. after a reset
+void invalidate_all_SPI_shadow_SPI0()
+{
+	spi_lock_t lock = spi_lock(&spiBus_SPI0);
+	for (int i=0; i<(sizeof(shadowValid_SPI0)/sizeof(shadowValid_SPI0[0])); i++)
+	{
+		shadowValid_SPI0[i] = 0;
+	}
+	spi_unlock(&spiBus_SPI0, lock);
+}
+
+// Reloads the register from the chip
+int resync_SPI_shadow_SPI0(uint8_t reg, uint8_t* val)
+{
+	spi_lock_t lock;
+    status_t status;
+
+	lock = spi_lock(&spiBus_SPI0);
+	if (lock == SPI_LOCK_BUSY)
+	{
+		return kStatus_DSPI_Busy;
+	}
+	shadowValid_SPI0[reg >> 5] &= ~(1U << (reg & 0x1F));
+	status = read_SPI_page_reg_byte_SPI0(SPI0_SHADOW_PAGE, reg, val);
+	spi_unlock(&spiBus_SPI0, lock);
+	return status;
+}
+
+void reset_SPI_stats()
+{
+	taskENTER_CRITICAL();
+	spiTransactions_SPI0 = 0;
+	spiTransactions_SPI1 = 0;
+	spiShadowHits_SPI0 = 0;
+	spiStatsStartTick = xTaskGetTickCount();
+	taskEXIT_CRITICAL();
 }
 
 void clear_SPI_buffer_SPI0()
@@ -116,89 +378,137 @@ void clear_SPI_buffer_SPI0()
 
 int write_SPI_page_reg_byte_SPI0(uint8_t page, uint8_t reg, uint8_t val)
 {
-    dspi_transfer_t masterXfer;
+	spi_lock_t lock;
     status_t status;
+	uint8_t shadow_val;
+
+	lock = spi_lock(&spiBus_SPI0);
+	if (lock == SPI_LOCK_BUSY)
+	{
+		return kStatus_DSPI_Busy;
+	}
+	if (spi_shadow_get_SPI0(page, reg, &shadow_val) && (shadow_val == val))
+	{
+		spiShadowHits_SPI0++;
+		spi_unlock(&spiBus_SPI0, lock);
+		return kStatus_Success;
+	}
 
-	taskENTER_CRITICAL();
 	clear_SPI_buffer_SPI0();
 	SPI_masterSendBuffer_SPI0[0]=page;
 	SPI_masterSendBuffer_SPI0[1]=reg;
 	SPI_masterSendBuffer_SPI0[2]=val;
 
-    /*Start master transfer*/
-    masterXfer.txData = SPI_masterSendBuffer_SPI0;
-    masterXfer.rxData = spi_masterReceiveBuffer_SPI0;
-    masterXfer.dataSize = 3;
-    masterXfer.configFlags = kDSPI_MasterCtar0 | kDSPI_MasterPcs0 | kDSPI_MasterPcsContinuous;
-
-    status = DSPI_MasterTransferBlocking(SPI0, &masterXfer);
-    if (status != kStatus_Success)
+    status = spi_transfer(&spiBus_SPI0, 3, lock);
+    if (status == kStatus_Success)
     {
-    	taskEXIT_CRITICAL();
-    	return status;
+    	spi_shadow_set_SPI0(page, reg, val);
     }
 
-	taskEXIT_CRITICAL();
-	return kStatus_Success;
+	spi_unlock(&spiBus_SPI0, lock);
+	return status;
 }
 
 int read_SPI_page_reg_byte_SPI0(uint8_t page, uint8_t reg, uint8_t* val)
 {
-    dspi_transfer_t masterXfer;
+	spi_lock_t lock;
     status_t status;
 
-	taskENTER_CRITICAL();
+	lock = spi_lock(&spiBus_SPI0);
+	if (lock == SPI_LOCK_BUSY)
+	{
+		return kStatus_DSPI_Busy;
+	}
+	if (spi_shadow_get_SPI0(page, reg, val))
+	{
+		spiShadowHits_SPI0++;
+		spi_unlock(&spiBus_SPI0, lock);
+		return kStatus_Success;
+	}
+
 	clear_SPI_buffer_SPI0();
 	SPI_masterSendBuffer_SPI0[0]=page | 0x80;
 	SPI_masterSendBuffer_SPI0[1]=reg;
 	SPI_masterSendBuffer_SPI0[2]=0xFF;
 
-    /*Start master transfer*/
-    masterXfer.txData = SPI_masterSendBuffer_SPI0;
-    masterXfer.rxData = spi_masterReceiveBuffer_SPI0;
-    masterXfer.dataSize = 3;
-    masterXfer.configFlags = kDSPI_MasterCtar0 | kDSPI_MasterPcs0 | kDSPI_MasterPcsContinuous;
-
-    status = DSPI_MasterTransferBlocking(SPI0, &masterXfer);
-    if (status != kStatus_Success)
+    status = spi_transfer(&spiBus_SPI0, 3, lock);
+    if (status == kStatus_Success)
     {
-    	taskEXIT_CRITICAL();
-    	return status;
+    	*val=spi_masterReceiveBuffer_SPI0[2];
+    	spi_shadow_set_SPI0(page, reg, *val);
     }
 
-	*val=spi_masterReceiveBuffer_SPI0[2];
-
-	taskEXIT_CRITICAL();
-	return kStatus_Success;
+	spi_unlock(&spiBus_SPI0, lock);
+	return status;
 }
 
 int set_clear_SPI_page_reg_byte_with_mask_SPI0(uint8_t page, uint8_t reg, uint8_t mask, uint8_t val)
 {
+	spi_lock_t lock;
     status_t status;
-
 	uint8_t tmp_val;
+
+	// Hold the bus so that nobody else changes the register between the read and the write.
+	// For shadowed registers the read comes from RAM and an unchanged value is not written.
+	lock = spi_lock(&spiBus_SPI0);
+	if (lock == SPI_LOCK_BUSY)
+	{
+		return kStatus_DSPI_Busy;
+	}
 	status = read_SPI_page_reg_byte_SPI0(page, reg, &tmp_val);
-    if (status != kStatus_Success)
+    if (status == kStatus_Success)
     {
-    	return status;
+    	tmp_val=val | (tmp_val & mask);
+    	status = write_SPI_page_reg_byte_SPI0(page, reg, tmp_val);
     }
-	tmp_val=val | (tmp_val & mask);
-	status = write_SPI_page_reg_byte_SPI0(page, reg, tmp_val);
+	spi_unlock(&spiBus_SPI0, lock);
+
+	return status;
+}
+
+int write_SPI_page_reg_bytearray_SPI0(uint8_t page, uint8_t reg, const uint8_t* values, uint8_t length)
+{
+    status_t status;
+
+	status = write_SPI_page_reg_bytearray_SPI0_start(page, reg, values, length);
     if (status != kStatus_Success)
     {
     	return status;
     }
-
-	return kStatus_Success;
+	return SPI_wait_SPI0();
 }
 
-int write_SPI_page_reg_bytearray_SPI0(uint8_t page, uint8_t reg, uint8_t* values, uint8_t length)
+// Starts the write and returns with the bus still held, SPI_wait_SPI0() completes it and releases the bus
+int write_SPI_page_reg_bytearray_SPI0_start(uint8_t page, uint8_t reg, const uint8_t* values, uint8_t length)
 {
-    dspi_transfer_t masterXfer;
+	spi_lock_t lock;
     status_t status;
+	uint8_t shadow_val;
+	int unchanged = 0;
+
+	lock = spi_lock(&spiBus_SPI0);
+	if (lock == SPI_LOCK_BUSY)
+	{
+		return kStatus_DSPI_Busy;
+	}
+	spiBus_SPI0.startLock = lock;
+	while ((unchanged < length) && spi_shadow_get_SPI0(page, reg + unchanged, &shadow_val) && (shadow_val == values[unchanged]))
+	{
+		unchanged++;
+	}
+	if (unchanged == length)
+	{
+		// Nothing to send, the bus stays held until SPI_wait_SPI0() as for a real transfer
+		spiShadowHits_SPI0++;
+		spiBus_SPI0.transferPending = false;
+		return kStatus_Success;
+	}
+
+	for (int i=0; i<length; i++)
+	{
+		spi_shadow_set_SPI0(page, reg + i, values[i]);
+	}
 
-	taskENTER_CRITICAL();
-	clear_SPI_buffer_SPI0();
 	SPI_masterSendBuffer_SPI0[0]=page;
 	SPI_masterSendBuffer_SPI0[1]=reg;
 	for (int i=0; i<length; i++)
@@ -206,29 +516,40 @@ int write_SPI_page_reg_bytearray_SPI0(uint8_t page, uint8_t reg, uint8_t* values
 		SPI_masterSendBuffer_SPI0[i+2]=values[i];
 	}
 
-    /*Start master transfer*/
-    masterXfer.txData = SPI_masterSendBuffer_SPI0;
-    masterXfer.rxData = spi_masterReceiveBuffer_SPI0;
-    masterXfer.dataSize = length+2;
-    masterXfer.configFlags = kDSPI_MasterCtar0 | kDSPI_MasterPcs0 | kDSPI_MasterPcsContinuous;
-
-    status = DSPI_MasterTransferBlocking(SPI0, &masterXfer);
+    status = spi_start_transfer(&spiBus_SPI0, length+2, lock);
     if (status != kStatus_Success)
     {
-    	taskEXIT_CRITICAL();
-    	return status;
+    	invalidate_all_SPI_shadow_SPI0();
+    	spi_unlock(&spiBus_SPI0, lock);
     }
+	return status;
+}
 
-	taskEXIT_CRITICAL();
-	return kStatus_Success;
+int SPI_wait_SPI0()
+{
+	spi_lock_t lock = spiBus_SPI0.startLock;
+    status_t status;
+
+    status = spi_wait_transfer(&spiBus_SPI0);
+    if (status != kStatus_Success)
+    {
+    	// The shadow was updated when the transfer started
+    	invalidate_all_SPI_shadow_SPI0();
+    }
+	spi_unlock(&spiBus_SPI0, lock);
+	return status;
 }
 
 int read_SPI_page_reg_bytearray_SPI0(uint8_t page, uint8_t reg, uint8_t* values, uint8_t length)
 {
-    dspi_transfer_t masterXfer;
+	spi_lock_t lock;
     status_t status;
 
-	taskENTER_CRITICAL();
+	lock = spi_lock(&spiBus_SPI0);
+	if (lock == SPI_LOCK_BUSY)
+	{
+		return kStatus_DSPI_Busy;
+	}
 	clear_SPI_buffer_SPI0();
 	SPI_masterSendBuffer_SPI0[0]=page | 0x80;
 	SPI_masterSendBuffer_SPI0[1]=reg;
@@ -237,26 +558,165 @@ int read_SPI_page_reg_bytearray_SPI0(uint8_t page, uint8_t reg, uint8_t* values,
 		SPI_masterSendBuffer_SPI0[i+2]=0xFF;
 	}
 
-    /*Start master transfer*/
-    masterXfer.txData = SPI_masterSendBuffer_SPI0;
-    masterXfer.rxData = spi_masterReceiveBuffer_SPI0;
-    masterXfer.dataSize = length+2;
-    masterXfer.configFlags = kDSPI_MasterCtar0 | kDSPI_MasterPcs0 | kDSPI_MasterPcsContinuous;
-
-    status = DSPI_MasterTransferBlocking(SPI0, &masterXfer);
-    if (status != kStatus_Success)
+    status = spi_transfer(&spiBus_SPI0, length+2, lock);
+    if (status == kStatus_Success)
     {
-    	taskEXIT_CRITICAL();
-    	return status;
+    	for (int i=0; i<length; i++)
+    	{
+    		values[i]=spi_masterReceiveBuffer_SPI0[i+2];
+    		spi_shadow_set_SPI0(page, reg + i, values[i]);
+    	}
     }
 
-	for (int i=0; i<length; i++)
+	spi_unlock(&spiBus_SPI0, lock);
+	return status;
+}
+
+static bool spi_script_is_duplicate(const spi_reg_write_t *script, int index)
+{
+	// Look back to the previous write of this register, a strobe in between may have changed it
+	for (int i=index-1; i>=0; i--)
 	{
-		values[i]=spi_masterReceiveBuffer_SPI0[i+2];
+		if (script[i].flags & SPI_REG_STROBE)
+		{
+			return false;
+		}
+		if ((script[i].page == script[index].page) && (script[i].reg == script[index].reg))
+		{
+			return (script[i].val == script[index].val);
+		}
 	}
+	return false;
+}
 
-	taskEXIT_CRITICAL();
-	return kStatus_Success;
+#if defined(HRC6000_PAGE4_BURSTS)
+typedef enum
+{
+	SPI_PAGE4_BURSTS_UNVERIFIED = 0,
+	SPI_PAGE4_BURSTS_VERIFIED,
+	SPI_PAGE4_BURSTS_FAILED
+} spi_page4_bursts_t;
+
+static spi_page4_bursts_t spiPage4Bursts = SPI_PAGE4_BURSTS_UNVERIFIED;
+#endif
+
+// Pages 1-3 are tables the vendor firmware writes as bursts. Page 4 is not known to auto-increment,
+// build with HRC6000_PAGE4_BURSTS to merge its runs too. The first page 4 burst is then read back
+// register by register, and page 4 goes back to single writes if it did not arrive as written.
+static bool spi_script_can_merge(uint8_t page)
+{
+#if defined(HRC6000_PAGE4_BURSTS)
+	if ((page == SPI0_SHADOW_PAGE) && (spiPage4Bursts != SPI_PAGE4_BURSTS_FAILED))
+	{
+		return true;
+	}
+#endif
+	return ((page >= 0x01) && (page <= 0x03));
+}
+
+static status_t spi_script_flush_SPI0(uint8_t page, uint8_t reg, const uint8_t *values, int length)
+{
+	status_t status;
+
+	if (length == 0)
+	{
+		return kStatus_Success;
+	}
+	spiScriptTransfers++;
+	if (length == 1)
+	{
+		return write_SPI_page_reg_byte_SPI0(page, reg, values[0]);
+	}
+	status = write_SPI_page_reg_bytearray_SPI0(page, reg, values, length);
+
+#if defined(HRC6000_PAGE4_BURSTS)
+	if ((status == kStatus_Success) && (page == SPI0_SHADOW_PAGE) && (spiPage4Bursts == SPI_PAGE4_BURSTS_UNVERIFIED))
+	{
+		spiPage4Bursts = SPI_PAGE4_BURSTS_VERIFIED;
+		for (int i=0; (i<length) && (status == kStatus_Success); i++)
+		{
+			uint8_t val;
+
+			status = resync_SPI_shadow_SPI0(reg + i, &val);
+			if ((status == kStatus_Success) && (val != values[i]))
+			{
+				// No auto-increment after all, write the rest of the run one register at a time
+				spiPage4Bursts = SPI_PAGE4_BURSTS_FAILED;
+				spiScriptBurstMismatches++;
+				for (; (i<length) && (status == kStatus_Success); i++)
+				{
+					invalidate_SPI_shadow_SPI0(reg + i);// the shadow took the burst as written
+					spiScriptTransfers++;
+					status = write_SPI_page_reg_byte_SPI0(page, reg + i, values[i]);
+				}
+			}
+		}
+	}
+#endif
+	return status;
+}
+
+// Executes the register writes of the script in order, holding the bus for the whole script.
+// Writes to consecutive registers of a page that auto-increments are merged into one burst,
+// writes repeating the value a register already got from the script are skipped.
+int write_SPI_page_reg_script_SPI0(const spi_reg_write_t *script, int count)
+{
+	spi_lock_t lock;
+	uint8_t values[SPI_DATA_LENGTH-2];
+	uint8_t runPage = 0;
+	uint8_t runReg = 0;
+	int runLength = 0;
+	status_t status = kStatus_Success;
+
+	lock = spi_lock(&spiBus_SPI0);
+	if (lock == SPI_LOCK_BUSY)
+	{
+		return kStatus_DSPI_Busy;
+	}
+	for (int i=0; (i<count) && (status == kStatus_Success); i++)
+	{
+		const spi_reg_write_t *entry = &script[i];
+
+		spiScriptEntries++;
+		if (!(entry->flags & SPI_REG_STROBE) && spi_script_is_duplicate(script, i))
+		{
+			continue;
+		}
+
+		if ((runLength > 0) && !(entry->flags & SPI_REG_STROBE) && (entry->page == runPage) &&
+			(entry->reg == (uint8_t)(runReg + runLength)) && (runLength < sizeof(values)))
+		{
+			values[runLength++] = entry->val;
+			continue;
+		}
+
+		status = spi_script_flush_SPI0(runPage, runReg, values, runLength);
+		runLength = 0;
+		if (status != kStatus_Success)
+		{
+			break;
+		}
+
+		if ((entry->flags & SPI_REG_STROBE) || !spi_script_can_merge(entry->page))
+		{
+			spiScriptTransfers++;
+			status = write_SPI_page_reg_byte_SPI0(entry->page, entry->reg, entry->val);
+		}
+		else
+		{
+			runPage = entry->page;
+			runReg = entry->reg;
+			values[0] = entry->val;
+			runLength = 1;
+		}
+	}
+	if (status == kStatus_Success)
+	{
+		status = spi_script_flush_SPI0(runPage, runReg, values, runLength);
+	}
+	spi_unlock(&spiBus_SPI0, lock);
+
+	return status;
 }
 
 void clear_SPI_buffer_SPI1()
@@ -270,89 +730,97 @@ void clear_SPI_buffer_SPI1()
 
 int write_SPI_page_reg_byte_SPI1(uint8_t page, uint8_t reg, uint8_t val)
 {
-    dspi_transfer_t masterXfer;
+	spi_lock_t lock;
     status_t status;
 
-	taskENTER_CRITICAL();
+	lock = spi_lock(&spiBus_SPI1);
+	if (lock == SPI_LOCK_BUSY)
+	{
+		return kStatus_DSPI_Busy;
+	}
 	clear_SPI_buffer_SPI1();
 	SPI_masterSendBuffer_SPI1[0]=page;
 	SPI_masterSendBuffer_SPI1[1]=reg;
 	SPI_masterSendBuffer_SPI1[2]=val;
 
-    /*Start master transfer*/
-    masterXfer.txData = SPI_masterSendBuffer_SPI1;
-    masterXfer.rxData = spi_masterReceiveBuffer_SPI1;
-    masterXfer.dataSize = 3;
-    masterXfer.configFlags = kDSPI_MasterCtar0 | kDSPI_MasterPcs0 | kDSPI_MasterPcsContinuous;
+    status = spi_transfer(&spiBus_SPI1, 3, lock);
 
-    status = DSPI_MasterTransferBlocking(SPI1, &masterXfer);
-    if (status != kStatus_Success)
-    {
-    	taskEXIT_CRITICAL();
-    	return status;
-    }
-
-	taskEXIT_CRITICAL();
-	return kStatus_Success;
+	spi_unlock(&spiBus_SPI1, lock);
+	return status;
 }
 
 int read_SPI_page_reg_byte_SPI1(uint8_t page, uint8_t reg, uint8_t* val)
 {
-    dspi_transfer_t masterXfer;
+	spi_lock_t lock;
     status_t status;
 
-	taskENTER_CRITICAL();
+	lock = spi_lock(&spiBus_SPI1);
+	if (lock == SPI_LOCK_BUSY)
+	{
+		return kStatus_DSPI_Busy;
+	}
 	clear_SPI_buffer_SPI1();
 	SPI_masterSendBuffer_SPI1[0]=page | 0x80;
 	SPI_masterSendBuffer_SPI1[1]=reg;
 	SPI_masterSendBuffer_SPI1[2]=0xFF;
 
-    /*Start master transfer*/
-    masterXfer.txData = SPI_masterSendBuffer_SPI1;
-    masterXfer.rxData = spi_masterReceiveBuffer_SPI1;
-    masterXfer.dataSize = 3;
-    masterXfer.configFlags = kDSPI_MasterCtar0 | kDSPI_MasterPcs0 | kDSPI_MasterPcsContinuous;
-
-    status = DSPI_MasterTransferBlocking(SPI1, &masterXfer);
-    if (status != kStatus_Success)
+    status = spi_transfer(&spiBus_SPI1, 3, lock);
+    if (status == kStatus_Success)
     {
-    	taskEXIT_CRITICAL();
-    	return status;
+    	*val=spi_masterReceiveBuffer_SPI1[2];
     }
 
-	*val=spi_masterReceiveBuffer_SPI1[2];
-
-	taskEXIT_CRITICAL();
-	return kStatus_Success;
+	spi_unlock(&spiBus_SPI1, lock);
+	return status;
 }
 
 int set_clear_SPI_page_reg_byte_with_mask_SPI1(uint8_t page, uint8_t reg, uint8_t mask, uint8_t val)
 {
+	spi_lock_t lock;
     status_t status;
-
 	uint8_t tmp_val;
+
+	// Hold the bus so that nobody else changes the register between the read and the write
+	lock = spi_lock(&spiBus_SPI1);
+	if (lock == SPI_LOCK_BUSY)
+	{
+		return kStatus_DSPI_Busy;
+	}
 	status = read_SPI_page_reg_byte_SPI1(page, reg, &tmp_val);
-    if (status != kStatus_Success)
+    if (status == kStatus_Success)
     {
-    	return status;
+    	tmp_val=val | (tmp_val & mask);
+    	status = write_SPI_page_reg_byte_SPI1(page, reg, tmp_val);
     }
-	tmp_val=val | (tmp_val & mask);
-	status = write_SPI_page_reg_byte_SPI1(page, reg, tmp_val);
+	spi_unlock(&spiBus_SPI1, lock);
+
+	return status;
+}
+
+int write_SPI_page_reg_bytearray_SPI1(uint8_t page, uint8_t reg, const uint8_t* values, uint8_t length)
+{
+    status_t status;
+
+	status = write_SPI_page_reg_bytearray_SPI1_start(page, reg, values, length);
     if (status != kStatus_Success)
     {
     	return status;
     }
-
-	return kStatus_Success;
+	return SPI_wait_SPI1();
 }
 
-int write_SPI_page_reg_bytearray_SPI1(uint8_t page, uint8_t reg, uint8_t* values, uint8_t length)
+// Starts the write and returns with the bus still held, SPI_wait_SPI1() completes it and releases the bus
+int write_SPI_page_reg_bytearray_SPI1_start(uint8_t page, uint8_t reg, const uint8_t* values, uint8_t length)
 {
-    dspi_transfer_t masterXfer;
+	spi_lock_t lock;
     status_t status;
 
-	taskENTER_CRITICAL();
-	clear_SPI_buffer_SPI1();
+	lock = spi_lock(&spiBus_SPI1);
+	if (lock == SPI_LOCK_BUSY)
+	{
+		return kStatus_DSPI_Busy;
+	}
+	spiBus_SPI1.startLock = lock;
 	SPI_masterSendBuffer_SPI1[0]=page;
 	SPI_masterSendBuffer_SPI1[1]=reg;
 	for (int i=0; i<length; i++)
@@ -360,29 +828,34 @@ int write_SPI_page_reg_bytearray_SPI1(uint8_t page, uint8_t reg, uint8_t* values
 		SPI_masterSendBuffer_SPI1[i+2]=values[i];
 	}
 
-    /*Start master transfer*/
-    masterXfer.txData = SPI_masterSendBuffer_SPI1;
-    masterXfer.rxData = spi_masterReceiveBuffer_SPI1;
-    masterXfer.dataSize = length+2;
-    masterXfer.configFlags = kDSPI_MasterCtar0 | kDSPI_MasterPcs0 | kDSPI_MasterPcsContinuous;
-
-    status = DSPI_MasterTransferBlocking(SPI1, &masterXfer);
+    status = spi_start_transfer(&spiBus_SPI1, length+2, lock);
     if (status != kStatus_Success)
     {
-    	taskEXIT_CRITICAL();
-    	return status;
+    	spi_unlock(&spiBus_SPI1, lock);
     }
+	return status;
+}
 
-	taskEXIT_CRITICAL();
-	return kStatus_Success;
+int SPI_wait_SPI1()
+{
+	spi_lock_t lock = spiBus_SPI1.startLock;
+    status_t status;
+
+    status = spi_wait_transfer(&spiBus_SPI1);
+	spi_unlock(&spiBus_SPI1, lock);
+	return status;
 }
 
 int read_SPI_page_reg_bytearray_SPI1(uint8_t page, uint8_t reg, uint8_t* values, uint8_t length)
 {
-    dspi_transfer_t masterXfer;
+	spi_lock_t lock;
     status_t status;
 
-	taskENTER_CRITICAL();
+	lock = spi_lock(&spiBus_SPI1);
+	if (lock == SPI_LOCK_BUSY)
+	{
+		return kStatus_DSPI_Busy;
+	}
 	clear_SPI_buffer_SPI1();
 	SPI_masterSendBuffer_SPI1[0]=page | 0x80;
 	SPI_masterSendBuffer_SPI1[1]=reg;
@@ -391,24 +864,15 @@ int read_SPI_page_reg_bytearray_SPI1(uint8_t page, uint8_t reg, uint8_t* values,
 		SPI_masterSendBuffer_SPI1[i+2]=0xFF;
 	}
 
-    /*Start master transfer*/
-    masterXfer.txData = SPI_masterSendBuffer_SPI1;
-    masterXfer.rxData = spi_masterReceiveBuffer_SPI1;
-    masterXfer.dataSize = length+2;
-    masterXfer.configFlags = kDSPI_MasterCtar0 | kDSPI_MasterPcs0 | kDSPI_MasterPcsContinuous;
-
-    status = DSPI_MasterTransferBlocking(SPI1, &masterXfer);
-    if (status != kStatus_Success)
+    status = spi_transfer(&spiBus_SPI1, length+2, lock);
+    if (status == kStatus_Success)
     {
-    	taskEXIT_CRITICAL();
-    	return status;
+    	for (int i=0; i<length; i++)
+    	{
+    		values[i]=spi_masterReceiveBuffer_SPI1[i+2];
+    	}
     }
 
-	for (int i=0; i<length; i++)
-	{
-		values[i]=spi_masterReceiveBuffer_SPI1[i+2];
-	}
-
-	taskEXIT_CRITICAL();
-	return kStatus_Success;
+	spi_unlock(&spiBus_SPI1, lock);
+	return status;
 }
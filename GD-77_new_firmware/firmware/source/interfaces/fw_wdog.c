@@ -17,12 +17,13 @@
  */
 
 #include "fw_wdog.h"
-#include "fw_pit.h"
+
+#define WATCHDOG_TASK_PERIOD_MS  200
+#define BATTERY_READ_PERIODS     10 // read the battery every 2 seconds
 
 TaskHandle_t fwwatchdogTaskHandle;
 
 static WDOG_Type *wdog_base = WDOG;
-int watchdog_refresh_tick=0;
 
 volatile bool alive_maintask;
 volatile bool alive_beeptask;
@@ -42,8 +43,6 @@ void init_watchdog()
     	wdog_base->RSTCNT;
     }
 
-    watchdog_refresh_tick=0;
-
     alive_maintask = false;
     alive_beeptask = false;
     alive_hrc6000task = false;
@@ -55,48 +54,34 @@ void init_watchdog()
 				"fw watchdog task",                      /* task name for kernel awareness debugging */
 				1000L / sizeof(portSTACK_TYPE),      /* task stack size */
 				NULL,                      			 /* optional task startup argument */
-				5U,                                  /* initial priority */
-				fwwatchdogTaskHandle					 /* optional task handle to create */
+				TASK_PRIORITY_HOUSEKEEPING,          /* initial priority */
+				&fwwatchdogTaskHandle				 /* optional task handle to create */
 				);
 }
 
 void fw_watchdog_task()
 {
+	TickType_t lastWakeTime = xTaskGetTickCount();
+
     while (1U)
     {
-    	taskENTER_CRITICAL();
-    	uint32_t tmp_timer_watchdogtask=timer_watchdogtask;
-    	taskEXIT_CRITICAL();
-    	if (tmp_timer_watchdogtask==0)
-    	{
-        	taskENTER_CRITICAL();
-        	timer_watchdogtask=10;
-        	taskEXIT_CRITICAL();
-
-        	tick_watchdog();
-    	}
-
-		vTaskDelay(0);
+    	vTaskDelayUntil(&lastWakeTime, pdMS_TO_TICKS(WATCHDOG_TASK_PERIOD_MS));
+    	tick_watchdog();
     }
 }
 
 void tick_watchdog()
 {
-	watchdog_refresh_tick++;
-	if (watchdog_refresh_tick==200)
+	if (alive_maintask && alive_beeptask && alive_hrc6000task)
 	{
-		if (alive_maintask && alive_beeptask && alive_hrc6000task)
-		{
-	    	WDOG_Refresh(wdog_base);
-		}
-	    alive_maintask = false;
-	    alive_beeptask = false;
-	    alive_hrc6000task = false;
-    	watchdog_refresh_tick=0;
+		WDOG_Refresh(wdog_base);
 	}
+	alive_maintask = false;
+	alive_beeptask = false;
+	alive_hrc6000task = false;
 
 	battery_voltage_tick++;
-	if (battery_voltage_tick==2000)
+	if (battery_voltage_tick==BATTERY_READ_PERIODS)
 	{
 		int tmp_battery_voltage = get_battery_voltage();
 		if (battery_voltage!=tmp_battery_voltage)
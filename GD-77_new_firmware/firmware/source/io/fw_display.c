@@ -29,6 +29,8 @@
 	#include "fsl_ftm.h"
 #endif
 
+static bool backlightLit = false;
+
 void fw_init_display()
 {
     PORT_SetPinMux(Port_Display_CS, Pin_Display_CS, kPORT_MuxAsGpio);
@@ -83,6 +85,7 @@ void fw_init_display()
 
 void fw_displayEnableBacklight(bool onof)
 {
+	backlightLit = onof;
 	if (onof==true)
 	{
 #ifdef DISPLAY_LED_PWM
@@ -101,6 +104,11 @@ void fw_displayEnableBacklight(bool onof)
 	}
 }
 
+bool fw_displayIsBacklightLit()
+{
+	return backlightLit;
+}
+
 void fw_displaySetBacklightIntensityPercentage(uint8_t intensityPercentage)
 {
     FTM_UpdateChnlEdgeLevelSelect(BOARD_FTM_BASEADDR, BOARD_FTM_CHANNEL, 0U);    //Disable channel output before updating the dutycycle
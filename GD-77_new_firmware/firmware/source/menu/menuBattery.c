@@ -19,20 +19,20 @@
 
 static void updateScreen();
 static void handleEvent(int buttons, int keys, int events);
-static int updateCounter;
+static TickType_t nextUpdateTick;
 
 int menuBattery(int buttons, int keys, int events, bool isFirstRun)
 {
 	if (isFirstRun)
 	{
-		updateCounter=0;
+		nextUpdateTick = xTaskGetTickCount() + pdMS_TO_TICKS(1000);
 		updateScreen();
 	}
 	else
 	{
-		if (++updateCounter > 10000)
+		if (menuTickHasPassed(nextUpdateTick))
 		{
-			updateCounter=0;
+			nextUpdateTick = xTaskGetTickCount() + pdMS_TO_TICKS(1000);
 			updateScreen();// update the screen once per second to show any changes to the battery voltage
 		}
 		if (events!=0 && keys!=0)
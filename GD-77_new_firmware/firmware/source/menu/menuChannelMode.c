@@ -24,12 +24,22 @@
 
 static void updateScreen();
 static void handleEvent(int buttons, int keys, int events);
-static void loadChannelData(bool useChannelDataInMemory);
+static void loadChannelData(bool useChannelDataInMemory, uint32_t startCycles);
+static void channelTuningPlan(struct_codeplugChannel_t *channel, trxTuningPlan_t *plan);
+static void precomputeNeighbourChannels();
 static struct_codeplugZone_t currentZone;
 static struct_codeplugRxGroup_t rxGroupData;
 static struct_codeplugContact_t contactData;
 static int currentIndexInTRxGroup=0;
 
+// The channels before and after the current one in the zone, read and planned in advance for a fast channel change
+static int neighbourChannelNumber[2] = {-1, -1};
+static struct_codeplugChannel_t neighbourChannelData[2];
+static trxTuningPlan_t neighbourPlan[2];
+// Bumped when a codeplug write may have changed them, they are only used if it has not moved since they were read
+static volatile uint32_t neighbourGeneration = 0;
+static uint32_t neighbourPlannedGeneration = 0;
+
 int menuChannelMode(int buttons, int keys, int events, bool isFirstRun)
 {
 	if (isFirstRun)
@@ -38,15 +48,16 @@ int menuChannelMode(int buttons, int keys, int events, bool isFirstRun)
 		codeplugZoneGetDataForIndex(nonVolatileSettings.currentZone,&currentZone);
 		if (channelScreenChannelData.rxFreq != 0)
 		{
-			loadChannelData(true);
+			loadChannelData(true, DWT->CYCCNT);
 		}
 		else
 		{
-			loadChannelData(false);
+			loadChannelData(false, DWT->CYCCNT);
 		}
 		currentChannelData = &channelScreenChannelData;
 		menuDisplayQSODataState = QSO_DISPLAY_DEFAULT_SCREEN;
 		updateScreen();
+		precomputeNeighbourChannels();
 	}
 	else
 	{
@@ -70,22 +81,79 @@ uint16_t byteSwap16(uint16_t in)
 	return ((in &0xff << 8) | (in >>8));
 }
 
-static void loadChannelData(bool useChannelDataInMemory)
+static void channelTuningPlan(struct_codeplugChannel_t *channel, trxTuningPlan_t *plan)
 {
+	trxTuningPlanCompute(plan, channel->rxFreq, channel->chMode, (channel->flag4 & 0x02) == 0x02, channel->rxColor, channel->txTone, channel->rxTone);
+}
+
+// Called from the USB task after a codeplug write to the channels or zones
+void menuChannelModeInvalidateNeighbours()
+{
+	neighbourGeneration++;
+}
+
+static void precomputeNeighbourChannels()
+{
+	uint32_t generation = neighbourGeneration;
+
+	if (currentZone.NOT_IN_MEMORY_numChannelsInZone == 0)
+	{
+		neighbourChannelNumber[0] = -1;
+		neighbourChannelNumber[1] = -1;
+		return;
+	}
+
+	for (int i=0; i<2; i++)
+	{
+		int index = nonVolatileSettings.currentChannelIndexInZone + ((i == 0) ? -1 : 1);
+
+		if (index < 0)
+		{
+			index = currentZone.NOT_IN_MEMORY_numChannelsInZone - 1;
+		}
+		else if (index > currentZone.NOT_IN_MEMORY_numChannelsInZone - 1)
+		{
+			index = 0;
+		}
+		neighbourChannelNumber[i] = currentZone.channels[index];
+		codeplugChannelGetDataForIndex(neighbourChannelNumber[i], &neighbourChannelData[i]);
+		channelTuningPlan(&neighbourChannelData[i], &neighbourPlan[i]);
+	}
+	neighbourPlannedGeneration = generation;
+}
+
+static void loadChannelData(bool useChannelDataInMemory, uint32_t startCycles)
+{
+	trxTuningPlan_t plan;
+	bool planned = false;
+
 	if (!useChannelDataInMemory)
 	{
-		codeplugChannelGetDataForIndex(currentZone.channels[nonVolatileSettings.currentChannelIndexInZone],&channelScreenChannelData);
+		int channelNumber = currentZone.channels[nonVolatileSettings.currentChannelIndexInZone];
+
+		for (int i=0; (i<2) && (neighbourPlannedGeneration == neighbourGeneration); i++)
+		{
+			if (neighbourChannelNumber[i] == channelNumber)
+			{
+				memcpy(&channelScreenChannelData, &neighbourChannelData[i], sizeof(struct_codeplugChannel_t));
+				memcpy(&plan, &neighbourPlan[i], sizeof(trxTuningPlan_t));
+				planned = true;
+				break;
+			}
+		}
+		if (!planned)
+		{
+			codeplugChannelGetDataForIndex(channelNumber,&channelScreenChannelData);
+		}
 	}
-	trxSetFrequency(channelScreenChannelData.rxFreq);
-	trxSetMode(channelScreenChannelData.chMode);
-	if (channelScreenChannelData.chMode == RADIO_MODE_ANALOG)
+	if (!planned)
 	{
-		trxSetBandWidth((channelScreenChannelData.flag4 & 0x02)  == 0x02);// set the bandwidth after the mode, because mode probably sets it back to 12.5kHz (note this needs to be tidied up ;-) )
+		channelTuningPlan(&channelScreenChannelData, &plan);
 	}
-	trxSetDMRColourCode(channelScreenChannelData.rxColor);
+	trxApplyTuningPlan(&plan);
 	trxSetPower(nonVolatileSettings.txPower);
-	trxSetTxCTCSS(channelScreenChannelData.txTone);
-	trxSetRxCTCSS(channelScreenChannelData.rxTone);
+	trxChannelSwitchDone(startCycles);
+
 	codeplugRxGroupGetDataForIndex(channelScreenChannelData.rxGroupList,&rxGroupData);
 	codeplugContactGetDataForIndex(rxGroupData.contacts[currentIndexInTRxGroup],&contactData);
 	if (nonVolatileSettings.overrideTG == 0)
@@ -106,7 +174,7 @@ static void updateScreen()
 
 	menuUtilityRenderHeader();
 
-	switch(menuDisplayQSODataState)
+	switch(menuUtilityTakeQSODataState())
 	{
 		case QSO_DISPLAY_DEFAULT_SCREEN:
 			codeplugUtilConvertBufToString(channelScreenChannelData.name,nameBuf,16);
@@ -135,12 +203,12 @@ static void updateScreen()
 			UC1701_render();
 			break;
 	}
-
-	menuDisplayQSODataState = QSO_DISPLAY_IDLE;
 }
 
 static void handleEvent(int buttons, int keys, int events)
 {
+	uint32_t startCycles = DWT->CYCCNT;// a channel change is timed from here
+
 	if (events & 0x02)
 	{
 		if (buttons & BUTTON_ORANGE)
@@ -226,9 +294,10 @@ static void handleEvent(int buttons, int keys, int events)
 		{
 			nonVolatileSettings.currentChannelIndexInZone =  currentZone.NOT_IN_MEMORY_numChannelsInZone - 1;
 		}
-		loadChannelData(false);
+		loadChannelData(false, startCycles);
 		menuDisplayQSODataState = QSO_DISPLAY_DEFAULT_SCREEN;
 		updateScreen();
+		precomputeNeighbourChannels();
 	}
 	else if ((keys & KEY_UP)!=0)
 	{
@@ -237,8 +306,9 @@ static void handleEvent(int buttons, int keys, int events)
 		{
 			nonVolatileSettings.currentChannelIndexInZone = 0;
 		}
-		loadChannelData(false);
+		loadChannelData(false, startCycles);
 		menuDisplayQSODataState = QSO_DISPLAY_DEFAULT_SCREEN;
 		updateScreen();
+		precomputeNeighbourChannels();
 	}
 }
@@ -31,7 +31,7 @@ int menuCredits(int buttons, int keys, int events, bool isFirstRun)
 	if (isFirstRun)
 	{
 		gMenusCurrentItemIndex=5000;
-		menuTimer = 3000;
+		menuTimerStart(3000);
 		updateScreen();
 	}
 	else
@@ -24,7 +24,7 @@ int menuFirmwareInfoScreen(int buttons, int keys, int events, bool isFirstRun)
 {
 	if (isFirstRun)
 	{
-		menuTimer = 3000;// Increased so its easier to see what version of fw is being run
+		menuTimerStart(3000);// Increased so its easier to see what version of fw is being run
 		updateScreen();
 	}
 	else
@@ -52,19 +52,20 @@ static void updateScreen()
 {
 	char buffer[17];
 	dmrIdDataStruct_t foundRecord;
+	LinkItem_t items[5];// one more than fits on the screen, to know if there are more entries
+	int numItems;
 	int numDisplayed=0;
-	LinkItem_t *item = LinkHead;
+
+	menuUtilityTakeQSODataState();
+	numItems = lastHeardCopyItems(items, gMenusCurrentItemIndex, 5);
 
 	UC1701_clearBuf();
 	UC1701_printCentered(0, "Last heard",UC1701_FONT_GD77_8x16);
 
-	// skip over the first gMenusCurrentItemIndex in the listing
-	for(int i=0;i<gMenusCurrentItemIndex;i++)
-	{
-		item=item->next;
-	}
-	while((item != NULL) && item->id != 0)
+	while((numDisplayed < numItems) && items[numDisplayed].id != 0)
 	{
+		LinkItem_t *item = &items[numDisplayed];
+
 		if (dmrIDLookup(item->id,&foundRecord))
 		{
 			UC1701_printCentered(16+(numDisplayed*16), foundRecord.text,UC1701_FONT_GD77_8x16);
@@ -85,10 +86,9 @@ static void updateScreen()
 
 		numDisplayed++;
 
-		item=item->next;
 		if (numDisplayed>3)
 		{
-			if (item!=NULL && item->id != 0)
+			if ((numDisplayed < numItems) && items[numDisplayed].id != 0)
 			{
 				gMenusEndIndex=0x01;
 			}
@@ -102,7 +102,6 @@ static void updateScreen()
 
 	UC1701_render();
 	displayLightTrigger();
-	menuDisplayQSODataState = QSO_DISPLAY_IDLE;
 }
 
 
@@ -112,13 +111,14 @@ static void handleEvent(int buttons, int keys, int events)
 	if ((keys & KEY_DOWN)!=0 && gMenusEndIndex!=0)
 	{
 		gMenusCurrentItemIndex++;
+		UC1701_scrollPages(2);// one entry, so only the header and the new entry are sent
 	}
 	else if ((keys & KEY_UP)!=0)
 	{
-		gMenusCurrentItemIndex--;
-		if (gMenusCurrentItemIndex<0)
+		if (gMenusCurrentItemIndex>0)
 		{
-			gMenusCurrentItemIndex=0;
+			gMenusCurrentItemIndex--;
+			UC1701_scrollPages(-2);
 		}
 	}
 	else if ((keys & KEY_RED)!=0)
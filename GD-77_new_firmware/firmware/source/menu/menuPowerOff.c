@@ -25,7 +25,7 @@ int menuPowerOff(int buttons, int keys, int events, bool isFirstRun)
 {
 	if (isFirstRun)
 	{
-		menuTimer = 1200;// Not sure why its this value. But never mind ;-)
+		menuTimerStart(1200);// Not sure why its this value. But never mind ;-)
 		updateScreen();
 	}
 	else
@@ -53,10 +53,10 @@ static void handleEvent(int buttons, int keys, int events)
 		return;
 	}
 
-	menuTimer--;
-
-	if (menuTimer == 0)
+	if (menuTimerHasExpired())
 	{
+		// Settings saved on the way here may still be queued
+		EEPROM_Flush();
 		// This turns the power off to the CPU.
 		GPIO_PinWrite(GPIO_Keep_Power_On, Pin_Keep_Power_On, 0);
 	}
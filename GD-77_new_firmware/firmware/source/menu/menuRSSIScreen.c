@@ -23,7 +23,8 @@ static void updateScreen();
 static void handleEvent(int buttons, int keys, int events);
 static void sampleRSSIAndNoise();
 
-static const int NUM_SAMPLES = 256;
+static const int UPDATE_PERIOD_MS = 256;// the samples taken during this period are averaged
+static TickType_t nextUpdateTick;
 static int sampleCount;
 static int RSSI_totalVal;
 static int Noise_totalVal;
@@ -31,6 +32,7 @@ int menuRSSIScreen(int buttons, int keys, int events, bool isFirstRun)
 {
 	if (isFirstRun)
 	{
+		nextUpdateTick = xTaskGetTickCount() + pdMS_TO_TICKS(UPDATE_PERIOD_MS);
 		sampleCount=0;
 		RSSI_totalVal=0;
 		Noise_totalVal=0;
@@ -43,15 +45,13 @@ int menuRSSIScreen(int buttons, int keys, int events, bool isFirstRun)
 			handleEvent(buttons, keys, events);
 		}
 
+		sampleRSSIAndNoise();
 		sampleCount++;
 
-		if (sampleCount < NUM_SAMPLES)
-		{
-			sampleRSSIAndNoise();
-		}
-		else
+		if (menuTickHasPassed(nextUpdateTick))
 		{
 			updateScreen();
+			nextUpdateTick = xTaskGetTickCount() + pdMS_TO_TICKS(UPDATE_PERIOD_MS);
 			sampleCount=0;
 			RSSI_totalVal=0;
 			Noise_totalVal=0;
@@ -66,8 +66,8 @@ static void updateScreen()
 
 	char buffer[17];
 
-		RSSI_totalVal /= NUM_SAMPLES;
-		Noise_totalVal /= NUM_SAMPLES;
+		RSSI_totalVal /= sampleCount;
+		Noise_totalVal /= sampleCount;
 
 		UC1701_clearBuf();
 		UC1701_printCentered(0, "RSSI",UC1701_FONT_GD77_8x16);
@@ -25,7 +25,7 @@ int menuSplashScreen(int buttons, int keys, int events, bool isFirstRun)
 {
 	if (isFirstRun)
 	{
-		menuTimer = 3000;
+		menuTimerStart(3000);
 		updateScreen();
 	}
 	else
@@ -51,8 +51,7 @@ static void updateScreen()
 
 static void handleEvent(int buttons, int keys, int events)
 {
-	menuTimer--;
-	if (menuTimer == 0)
+	if (menuTimerHasExpired())
 	{
 		menuSystemSetCurrentMenu(nonVolatileSettings.initialMenuNumber);
 	}
@@ -19,7 +19,7 @@
 #include "fw_settings.h"
 
 int menuDisplayLightTimer=-1;
-int menuTimer;
+TickType_t menuTimer;
 menuItemNew_t *gMenuCurrentMenuList;
 
 menuControlDataStruct_t menuControlData = { .stackPosition = 0, .stack = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}};
@@ -140,6 +140,23 @@ void displayLightOverrideTimeout(int timeout)
 	fw_displayEnableBacklight(true);
 }
 
+// The main loop runs less often while the radio is idle, so menus time things with the tick count, not with calls.
+// The subtraction keeps the comparison right when the tick count wraps.
+bool menuTickHasPassed(TickType_t deadline)
+{
+	return ((int32_t)(xTaskGetTickCount() - deadline) >= 0);
+}
+
+void menuTimerStart(int timeoutMs)
+{
+	menuTimer = xTaskGetTickCount() + pdMS_TO_TICKS(timeoutMs);
+}
+
+bool menuTimerHasExpired()
+{
+	return menuTickHasPassed(menuTimer);
+}
+
 const int MENU_EVENT_SAVE_SETTINGS = -1;
 int gMenusCurrentItemIndex; // each menu can re-use this var to hold the position in their display list. To save wasted memory if they each had their own variable
 int gMenusStartIndex;// as above
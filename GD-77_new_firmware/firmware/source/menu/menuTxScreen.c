@@ -22,15 +22,14 @@
 static void updateScreen();
 static void handleEvent(int buttons, int keys, int events);
 
-static const int PIT_COUNTS_PER_SECOND = 10000;
 static int timeInSeconds;
-static uint32_t nextSecondPIT;
+static TickType_t nextSecondTick;
 
 int menuTxScreen(int buttons, int keys, int events, bool isFirstRun)
 {
 	if (isFirstRun)
 	{
-		nextSecondPIT = PITCounter + PIT_COUNTS_PER_SECOND;
+		nextSecondTick = xTaskGetTickCount() + pdMS_TO_TICKS(1000);
 		timeInSeconds=0;
 		updateScreen();
 	    GPIO_PinWrite(GPIO_LEDgreen, Pin_LEDgreen, 0);
@@ -44,14 +43,15 @@ int menuTxScreen(int buttons, int keys, int events, bool isFirstRun)
 		{
 		    trx_activateTX();
 		}
+		wakeup_hrc6000_task();
 	}
 	else
 	{
-		if (PITCounter >= nextSecondPIT )
+		if (menuTickHasPassed(nextSecondTick))
 		{
 			timeInSeconds++;
 			updateScreen();
-			nextSecondPIT = PITCounter + PIT_COUNTS_PER_SECOND;
+			nextSecondTick = xTaskGetTickCount() + pdMS_TO_TICKS(1000);
 		}
 
 		handleEvent(buttons, keys, events);
@@ -30,7 +30,7 @@ static const int DMRID_HEADER_LENGTH = 0x0C;
 LinkItem_t callsList[NUM_LASTHEARD_STORED];
 LinkItem_t *LinkHead = callsList;
 int numLastHeard=0;
-int menuDisplayQSODataState = QSO_DISPLAY_DEFAULT_SCREEN;
+volatile int menuDisplayQSODataState = QSO_DISPLAY_DEFAULT_SCREEN;
 
 void lastheardInitList()
 {
@@ -40,6 +40,8 @@ void lastheardInitList()
     {
     	callsList[i].id=0;
         callsList[i].talkGroup=0;
+        callsList[i].ber=LASTHEARD_LINK_QUALITY_UNKNOWN;
+        callsList[i].frameLoss=LASTHEARD_LINK_QUALITY_UNKNOWN;
         if (i==0)
         {
             callsList[i].prev=NULL;
@@ -87,7 +89,71 @@ LinkItem_t * findInList(int id)
 
 int lastID=0;
 
+static void lastHeardListUpdateLocked(uint8_t *dmrDataBuffer);
+
+// Called by the HR-C6000 task, the list is relinked in a critical section so the UI never sees it half updated
 void lastHeardListUpdate(uint8_t *dmrDataBuffer)
+{
+	taskENTER_CRITICAL();
+	lastHeardListUpdateLocked(dmrDataBuffer);
+	taskEXIT_CRITICAL();
+}
+
+// Called by the HR-C6000 task during a transmission, the QSO screen is only redrawn when the shown values change
+void lastHeardUpdateLinkQuality(int id, int ber, int frameLoss)
+{
+	taskENTER_CRITICAL();
+	LinkItem_t *item = findInList(id);
+	if ((item!=NULL) && ((item->ber!=ber) || (item->frameLoss!=frameLoss)))
+	{
+		item->ber=ber;
+		item->frameLoss=frameLoss;
+		if (item==LinkHead)
+		{
+			menuDisplayQSODataState = QSO_DISPLAY_CALLER_DATA;
+		}
+	}
+	taskEXIT_CRITICAL();
+}
+
+// Copies up to maxItems entries from startIndex onwards, the UI renders from the copy
+int lastHeardCopyItems(LinkItem_t *items, int startIndex, int maxItems)
+{
+	int numCopied=0;
+
+	taskENTER_CRITICAL();
+	LinkItem_t *item = LinkHead;
+	for(int i=0;(i<startIndex) && (item!=NULL);i++)
+	{
+		item=item->next;
+	}
+	while((item!=NULL) && (numCopied<maxItems))
+	{
+		items[numCopied]=*item;
+		items[numCopied].prev=NULL;
+		items[numCopied].next=NULL;
+		numCopied++;
+		item=item->next;
+	}
+	taskEXIT_CRITICAL();
+
+	return numCopied;
+}
+
+// Returns the pending display update and marks it as handled, without losing an update the HR-C6000 task flags meanwhile
+int menuUtilityTakeQSODataState()
+{
+	int state;
+
+	taskENTER_CRITICAL();
+	state=menuDisplayQSODataState;
+	menuDisplayQSODataState=QSO_DISPLAY_IDLE;
+	taskEXIT_CRITICAL();
+
+	return state;
+}
+
+static void lastHeardListUpdateLocked(uint8_t *dmrDataBuffer)
 {
 	if (dmrDataBuffer[0] == 0x00)
 	{
@@ -157,6 +223,8 @@ void lastHeardListUpdate(uint8_t *dmrDataBuffer)
 				item->id=id;
 				item->talkGroup =  talkGroup;
 				memset(item->talkerAlias,0,32);// Clear any TA data
+				item->ber=LASTHEARD_LINK_QUALITY_UNKNOWN;
+				item->frameLoss=LASTHEARD_LINK_QUALITY_UNKNOWN;
 				menuDisplayQSODataState = QSO_DISPLAY_CALLER_DATA;// flag that the display needs to update
 			}
 		}
@@ -284,12 +352,24 @@ void menuUtilityRenderQSOData()
 {
 	char buffer[32];// buffer passed to the DMR ID lookup function, needs to be large enough to hold worst case text length that is returned. Currently 16+1
 	dmrIdDataStruct_t currentRec;
+	LinkItem_t head;
+
+	if (lastHeardCopyItems(&head,0,1)==0)
+	{
+		return;
+	}
 
-	sprintf(buffer,"TG %d", LinkHead->talkGroup);
+	sprintf(buffer,"TG %d", head.talkGroup);
 	UC1701_printCentered(16, buffer,UC1701_FONT_GD77_8x16);
 
+	if (head.ber!=LASTHEARD_LINK_QUALITY_UNKNOWN)
+	{
+		sprintf(buffer,"BER%d.%d%% FL%d.%d%%", head.ber/10, head.ber%10, head.frameLoss/10, head.frameLoss%10);
+		UC1701_printCore(0,8,buffer,UC1701_FONT_6X8,2,false);// right aligned in the header line
+	}
+
 	// first check if we have this ID in the DMR ID data
-	if (dmrIDLookup( LinkHead->id,&currentRec))
+	if (dmrIDLookup( head.id,&currentRec))
 	{
 		sprintf(buffer,"%s", currentRec.text);
 		UC1701_printCentered(32, buffer,UC1701_FONT_GD77_8x16);
@@ -297,28 +377,28 @@ void menuUtilityRenderQSOData()
 	else
 	{
 		// We don't have this ID, so try looking in the Talker alias data
-		if (LinkHead->talkerAlias[0] != 0x00)
+		if (head.talkerAlias[0] != 0x00)
 		{
-			if (strlen(LinkHead->talkerAlias)> 6)
+			if (strlen(head.talkerAlias)> 6)
 			{
 				// More than 1 line wide of text, so we need to split onto 2 lines.
-				memcpy(buffer,LinkHead->talkerAlias,6);
+				memcpy(buffer,head.talkerAlias,6);
 				buffer[6]=0x00;
 				UC1701_printCentered(32, buffer,UC1701_FONT_GD77_8x16);
 
-				memcpy(buffer,&LinkHead->talkerAlias[6],16);
+				memcpy(buffer,&head.talkerAlias[6],16);
 				buffer[16]=0x00;
 				UC1701_printAt(0,48,buffer,UC1701_FONT_GD77_8x16);
 			}
 			else
 			{
-				UC1701_printCentered(32,LinkHead->talkerAlias,UC1701_FONT_GD77_8x16);
+				UC1701_printCentered(32,head.talkerAlias,UC1701_FONT_GD77_8x16);
 			}
 		}
 		else
 		{
 			// No talker alias. So we can only show the ID.
-			sprintf(buffer,"ID: %d", LinkHead->id);
+			sprintf(buffer,"ID: %d", head.id);
 			UC1701_printCentered(32, buffer,UC1701_FONT_GD77_8x16);
 		}
 	}
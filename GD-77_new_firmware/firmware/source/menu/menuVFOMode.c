@@ -52,16 +52,10 @@ int menuVFOMode(int buttons, int keys, int events, bool isFirstRun)
 		nonVolatileSettings.initialMenuNumber=MENU_VFO_MODE;
 		currentChannelData = &nonVolatileSettings.vfoChannel;
 
-		trxSetMode(currentChannelData->chMode);
-		if (currentChannelData->chMode == RADIO_MODE_ANALOG)
-		{
-			trxSetBandWidth((currentChannelData->flag4 & 0x02)  == 0x02);// set the bandwidth after the mode, because mode probably sets it back to 12.5kHz (note this needs to be tidied up ;-) )
-		}
-
-		trxSetTxCTCSS(currentChannelData->txTone);
-		trxSetRxCTCSS(currentChannelData->rxTone);
-		trxSetFrequency(currentChannelData->rxFreq);
-		trxSetDMRColourCode(currentChannelData->rxColor);
+		trxTuningPlan_t plan;
+		trxTuningPlanCompute(&plan, currentChannelData->rxFreq, currentChannelData->chMode, (currentChannelData->flag4 & 0x02) == 0x02,
+							currentChannelData->rxColor, currentChannelData->txTone, currentChannelData->rxTone);
+		trxApplyTuningPlan(&plan);
 		trxSetPower(nonVolatileSettings.txPower);
 
 		if (nonVolatileSettings.overrideTG == 0)
@@ -124,7 +118,7 @@ static void updateScreen()
 
 	menuUtilityRenderHeader();
 
-	switch(menuDisplayQSODataState)
+	switch(menuUtilityTakeQSODataState())
 	{
 		case QSO_DISPLAY_DEFAULT_SCREEN:
 
@@ -177,8 +171,6 @@ static void updateScreen()
 			UC1701_render();
 			break;
 	}
-
-	menuDisplayQSODataState = QSO_DISPLAY_IDLE;
 }
 
 static void reset_freq_enter_digits()
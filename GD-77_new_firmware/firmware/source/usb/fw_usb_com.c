@@ -17,6 +17,7 @@
  */
 
 #include "fw_usb_com.h"
+#include "fw_settings.h"
 
 uint8_t tmp_val_0x82;
 uint8_t tmp_val_0x86;
@@ -40,6 +41,48 @@ USB_DMA_NONINIT_DATA_ALIGN(USB_DATA_ALIGN_SIZE) static uint8_t s_ComBuf[DATA_BUF
 static uint8_t sectorbuffer[4096];
 int sector = -1;
 
+TaskHandle_t fwUSBTaskHandle = NULL;
+
+void init_usb_task()
+{
+	xTaskCreate(fw_usb_task,                        /* pointer to the task */
+				"fw usb task",                      /* task name for kernel awareness debugging */
+				2000L / sizeof(portSTACK_TYPE),      /* task stack size */
+				NULL,                      			 /* optional task startup argument */
+				TASK_PRIORITY_USB,                   /* initial priority */
+				&fwUSBTaskHandle					 /* optional task handle to create */
+				);
+}
+
+void fw_usb_task()
+{
+	while (1U)
+	{
+		tick_com_request();
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+	}
+}
+
+void wakeup_usb_task_from_isr()
+{
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	if (fwUSBTaskHandle != NULL)
+	{
+		vTaskNotifyGiveFromISR(fwUSBTaskHandle, &xHigherPriorityTaskWoken);
+	}
+	portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
+
+static int put_uint32(uint8_t *buf, uint32_t value)
+{
+	buf[0]=(value>>24)&0xFF;
+	buf[1]=(value>>16)&0xFF;
+	buf[2]=(value>>8)&0xFF;
+	buf[3]=(value>>0)&0xFF;
+	return 4;
+}
+
 void tick_com_request()
 {
 	taskENTER_CRITICAL();
@@ -135,6 +178,9 @@ void tick_com_request()
 								break;
 							}
 						}
+						taskEXIT_CRITICAL();
+						codeplugIndexUpdateFlash(sector*4096, 4096);
+						taskENTER_CRITICAL();
 					}
 					sector=-1;
 				}
@@ -150,8 +196,41 @@ void tick_com_request()
 
 				taskEXIT_CRITICAL();
 				ok = EEPROM_Write(address, (uint8_t*)com_requestbuffer+8, length);
+				// Chunks of a page are only queued, the one completing it is acked once the page is programmed
+				if (ok && (((address + length) % EEPROM_PAGE_SIZE) == 0))
+				{
+					ok = EEPROM_Flush();
+				}
+				if (ok)
+				{
+					codeplugIndexUpdateEEPROM(address, length);
+				}
 				taskENTER_CRITICAL();
-			    vTaskDelay(portTICK_PERIOD_MS * 5);
+			}
+			else if (com_requestbuffer[1]==5) // DMR RX jitter buffer target (com_requestbuffer[2]: 10 ms frames, 0 => default)
+			{
+				if (com_requestbuffer[2]<=SOUND_RX_START_FRAMES_MAX)
+				{
+					nonVolatileSettings.rxAudioStartFrames=com_requestbuffer[2];
+					taskEXIT_CRITICAL();
+					settingsApplyAudioSettings();
+					settingsSaveSettings();
+					taskENTER_CRITICAL();
+					ok=true;
+				}
+			}
+			else if (com_requestbuffer[1]==6) // analog squelch (com_requestbuffer[2]: hang time in 10 ms units, com_requestbuffer[3]: hysteresis, 0 => default)
+			{
+				if ((com_requestbuffer[2]<=(TRX_SQUELCH_HANG_MS_MAX/10)) && (com_requestbuffer[3]<=TRX_SQUELCH_HYSTERESIS_MAX))
+				{
+					nonVolatileSettings.squelchHangTime=com_requestbuffer[2];
+					nonVolatileSettings.squelchHysteresis=com_requestbuffer[3];
+					taskEXIT_CRITICAL();
+					settingsApplySquelchSettings();
+					settingsSaveSettings();
+					taskENTER_CRITICAL();
+					ok=true;
+				}
 			}
 
 			if (ok)
@@ -167,6 +246,285 @@ void tick_com_request()
 				USB_DeviceCdcAcmSend(s_cdcVcom.cdcAcmHandle, USB_CDC_VCOM_BULK_IN_ENDPOINT, s_ComBuf, 1);
 			}
 		}
+		else if (com_requestbuffer[0]=='S') // 'S' read statistics (com_requestbuffer[2]: 1 => reset after reading)
+		{
+			int length=0;
+			if (com_requestbuffer[1]==1) // HR-C6000 interrupt latency
+			{
+				uint64_t sum=hrc6000LatencySum;
+				length+=put_uint32(&s_ComBuf[3+length], SystemCoreClock);
+				length+=put_uint32(&s_ComBuf[3+length], hrc6000IrqCount);
+				length+=put_uint32(&s_ComBuf[3+length], hrc6000LatencyLast);
+				length+=put_uint32(&s_ComBuf[3+length], hrc6000LatencyMax);
+				length+=put_uint32(&s_ComBuf[3+length], (uint32_t)(sum>>32));
+				length+=put_uint32(&s_ComBuf[3+length], (uint32_t)sum);
+				length+=put_uint32(&s_ComBuf[3+length], hrc6000TsCount);
+				length+=put_uint32(&s_ComBuf[3+length], hrc6000TsOverruns);
+				if (com_requestbuffer[2]==1)
+				{
+					taskEXIT_CRITICAL();
+					reset_hrc6000_latency();
+					taskENTER_CRITICAL();
+				}
+			}
+			else if (com_requestbuffer[1]==2) // sleep
+			{
+				uint64_t sleepTime=sleepTimeUs;
+				length+=put_uint32(&s_ComBuf[3+length], xTaskGetTickCount()-sleepStatsStartTick);
+				length+=put_uint32(&s_ComBuf[3+length], sleepCount);
+				length+=put_uint32(&s_ComBuf[3+length], (uint32_t)(sleepTime>>32));
+				length+=put_uint32(&s_ComBuf[3+length], (uint32_t)sleepTime);
+				if (com_requestbuffer[2]==1)
+				{
+					taskEXIT_CRITICAL();
+					reset_sleep_stats();
+					taskENTER_CRITICAL();
+				}
+			}
+			else if (com_requestbuffer[1]==3) // HR-C6000 register scripts
+			{
+				length+=put_uint32(&s_ComBuf[3+length], SystemCoreClock);
+				length+=put_uint32(&s_ComBuf[3+length], hrc6000InitCycles);
+				length+=put_uint32(&s_ComBuf[3+length], spiScriptEntries);
+				length+=put_uint32(&s_ComBuf[3+length], spiScriptTransfers);
+				length+=put_uint32(&s_ComBuf[3+length], spiScriptBurstMismatches);
+			}
+			else if (com_requestbuffer[1]==4) // SPI transactions
+			{
+				length+=put_uint32(&s_ComBuf[3+length], xTaskGetTickCount()-spiStatsStartTick);
+				length+=put_uint32(&s_ComBuf[3+length], spiTransactions_SPI0);
+				length+=put_uint32(&s_ComBuf[3+length], spiTransactions_SPI1);
+				length+=put_uint32(&s_ComBuf[3+length], spiShadowHits_SPI0);
+				if (com_requestbuffer[2]==1)
+				{
+					taskEXIT_CRITICAL();
+					reset_SPI_stats();
+					taskENTER_CRITICAL();
+				}
+			}
+			else if (com_requestbuffer[1]==5) // retune and channel switch
+			{
+				length+=put_uint32(&s_ComBuf[3+length], SystemCoreClock);
+				length+=put_uint32(&s_ComBuf[3+length], trxRetuneCount);
+				length+=put_uint32(&s_ComBuf[3+length], trxRetuneCyclesLast);
+				length+=put_uint32(&s_ComBuf[3+length], trxRetuneCyclesMax);
+				length+=put_uint32(&s_ComBuf[3+length], trxChannelSwitchCount);
+				length+=put_uint32(&s_ComBuf[3+length], trxChannelSwitchCyclesLast);
+				length+=put_uint32(&s_ComBuf[3+length], trxChannelSwitchCyclesMax);
+				if (com_requestbuffer[2]==1)
+				{
+					taskEXIT_CRITICAL();
+					trxResetRetuneStats();
+					taskENTER_CRITICAL();
+				}
+			}
+			else if (com_requestbuffer[1]==6) // flash benchmark
+			{
+				spiFlashBenchmark_t benchmark;
+				taskEXIT_CRITICAL();
+				SPI_Flash_benchmark(&benchmark);
+				taskENTER_CRITICAL();
+				length+=put_uint32(&s_ComBuf[3+length], benchmark.legacySequential);
+				length+=put_uint32(&s_ComBuf[3+length], benchmark.sequential);
+				length+=put_uint32(&s_ComBuf[3+length], benchmark.legacyRandom);
+				length+=put_uint32(&s_ComBuf[3+length], benchmark.random);
+				length+=put_uint32(&s_ComBuf[3+length], spiFlashCacheHits);
+				length+=put_uint32(&s_ComBuf[3+length], spiFlashCacheMisses);
+				if (com_requestbuffer[2]==1)
+				{
+					taskEXIT_CRITICAL();
+					SPI_Flash_resetCacheStats();
+					taskENTER_CRITICAL();
+				}
+			}
+			else if (com_requestbuffer[1]==7) // EEPROM writer
+			{
+				length+=put_uint32(&s_ComBuf[3+length], SystemCoreClock);
+				length+=put_uint32(&s_ComBuf[3+length], eepromPageWrites);
+				length+=put_uint32(&s_ComBuf[3+length], eepromCoalescedWrites);
+				length+=put_uint32(&s_ComBuf[3+length], eepromAckPolls);
+				length+=put_uint32(&s_ComBuf[3+length], eepromPageCyclesLast);
+				length+=put_uint32(&s_ComBuf[3+length], eepromPageCyclesMax);
+				length+=put_uint32(&s_ComBuf[3+length], eepromWriteErrors);
+				if (com_requestbuffer[2]==1)
+				{
+					taskEXIT_CRITICAL();
+					EEPROM_resetStats();
+					taskENTER_CRITICAL();
+				}
+			}
+			else if (com_requestbuffer[1]==8) // I2C bus
+			{
+				length+=put_uint32(&s_ComBuf[3+length], xTaskGetTickCount()-i2cStatsStartTick);
+				length+=put_uint32(&s_ComBuf[3+length], SystemCoreClock);
+				length+=put_uint32(&s_ComBuf[3+length], i2cTransfers);
+				length+=put_uint32(&s_ComBuf[3+length], i2cBusCycles);
+				length+=put_uint32(&s_ComBuf[3+length], i2cShadowWriteHits);
+				length+=put_uint32(&s_ComBuf[3+length], i2cShadowReadHits);
+				if (com_requestbuffer[2]==1)
+				{
+					taskEXIT_CRITICAL();
+					reset_I2C_stats();
+					taskENTER_CRITICAL();
+				}
+			}
+			else if (com_requestbuffer[1]==9) // analog squelch
+			{
+				length+=put_uint32(&s_ComBuf[3+length], trxSquelchReads);
+				if (com_requestbuffer[2]==1)
+				{
+					trxResetSquelchStats();
+				}
+			}
+			else if (com_requestbuffer[1]==10) // audio ring
+			{
+				length+=put_uint32(&s_ComBuf[3+length], get_wavbuffer_count());
+				length+=put_uint32(&s_ComBuf[3+length], wavbufferHighWater);
+				length+=put_uint32(&s_ComBuf[3+length], wavbufferOverruns);
+				length+=put_uint32(&s_ComBuf[3+length], wavbufferUnderruns);
+				if (com_requestbuffer[2]==1)
+				{
+					reset_wavbuffer_stats();
+				}
+			}
+			else if (com_requestbuffer[1]==11) // audio pipeline benchmark
+			{
+				soundPipelineBenchmark_t benchmark;
+				soundPipelineBenchmark(&benchmark);// short enough to run with interrupts masked, which keeps the counts clean
+				length+=put_uint32(&s_ComBuf[3+length], SystemCoreClock);
+				length+=put_uint32(&s_ComBuf[3+length], benchmark.legacyRx);
+				length+=put_uint32(&s_ComBuf[3+length], benchmark.rx);
+				length+=put_uint32(&s_ComBuf[3+length], benchmark.legacyTx);
+				length+=put_uint32(&s_ComBuf[3+length], benchmark.tx);
+			}
+			else if (com_requestbuffer[1]==12) // DMR RX audio latency
+			{
+				uint64_t sum=rxAudioLatencySum;
+				length+=put_uint32(&s_ComBuf[3+length], SystemCoreClock);
+				length+=put_uint32(&s_ComBuf[3+length], get_rx_audio_start_frames());
+				length+=put_uint32(&s_ComBuf[3+length], rxAudioLatencyCount);
+				length+=put_uint32(&s_ComBuf[3+length], rxAudioLatencyLast);
+				length+=put_uint32(&s_ComBuf[3+length], rxAudioLatencyMax);
+				length+=put_uint32(&s_ComBuf[3+length], (uint32_t)(sum>>32));
+				length+=put_uint32(&s_ComBuf[3+length], (uint32_t)sum);
+				if (com_requestbuffer[2]==1)
+				{
+					taskEXIT_CRITICAL();
+					reset_rx_audio_latency();
+					taskENTER_CRITICAL();
+				}
+			}
+			else if (com_requestbuffer[1]==13) // DMR RX jitter buffer
+			{
+				length+=put_uint32(&s_ComBuf[3+length], SystemCoreClock);
+				length+=put_uint32(&s_ComBuf[3+length], get_rx_audio_start_frames());
+				length+=put_uint32(&s_ComBuf[3+length], rxJitterCycles);
+				length+=put_uint32(&s_ComBuf[3+length], rxAudioBursts);
+				length+=put_uint32(&s_ComBuf[3+length], rxAudioLateBursts);
+				length+=put_uint32(&s_ComBuf[3+length], wavbufferUnderruns);
+				length+=put_uint32(&s_ComBuf[3+length], rxAudioConcealedFrames);
+				length+=put_uint32(&s_ComBuf[3+length], rxAudioDroppedFrames);
+				length+=put_uint32(&s_ComBuf[3+length], rxAudioDepthMin);
+				length+=put_uint32(&s_ComBuf[3+length], rxAudioDepthMax);
+				if (com_requestbuffer[2]==1)
+				{
+					taskEXIT_CRITICAL();
+					reset_rx_jitter_stats();
+					taskENTER_CRITICAL();
+				}
+			}
+			else if (com_requestbuffer[1]==14) // DMR BER of a transmission (com_requestbuffer[3]: 0 => current or last, up to 3 => older)
+			{
+				codecBerCall_t call;
+				if (codec_ber_get_call(com_requestbuffer[3], &call))
+				{
+					length+=put_uint32(&s_ComBuf[3+length], call.id);
+					length+=put_uint32(&s_ComBuf[3+length], call.frames);
+					length+=put_uint32(&s_ComBuf[3+length], call.bitErrors);
+					length+=put_uint32(&s_ComBuf[3+length], call.lostFrames);
+					for (int i=0;i<CODEC_BER_HISTOGRAM_BINS;i++)
+					{
+						length+=put_uint32(&s_ComBuf[3+length], call.histogram[i]);
+					}
+				}
+			}
+			else if (com_requestbuffer[1]==15) // vocoder reset
+			{
+				codecResetBenchmark_t benchmark={0,0};
+				// The benchmark overwrites the vocoder state, so no task may start a call while it runs.
+				// Interrupts stay enabled, the HR-C6000 interrupt only notifies its task.
+				taskEXIT_CRITICAL();
+				vTaskSuspendAll();
+				if (slot_state == DMR_STATE_IDLE)
+				{
+					codec_reset_benchmark(&benchmark);
+				}
+				xTaskResumeAll();
+				taskENTER_CRITICAL();
+				length+=put_uint32(&s_ComBuf[3+length], SystemCoreClock);
+				length+=put_uint32(&s_ComBuf[3+length], benchmark.decoder);
+				length+=put_uint32(&s_ComBuf[3+length], benchmark.encoder);
+				length+=put_uint32(&s_ComBuf[3+length], codecResetCyclesLast);
+				length+=put_uint32(&s_ComBuf[3+length], codecLateEntryCyclesLast);
+				length+=put_uint32(&s_ComBuf[3+length], codecLateEntryCyclesMax);
+				if (com_requestbuffer[2]==1)
+				{
+					codecLateEntryCyclesMax=0;
+				}
+			}
+			else if (com_requestbuffer[1]==16) // display render
+			{
+				uint64_t sum=uc1701RenderCyclesSum;
+				uint64_t printCycles=uc1701PrintCycles;
+				length+=put_uint32(&s_ComBuf[3+length], SystemCoreClock);
+				length+=put_uint32(&s_ComBuf[3+length], uc1701FramesPosted);
+				length+=put_uint32(&s_ComBuf[3+length], uc1701FramesSuperseded);
+				length+=put_uint32(&s_ComBuf[3+length], uc1701FramesIdentical);
+				length+=put_uint32(&s_ComBuf[3+length], uc1701Scrolls);
+				length+=put_uint32(&s_ComBuf[3+length], uc1701RenderCount);
+				length+=put_uint32(&s_ComBuf[3+length], uc1701RenderPages);
+				length+=put_uint32(&s_ComBuf[3+length], uc1701RenderBytes);
+				length+=put_uint32(&s_ComBuf[3+length], uc1701RenderCyclesLast);
+				length+=put_uint32(&s_ComBuf[3+length], uc1701RenderCyclesMax);
+				length+=put_uint32(&s_ComBuf[3+length], (uint32_t)(sum>>32));
+				length+=put_uint32(&s_ComBuf[3+length], (uint32_t)sum);
+				length+=put_uint32(&s_ComBuf[3+length], uc1701PrintChars);
+				length+=put_uint32(&s_ComBuf[3+length], (uint32_t)(printCycles>>32));
+				length+=put_uint32(&s_ComBuf[3+length], (uint32_t)printCycles);
+				if (com_requestbuffer[2]==1)
+				{
+					taskEXIT_CRITICAL();
+					UC1701_resetRenderStats();
+					taskENTER_CRITICAL();
+				}
+			}
+			else if (com_requestbuffer[1]==17) // codeplug index
+			{
+				length+=put_uint32(&s_ComBuf[3+length], SystemCoreClock);
+				length+=put_uint32(&s_ComBuf[3+length], codeplugIndexBuildCycles);
+				length+=put_uint32(&s_ComBuf[3+length], codeplugIndexUpdates);
+				length+=put_uint32(&s_ComBuf[3+length], codeplugChannelHits);
+				length+=put_uint32(&s_ComBuf[3+length], codeplugChannelMisses);
+				if (com_requestbuffer[2]==1)
+				{
+					codeplugChannelHits=0;
+					codeplugChannelMisses=0;
+				}
+			}
+
+			if (length>0)
+			{
+				s_ComBuf[0] = com_requestbuffer[0];
+				s_ComBuf[1]=(length>>8)&0xFF;
+				s_ComBuf[2]=(length>>0)&0xFF;
+				USB_DeviceCdcAcmSend(s_cdcVcom.cdcAcmHandle, USB_CDC_VCOM_BULK_IN_ENDPOINT, s_ComBuf, length+3);
+			}
+			else
+			{
+				s_ComBuf[0] = '-';
+				USB_DeviceCdcAcmSend(s_cdcVcom.cdcAcmHandle, USB_CDC_VCOM_BULK_IN_ENDPOINT, s_ComBuf, 1);
+			}
+		}
 		else
 		{
 			s_ComBuf[0] = '-';
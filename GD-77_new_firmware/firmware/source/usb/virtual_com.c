@@ -182,6 +182,7 @@ usb_status_t USB_DeviceCdcVcomCallback(class_handle_t handle, uint32_t event, vo
 						{
 							memcpy((uint8_t*)com_requestbuffer,s_currRecvBuf,COM_REQUESTBUFFER_SIZE);
 							com_request=1;
+							wakeup_usb_task_from_isr();
 						}
 						else
 						{